@@ -0,0 +1,33 @@
+//* Required GLSL version (shader storage buffers)
+#version 430 core
+
+//* Input vertex attributes, as example.vert
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec3 color;
+
+//* Frame block as uniformBlocks.vert (src/backend/UniformBlocks.h)
+layout(std140, binding = 0) uniform Frame
+{
+    mat4 viewProjection;
+    float time;
+    float deltaTime;
+    vec2 resolution;
+} frame;
+
+//* One matrix per instance, projection * view * model premultiplied on the CPU (Camera::modelViewProjections)
+layout(std430, binding = 2) readonly buffer Instances
+{
+    mat4 modelViewProjections[];
+};
+
+//* Output vertex attributes (TO FRAGMENT SHADER)
+out vec4 fragmentColor;
+
+void main()
+{
+    gl_PointSize = 10.0f + sin(frame.time);
+
+    fragmentColor = vec4(color, 1.0);
+
+    gl_Position = modelViewProjections[gl_InstanceID] * vec4(position, 0.0, 1.0);
+}
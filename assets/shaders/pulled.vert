@@ -0,0 +1,63 @@
+//* Required GLSL version (shader storage buffers)
+#version 430 core
+
+//* Programmable vertex pulling: no vertex attributes besides the mesh index,
+//* vertices are read from a storage buffer by `gl_VertexID` and decoded here (see GlPulledBatch.h)
+
+//* Index into `meshes`, one per draw (instanced attribute, set through the draw's base instance)
+layout(location = 0) in uint meshIndex;
+
+//* Vertex formats, same values as `PulledFormat`
+const uint FORMAT_FULL = 0u; // vec2 position, vec3 color as floats (5 words)
+const uint FORMAT_PACKED = 1u; // position as 2x snorm16, color as 4x unorm8 (2 words)
+
+struct Mesh
+{
+    uint firstWord;
+    uint format;
+    uint firstVertex;
+    uint padding;
+};
+
+layout(std430, binding = 0) readonly buffer Vertices
+{
+    uint words[];
+};
+
+layout(std430, binding = 1) readonly buffer Meshes
+{
+    Mesh meshes[];
+};
+
+//* Output vertex attributes (TO FRAGMENT SHADER)
+out vec4 fragmentColor;
+
+void main()
+{
+    Mesh mesh = meshes[meshIndex];
+
+    //* `gl_VertexID` counts from the draw's first vertex
+    uint vertex = uint(gl_VertexID) - mesh.firstVertex;
+
+    vec2 position;
+    vec3 color;
+
+    if (mesh.format == FORMAT_PACKED)
+    {
+        uint word = mesh.firstWord + 2u * vertex;
+        position = unpackSnorm2x16(words[word]);
+        color = unpackUnorm4x8(words[word + 1u]).rgb;
+    }
+    else
+    {
+        uint word = mesh.firstWord + 5u * vertex;
+        position = uintBitsToFloat(uvec2(words[word], words[word + 1u]));
+        color = uintBitsToFloat(uvec3(words[word + 2u], words[word + 3u], words[word + 4u]));
+    }
+
+    gl_PointSize = 10.0f;
+
+    fragmentColor = vec4(color, 1.0);
+
+    gl_Position = vec4(position, 0.0, 1.0);
+}
@@ -0,0 +1,33 @@
+//* Required GLSL version (explicit block bindings)
+#version 420 core
+
+//* Input vertex attributes, as example.vert
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec3 color;
+
+//* Uniform blocks, mirrored by src/backend/UniformBlocks.h (std140 offsets on the right)
+layout(std140, binding = 0) uniform Frame
+{
+    mat4 viewProjection; //  0
+    float time;          // 64
+    float deltaTime;     // 68
+    vec2 resolution;     // 72
+} frame;
+
+layout(std140, binding = 1) uniform Object
+{
+    mat4 model; //  0
+    vec4 tint;  // 64
+} object;
+
+//* Output vertex attributes (TO FRAGMENT SHADER)
+out vec4 fragmentColor;
+
+void main()
+{
+    gl_PointSize = 10.0f + sin(frame.time);
+
+    fragmentColor = vec4(color * object.tint.rgb, 1.0);
+
+    gl_Position = frame.viewProjection * object.model * vec4(position, 0.0, 1.0);
+}
@@ -0,0 +1,25 @@
+//* Required GLSL version
+#version 330 core
+
+//* uniformBlocks.vert with plain uniforms (one glUniform* call each), for comparison
+
+//* Input vertex attributes, as example.vert
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec3 color;
+
+uniform mat4 viewProjection;
+uniform float time;
+uniform mat4 model;
+uniform vec4 tint;
+
+//* Output vertex attributes (TO FRAGMENT SHADER)
+out vec4 fragmentColor;
+
+void main()
+{
+    gl_PointSize = 10.0f + sin(time);
+
+    fragmentColor = vec4(color * tint.rgb, 1.0);
+
+    gl_Position = viewProjection * model * vec4(position, 0.0, 1.0);
+}
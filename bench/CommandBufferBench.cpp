@@ -0,0 +1,130 @@
+#include "CommandBuffer.h"
+#include "JobSystem.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    int const DRAW_COUNT{ 1 << 16 };
+    int const DRAWS_PER_BUFFER{ 1024 };
+
+    //* Per object draw building: a model matrix uniform and a draw
+    void recordObjects(
+        CommandBuffer& commands,
+        int begin,
+        int end
+    )
+    {
+        commands.reset();
+        commands.bindProgram( 1 );
+        commands.bindVertexArray( 1 );
+
+        for ( int i{ begin }; i < end; ++i )
+        {
+            float const angle{ static_cast<float>( i ) * 0.01f };
+            float const c{ std::cos( angle ) };
+            float const s{ std::sin( angle ) };
+
+            // clang-format off
+            float const model[16]{
+                c,    s,    0.0f, 0.0f,
+                -s,   c,    0.0f, 0.0f,
+                0.0f, 0.0f, 1.0f, 0.0f,
+                static_cast<float>( i % 256 ) / 128.0f - 1.0f, static_cast<float>( i / 256 % 256 ) / 128.0f - 1.0f, 0.0f, 1.0f
+            };
+            // clang-format on
+
+            commands.setUniform( 0, UniformType::MAT4, model );
+            commands.draw( Primitive::TRIANGLES, 0, 3 );
+        }
+    }
+
+    int maxWorkers()
+    {
+        return std::max( static_cast<int>( std::thread::hardware_concurrency() ), 1 );
+    }
+
+    //* Recording scales with workers, each job fills its own buffer (replay keeps the buffer order)
+    void BM_RecordCommands( benchmark::State& state )
+    {
+        JobSystem jobs{ static_cast<int>( state.range( 0 ) ) };
+        std::vector<CommandBuffer> buffers( DRAW_COUNT / DRAWS_PER_BUFFER );
+
+        for ( auto _ : state )
+        {
+            jobs.parallelFor(
+                DRAW_COUNT,
+                DRAWS_PER_BUFFER,
+                [&buffers]( int begin, int end )
+                {
+                    recordObjects( buffers[begin / DRAWS_PER_BUFFER], begin, end );
+                }
+            );
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * DRAW_COUNT );
+        state.counters["bytes_per_draw"] = static_cast<double>( buffers.front().bytesUsed() ) / DRAWS_PER_BUFFER;
+    }
+
+    BENCHMARK( BM_RecordCommands )->DenseRange( 1, maxWorkers() )->UseRealTime()->Unit( benchmark::kMicrosecond );
+
+    //* Decode cost alone (no API calls)
+    void BM_ReplayCommands( benchmark::State& state )
+    {
+        struct CountingVisitor
+        {
+            int64_t draws{};
+            float checksum{};
+
+            void bindProgram( unsigned int ) {}
+            void bindVertexArray( unsigned int ) {}
+
+            void setUniform(
+                int,
+                UniformType,
+                float const* values
+            )
+            {
+                checksum += values[12];
+            }
+
+            void bindUniformRange(
+                unsigned int,
+                unsigned int,
+                uint32_t,
+                uint32_t
+            )
+            {
+            }
+
+            void draw(
+                Primitive,
+                int,
+                int count
+            )
+            {
+                draws += count;
+            }
+        };
+
+        CommandBuffer commands{};
+        recordObjects( commands, 0, DRAW_COUNT );
+
+        for ( auto _ : state )
+        {
+            CountingVisitor visitor{};
+            commands.replay( visitor );
+            benchmark::DoNotOptimize( visitor );
+        }
+
+        state.SetItemsProcessed( state.iterations() * DRAW_COUNT );
+    }
+
+    BENCHMARK( BM_ReplayCommands )->Unit( benchmark::kMicrosecond );
+}
@@ -0,0 +1,115 @@
+#include "CommandBuffer.h"
+#include "DrawQueue.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+    int const PROGRAM_COUNT{ 8 };
+    int const VERTEX_ARRAY_COUNT{ 64 };
+
+    struct SceneObject
+    {
+        int layer{};
+        bool isTranslucent{};
+        unsigned int program{};
+        unsigned int vertexArray{};
+        float depth{};
+    };
+
+    //* Mixed materials in random order: 2 layers, a quarter translucent
+    std::vector<SceneObject> stressScene( int count )
+    {
+        std::mt19937 random{ 42 };
+        std::uniform_int_distribution<int> program( 1, PROGRAM_COUNT );
+        std::uniform_int_distribution<int> vertexArray( 1, VERTEX_ARRAY_COUNT );
+        std::uniform_real_distribution<float> unit( 0.0f, 1.0f );
+
+        std::vector<SceneObject> objects( static_cast<size_t>( count ) );
+
+        for ( SceneObject& object : objects )
+        {
+            object = {
+                unit( random ) < 0.9f ? 0 : 1,
+                unit( random ) < 0.25f,
+                static_cast<unsigned int>( program( random ) ),
+                static_cast<unsigned int>( vertexArray( random ) ),
+                unit( random )
+            };
+        }
+
+        return objects;
+    }
+
+    //* Submit, sort (or not) and record a frame, counters are state changes per frame
+    void BM_DrawQueue(
+        benchmark::State& state,
+        bool isSorted
+    )
+    {
+        std::vector<SceneObject> const objects{ stressScene( static_cast<int>( state.range( 0 ) ) ) };
+
+        DrawQueue queue{};
+        CommandBuffer commands{};
+        DrawQueue::Stats stats{};
+
+        for ( auto _ : state )
+        {
+            queue.reset();
+            commands.reset();
+
+            for ( SceneObject const& object : objects )
+            {
+                queue.submit(
+                    DrawKey::make( object.layer, object.isTranslucent, object.program, object.vertexArray, object.depth ),
+                    { object.program, object.vertexArray, Primitive::TRIANGLES, 0, 3 }
+                );
+            }
+
+            if ( isSorted )
+            {
+                queue.sort();
+            }
+
+            stats = queue.record( commands );
+            benchmark::DoNotOptimize( commands.commandCount() );
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+        state.counters["program_changes"] = stats.programChanges;
+        state.counters["vao_changes"] = stats.vertexArrayChanges;
+        state.counters["commands"] = commands.commandCount();
+    }
+
+    //* Sort cost alone
+    void BM_RadixSortKeys( benchmark::State& state )
+    {
+        std::vector<SceneObject> const objects{ stressScene( static_cast<int>( state.range( 0 ) ) ) };
+        DrawQueue queue{};
+
+        for ( auto _ : state )
+        {
+            state.PauseTiming();
+            queue.reset();
+
+            for ( SceneObject const& object : objects )
+            {
+                queue.submit(
+                    DrawKey::make( object.layer, object.isTranslucent, object.program, object.vertexArray, object.depth ),
+                    { object.program, object.vertexArray, Primitive::TRIANGLES, 0, 3 }
+                );
+            }
+            state.ResumeTiming();
+
+            queue.sort();
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+}
+
+BENCHMARK_CAPTURE( BM_DrawQueue, unsorted, false )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 17 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_DrawQueue, sorted, true )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 17 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( BM_RadixSortKeys )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 17 )->Unit( benchmark::kMicrosecond );
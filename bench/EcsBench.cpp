@@ -0,0 +1,246 @@
+#include "EntityStore.h"
+#include "JobSystem.h"
+#include "Math.h"
+#include "Query.h"
+#include "RenderComponents.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    int const ENTITY_COUNT{ 1 << 20 };
+
+    //* Every SPIN_STRIDE-th entity also spins, so queries span two archetypes
+    int const SPIN_STRIDE{ 4 };
+
+    struct Spin
+    {
+        float speed{};
+    };
+
+    Transform entityTransform( int entity )
+    {
+        float const t{ static_cast<float>( entity ) };
+
+        return {
+            { std::sin( t ) * 100.0f, std::cos( t ) * 100.0f, 0.001f * t },
+            Math::fromAxisAngle( { 0.0f, 1.0f, 0.0f }, 0.1f * t ),
+            { 1.0f, 1.0f + 0.5f * std::sin( t ), 1.0f }
+        };
+    }
+
+    void buildStore( EntityStore& store )
+    {
+        for ( int i{ 0 }; i < ENTITY_COUNT; ++i )
+        {
+            Entity const entity{ store.create(
+                entityTransform( i ),
+                MeshHandle{ static_cast<uint32_t>( i % 16 ) },
+                MaterialHandle{ static_cast<uint32_t>( i % 8 ) },
+                Bounds{},
+                WorldMatrix{}
+            ) };
+
+            if ( i % SPIN_STRIDE == 0 )
+            {
+                store.add( entity, Spin{ 0.5f } );
+            }
+        }
+    }
+
+    //* Same data as one struct per object
+    struct RenderableObject
+    {
+        Transform transform{};
+        MeshHandle mesh{};
+        MaterialHandle material{};
+        Bounds bounds{};
+        WorldMatrix world{};
+    };
+
+    std::vector<RenderableObject> buildObjects()
+    {
+        std::vector<RenderableObject> objects( ENTITY_COUNT );
+
+        for ( int i{ 0 }; i < ENTITY_COUNT; ++i )
+        {
+            objects[i].transform = entityTransform( i );
+            objects[i].mesh = { static_cast<uint32_t>( i % 16 ) };
+            objects[i].material = { static_cast<uint32_t>( i % 8 ) };
+        }
+
+        return objects;
+    }
+
+    int maxWorkers()
+    {
+        return std::max( static_cast<int>( std::thread::hardware_concurrency() ), 1 );
+    }
+
+    //* Bounding sphere from position and largest scale, light work per entity so memory traffic dominates
+    void updateBounds(
+        Transform const& transform,
+        Bounds& bounds
+    )
+    {
+        bounds.center = transform.position;
+        bounds.radius = std::max( { transform.scale.x, transform.scale.y, transform.scale.z } );
+    }
+
+    //* Arg: workers (1 iterates on the calling thread)
+    void BM_EcsUpdateBounds( benchmark::State& state )
+    {
+        int const workerCount{ static_cast<int>( state.range( 0 ) ) };
+
+        JobSystem jobs{ workerCount };
+        EntityStore store{};
+        buildStore( store );
+
+        Query<Transform const, Bounds> query{ store };
+
+        auto updateChunk = []( int count, Entity const*, Transform const* transforms, Bounds* bounds )
+        {
+            for ( int i{ 0 }; i < count; ++i )
+            {
+                updateBounds( transforms[i], bounds[i] );
+            }
+        };
+
+        for ( auto _ : state )
+        {
+            if ( workerCount == 1 )
+            {
+                query.forEachChunk( updateChunk );
+            }
+            else
+            {
+                query.parallelForEachChunk( jobs, updateChunk );
+            }
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * query.count() );
+    }
+
+    //* Baseline for BM_EcsUpdateBounds: the same loop over an array of objects
+    void BM_ObjectArrayUpdateBounds( benchmark::State& state )
+    {
+        std::vector<RenderableObject> objects{ buildObjects() };
+
+        for ( auto _ : state )
+        {
+            for ( RenderableObject& object : objects )
+            {
+                updateBounds( object.transform, object.bounds );
+            }
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * ENTITY_COUNT );
+    }
+
+    //* Model matrices for rendering, compute bound; arg: workers
+    void BM_EcsComposeWorld( benchmark::State& state )
+    {
+        int const workerCount{ static_cast<int>( state.range( 0 ) ) };
+
+        JobSystem jobs{ workerCount };
+        EntityStore store{};
+        buildStore( store );
+
+        Query<Transform const, WorldMatrix> query{ store };
+
+        auto composeChunk = []( int count, Entity const*, Transform const* transforms, WorldMatrix* worlds )
+        {
+            for ( int i{ 0 }; i < count; ++i )
+            {
+                worlds[i].value = Math::compose( transforms[i] );
+            }
+        };
+
+        for ( auto _ : state )
+        {
+            if ( workerCount == 1 )
+            {
+                query.forEachChunk( composeChunk );
+            }
+            else
+            {
+                query.parallelForEachChunk( jobs, composeChunk );
+            }
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * query.count() );
+    }
+
+    //* Spinning entities only (a quarter, one archetype of two)
+    void BM_EcsSpin( benchmark::State& state )
+    {
+        EntityStore store{};
+        buildStore( store );
+
+        Query<Spin const, Transform> query{ store };
+        float const deltaTime{ 1.0f / 60.0f };
+
+        for ( auto _ : state )
+        {
+            query.forEach(
+                [deltaTime]( Spin const& spin, Transform& transform )
+                {
+                    transform.rotation = transform.rotation * Math::fromAxisAngle( { 0.0f, 1.0f, 0.0f }, spin.speed * deltaTime );
+                }
+            );
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * query.count() );
+    }
+
+    //* Structural changes: create ENTITY_COUNT / 16 entities, add and remove a component, destroy them
+    void BM_EcsCreateDestroy( benchmark::State& state )
+    {
+        int const count{ ENTITY_COUNT / 16 };
+
+        EntityStore store{};
+        std::vector<Entity> entities( count );
+
+        for ( auto _ : state )
+        {
+            for ( int i{ 0 }; i < count; ++i )
+            {
+                entities[i] = store.create( Transform{}, MeshHandle{}, MaterialHandle{}, Bounds{} );
+            }
+
+            for ( Entity entity : entities )
+            {
+                store.add( entity, Spin{ 1.0f } );
+            }
+
+            for ( Entity entity : entities )
+            {
+                store.remove<Spin>( entity );
+            }
+
+            for ( Entity entity : entities )
+            {
+                store.destroy( entity );
+            }
+        }
+
+        state.SetItemsProcessed( state.iterations() * count );
+    }
+}
+
+BENCHMARK( BM_EcsUpdateBounds )->Arg( 1 )->Arg( maxWorkers() )->ArgName( "workers" )->UseRealTime()->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_ObjectArrayUpdateBounds )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_EcsComposeWorld )->Arg( 1 )->Arg( maxWorkers() )->ArgName( "workers" )->UseRealTime()->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_EcsSpin )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_EcsCreateDestroy )->Unit( benchmark::kMillisecond );
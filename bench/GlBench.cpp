@@ -0,0 +1,1241 @@
+#include "Camera.h"
+#include "CommandBuffer.h"
+#include "DrawQueue.h"
+#include "File.h"
+#include "FrameStats.h"
+#include "GlCommands.h"
+#include "GlPulledBatch.h"
+#include "GlUniformRing.h"
+#include "GlUploader.h"
+#include "HeadlessContext.h"
+#include "Math.h"
+#include "UniformBlocks.h"
+#include "Workload.h"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "GladContext.h"
+#include <raylib.h>
+#include <rlgl.h>
+
+//* OpenGL benchmarks against a headless (EGL) context, see HeadlessContext.h
+//* Every iteration ends with glFinish() (or a fence wait), so the driver's work is part of the measurement.
+
+namespace
+{
+    //* Function pointers of the headless context, current on the benchmark thread
+    GladGLContext gl{};
+
+    //* Create the context and load the function pointers on first use
+    bool requireContext( benchmark::State& state )
+    {
+        static bool const isReady{ [] {
+            if ( !HeadlessContext::init( WINDOW_WIDTH, WINDOW_HEIGHT ) )
+            {
+                return false;
+            }
+
+            SetTraceLogLevel( LOG_WARNING );
+
+            if ( !GladContext::load( gl, reinterpret_cast<GLADloadproc>( HeadlessContext::procAddressLoader() ) ) )
+            {
+                return false;
+            }
+
+            GladContext::makeCurrent( &gl );
+
+            if ( !glCreateShader )
+            {
+                return false;
+            }
+
+            glViewport( 0, 0, WINDOW_WIDTH, WINDOW_HEIGHT );
+            glEnable( GL_PROGRAM_POINT_SIZE );
+
+            return true;
+        }() };
+
+        if ( !isReady )
+        {
+            state.SkipWithError( "No headless OpenGL context" );
+        }
+
+        return isReady;
+    }
+
+    unsigned int compileShader(
+        unsigned int type,
+        std::string const& source
+    )
+    {
+        unsigned int shader{ glCreateShader( type ) };
+        char const* sourceData{ source.c_str() };
+
+        glShaderSource( shader, 1, &sourceData, nullptr );
+        glCompileShader( shader );
+
+        return shader;
+    }
+
+    bool isCompiled( unsigned int shader )
+    {
+        int success{};
+        glGetShaderiv( shader, GL_COMPILE_STATUS, &success );
+
+        return success;
+    }
+
+    unsigned int linkProgram(
+        unsigned int vertexShader,
+        unsigned int fragmentShader
+    )
+    {
+        unsigned int program{ glCreateProgram() };
+
+        glAttachShader( program, vertexShader );
+        glAttachShader( program, fragmentShader );
+        glLinkProgram( program );
+
+        return program;
+    }
+
+    bool isLinked( unsigned int program )
+    {
+        int success{};
+        glGetProgramiv( program, GL_LINK_STATUS, &success );
+
+        return success;
+    }
+
+    //* Drivers cache compiled shaders by source hash, a unique comment forces a real compile
+    std::string uncachedSource(
+        std::string const& source,
+        int64_t iteration
+    )
+    {
+        return source + "\n// " + std::to_string( iteration ) + "\n";
+    }
+
+    //* Example shader program, with its attribute layout set up in a VAO
+    struct DrawSetup
+    {
+        unsigned int program{};
+        unsigned int vao{};
+        unsigned int vbo{};
+
+        bool init( std::vector<float> const& vertices )
+        {
+            unsigned int vertexShader{ compileShader( GL_VERTEX_SHADER, readFile( vertexShaderPath ) ) };
+            unsigned int fragmentShader{ compileShader( GL_FRAGMENT_SHADER, readFile( fragmentShaderPath ) ) };
+            program = linkProgram( vertexShader, fragmentShader );
+            glDeleteShader( vertexShader );
+            glDeleteShader( fragmentShader );
+
+            glGenVertexArrays( 1, &vao );
+            glBindVertexArray( vao );
+
+            glGenBuffers( 1, &vbo );
+            glBindBuffer( GL_ARRAY_BUFFER, vbo );
+            glBufferData(
+                GL_ARRAY_BUFFER,
+                static_cast<GLsizeiptr>( vertices.size() * sizeof( float ) ),
+                vertices.data(),
+                GL_STATIC_DRAW
+            );
+
+            int const stride = 5 * sizeof( float );
+            glVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, stride, (void*)( 0 * sizeof( float ) ) );
+            glEnableVertexAttribArray( 0 );
+            glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, stride, (void*)( 2 * sizeof( float ) ) );
+            glEnableVertexAttribArray( 1 );
+
+            glUseProgram( program );
+
+            return isLinked( program );
+        }
+
+        void deinit()
+        {
+            glBindVertexArray( 0 );
+            glDeleteVertexArrays( 1, &vao );
+            glDeleteBuffers( 1, &vbo );
+            glUseProgram( 0 );
+            glDeleteProgram( program );
+        }
+    };
+
+    //* Small primitives spread over a grid, so vertex work dominates over fill
+    std::vector<float> gridVertices(
+        Primitive primitive,
+        int count
+    )
+    {
+        int const verticesPerPrimitive{ ( primitive == Primitive::TRIANGLES ) ? 3 : 1 };
+        int const columns{ 256 };
+        float const cell{ 2.0f / columns };
+
+        std::vector<float> vertices{};
+        vertices.reserve( static_cast<size_t>( count ) * verticesPerPrimitive * 5 );
+
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            float const x{ -1.0f + ( i % columns ) * cell };
+            float const y{ -1.0f + ( ( i / columns ) % columns ) * cell };
+
+            // clang-format off
+            float const corners[3][2]{
+                { x,               y },
+                { x + cell * 0.5f, y },
+                { x,               y + cell * 0.5f }
+            };
+            // clang-format on
+
+            for ( int vertex{ 0 }; vertex < verticesPerPrimitive; ++vertex )
+            {
+                vertices.insert(
+                    vertices.end(),
+                    { corners[vertex][0], corners[vertex][1], 1.0f, 0.5f, 0.0f }
+                );
+            }
+        }
+
+        return vertices;
+    }
+
+    unsigned int glPrimitive( Primitive primitive )
+    {
+        return ( primitive == Primitive::TRIANGLES ) ? GL_TRIANGLES : GL_POINTS;
+    }
+
+    //* Loader
+    void BM_LoadGLFunctions( benchmark::State& state )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        for ( auto _ : state )
+        {
+            rlLoadExtensions( HeadlessContext::procAddressLoader() );
+        }
+    }
+
+    //* Loading a per-context table, done once per context
+    void BM_LoadGladContext( benchmark::State& state )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        GladGLContext table{};
+
+        for ( auto _ : state )
+        {
+            GladContext::load( table, reinterpret_cast<GLADloadproc>( HeadlessContext::procAddressLoader() ) );
+            benchmark::DoNotOptimize( table );
+        }
+    }
+
+    //* Switching tables, done with every context switch
+    void BM_SwitchGladContext( benchmark::State& state )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        GladGLContext other{ gl };
+
+        for ( auto _ : state )
+        {
+            GladContext::makeCurrent( &other );
+            benchmark::DoNotOptimize( GladContext::current() );
+            GladContext::makeCurrent( &gl );
+            benchmark::DoNotOptimize( GladContext::current() );
+        }
+    }
+
+    //* Shader compile/link
+    void BM_CompileShader(
+        benchmark::State& state,
+        unsigned int type,
+        char const* path
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        std::string const source{ readFile( path ) };
+        int64_t iteration{ 0 };
+
+        for ( auto _ : state )
+        {
+            state.PauseTiming();
+            std::string const iterationSource{ uncachedSource( source, ++iteration ) };
+            state.ResumeTiming();
+
+            unsigned int shader{ compileShader( type, iterationSource ) };
+
+            if ( !isCompiled( shader ) )
+            {
+                state.SkipWithError( "Compilation failed" );
+            }
+
+            glDeleteShader( shader );
+        }
+    }
+
+    void BM_LinkShaderProgram( benchmark::State& state )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        std::string const vertexSource{ readFile( vertexShaderPath ) };
+        std::string const fragmentSource{ readFile( fragmentShaderPath ) };
+        int64_t iteration{ 0 };
+
+        for ( auto _ : state )
+        {
+            state.PauseTiming();
+            ++iteration;
+            unsigned int vertexShader{ compileShader( GL_VERTEX_SHADER, uncachedSource( vertexSource, iteration ) ) };
+            unsigned int fragmentShader{ compileShader( GL_FRAGMENT_SHADER, uncachedSource( fragmentSource, iteration ) ) };
+            isCompiled( vertexShader );
+            isCompiled( fragmentShader );
+            state.ResumeTiming();
+
+            unsigned int program{ linkProgram( vertexShader, fragmentShader ) };
+
+            if ( !isLinked( program ) )
+            {
+                state.SkipWithError( "Linking failed" );
+            }
+
+            glDeleteProgram( program );
+            glDeleteShader( vertexShader );
+            glDeleteShader( fragmentShader );
+        }
+    }
+
+    //* Buffer upload bandwidth
+    enum class BufferKind
+    {
+        //* glBufferSubData into a GL_STATIC_DRAW buffer
+        STATIC,
+        //* Orphan (glBufferData with nullptr) then glBufferSubData, GL_DYNAMIC_DRAW
+        DYNAMIC,
+        //* memcpy into a persistently mapped, coherent buffer (GL 4.4)
+        PERSISTENT,
+    };
+
+    void BM_UploadBuffer(
+        benchmark::State& state,
+        BufferKind kind
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        if (
+            kind == BufferKind::PERSISTENT
+            && !glad_glBufferStorage
+        )
+        {
+            state.SkipWithError( "glBufferStorage not available" );
+            return;
+        }
+
+        auto const size{ static_cast<GLsizeiptr>( state.range( 0 ) ) };
+        std::vector<unsigned char> const data( static_cast<size_t>( size ), 0x5a );
+
+        unsigned int buffer{};
+        glGenBuffers( 1, &buffer );
+        glBindBuffer( GL_ARRAY_BUFFER, buffer );
+
+        void* mapped{ nullptr };
+
+        switch ( kind )
+        {
+            case BufferKind::STATIC:
+            {
+                glBufferData( GL_ARRAY_BUFFER, size, nullptr, GL_STATIC_DRAW );
+                break;
+            }
+
+            case BufferKind::DYNAMIC:
+            {
+                glBufferData( GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW );
+                break;
+            }
+
+            case BufferKind::PERSISTENT:
+            {
+                unsigned int const flags{ GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT };
+                glBufferStorage( GL_ARRAY_BUFFER, size, nullptr, flags );
+                mapped = glMapBufferRange( GL_ARRAY_BUFFER, 0, size, flags );
+                break;
+            }
+        }
+
+        for ( auto _ : state )
+        {
+            switch ( kind )
+            {
+                case BufferKind::STATIC:
+                {
+                    glBufferSubData( GL_ARRAY_BUFFER, 0, size, data.data() );
+                    glFinish();
+                    break;
+                }
+
+                case BufferKind::DYNAMIC:
+                {
+                    glBufferData( GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW );
+                    glBufferSubData( GL_ARRAY_BUFFER, 0, size, data.data() );
+                    glFinish();
+                    break;
+                }
+
+                case BufferKind::PERSISTENT:
+                {
+                    std::memcpy( mapped, data.data(), static_cast<size_t>( size ) );
+                    GLsync fence{ glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 ) };
+                    glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED );
+                    glDeleteSync( fence );
+                    break;
+                }
+            }
+        }
+
+        if ( mapped )
+        {
+            glUnmapBuffer( GL_ARRAY_BUFFER );
+        }
+
+        glDeleteBuffers( 1, &buffer );
+
+        state.SetBytesProcessed( state.iterations() * size );
+    }
+
+    //* VAO + VBO setup as the workload does it (two attributes), bind-to-edit vs direct state access (GL 4.5)
+    void BM_VertexSetup(
+        benchmark::State& state,
+        bool isDsa
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        if ( isDsa && !gl.isVersion( 4, 5 ) )
+        {
+            state.SkipWithError( "No GL 4.5" );
+            return;
+        }
+
+        std::vector<float> const vertices( 5 * 3 * 64, 0.5f );
+        GLsizeiptr const size{ static_cast<GLsizeiptr>( vertices.size() * sizeof( float ) ) };
+        int const stride = 5 * sizeof( float );
+
+        for ( auto _ : state )
+        {
+            unsigned int vao{};
+            unsigned int vbo{};
+
+            if ( isDsa )
+            {
+                glCreateVertexArrays( 1, &vao );
+                glCreateBuffers( 1, &vbo );
+                glNamedBufferStorage( vbo, size, vertices.data(), GL_DYNAMIC_STORAGE_BIT );
+
+                for ( unsigned int index : { 0u, 1u } )
+                {
+                    glVertexArrayVertexBuffer( vao, index, vbo, ( index ? 2 : 0 ) * sizeof( float ), stride );
+                    glVertexArrayAttribFormat( vao, index, index ? 3 : 2, GL_FLOAT, GL_FALSE, 0 );
+                    glVertexArrayAttribBinding( vao, index, index );
+                    glEnableVertexArrayAttrib( vao, index );
+                }
+            }
+            else
+            {
+                glGenVertexArrays( 1, &vao );
+                glBindVertexArray( vao );
+                glGenBuffers( 1, &vbo );
+                glBindBuffer( GL_ARRAY_BUFFER, vbo );
+                glBufferData( GL_ARRAY_BUFFER, size, vertices.data(), GL_STATIC_DRAW );
+
+                glVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, stride, (void*)( 0 * sizeof( float ) ) );
+                glEnableVertexAttribArray( 0 );
+                glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, stride, (void*)( 2 * sizeof( float ) ) );
+                glEnableVertexAttribArray( 1 );
+
+                glBindVertexArray( 0 );
+            }
+
+            glDeleteVertexArrays( 1, &vao );
+            glDeleteBuffers( 1, &vbo );
+        }
+    }
+
+    //* Draw throughput: one draw call with `count` primitives
+    void BM_DrawPrimitives(
+        benchmark::State& state,
+        Primitive primitive
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+        int const vertexCount{ ( primitive == Primitive::TRIANGLES ) ? 3 * count : count };
+
+        DrawSetup setup{};
+
+        if ( !setup.init( gridVertices( primitive, count ) ) )
+        {
+            setup.deinit();
+            state.SkipWithError( "Shader program failed" );
+            return;
+        }
+
+        for ( auto _ : state )
+        {
+            glClear( GL_COLOR_BUFFER_BIT );
+            glDrawArrays( glPrimitive( primitive ), 0, vertexCount );
+            glFinish();
+        }
+
+        setup.deinit();
+
+        state.SetItemsProcessed( state.iterations() * count );
+    }
+
+    //* Draw call throughput: `count` draw calls with one primitive each
+    void BM_DrawCalls(
+        benchmark::State& state,
+        Primitive primitive
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+        int const verticesPerPrimitive{ ( primitive == Primitive::TRIANGLES ) ? 3 : 1 };
+
+        DrawSetup setup{};
+
+        if ( !setup.init( gridVertices( primitive, count ) ) )
+        {
+            setup.deinit();
+            state.SkipWithError( "Shader program failed" );
+            return;
+        }
+
+        for ( auto _ : state )
+        {
+            glClear( GL_COLOR_BUFFER_BIT );
+
+            for ( int i{ 0 }; i < count; ++i )
+            {
+                glDrawArrays( glPrimitive( primitive ), i * verticesPerPrimitive, verticesPerPrimitive );
+            }
+
+            glFinish();
+        }
+
+        setup.deinit();
+
+        state.SetItemsProcessed( state.iterations() * count );
+    }
+
+    //* Same draws as BM_DrawCalls, recorded once into a command buffer and replayed per iteration
+    //* (what the context thread is left with when recording moves to workers)
+    void BM_DrawCallsReplayed(
+        benchmark::State& state,
+        Primitive primitive
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+        int const verticesPerPrimitive{ ( primitive == Primitive::TRIANGLES ) ? 3 : 1 };
+
+        DrawSetup setup{};
+
+        if ( !setup.init( gridVertices( primitive, count ) ) )
+        {
+            setup.deinit();
+            state.SkipWithError( "Shader program failed" );
+            return;
+        }
+
+        CommandBuffer commands{};
+        commands.bindProgram( setup.program );
+        commands.bindVertexArray( setup.vao );
+
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            commands.draw( primitive, i * verticesPerPrimitive, verticesPerPrimitive );
+        }
+
+        for ( auto _ : state )
+        {
+            glClear( GL_COLOR_BUFFER_BIT );
+
+            executeGlCommands( commands );
+
+            glFinish();
+        }
+
+        setup.deinit();
+
+        state.SetItemsProcessed( state.iterations() * count );
+    }
+
+    //* State change stress: draws with random program/VAO (8 programs, 64 VAOs over one buffer),
+    //* replayed in submission order or sorted by DrawKey; counters are state changes per frame
+    void BM_MixedMaterials(
+        benchmark::State& state,
+        bool isSorted
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+        int const programCount{ 8 };
+        int const vertexArrayCount{ 64 };
+
+        DrawSetup setup{};
+
+        if ( !setup.init( gridVertices( Primitive::TRIANGLES, count ) ) )
+        {
+            setup.deinit();
+            state.SkipWithError( "Shader program failed" );
+            return;
+        }
+
+        std::string const vertexSource{ readFile( vertexShaderPath ) };
+        std::string const fragmentSource{ readFile( fragmentShaderPath ) };
+        std::vector<unsigned int> programs{};
+
+        for ( int i{ 0 }; i < programCount; ++i )
+        {
+            unsigned int vertexShader{ compileShader( GL_VERTEX_SHADER, uncachedSource( vertexSource, i ) ) };
+            unsigned int fragmentShader{ compileShader( GL_FRAGMENT_SHADER, uncachedSource( fragmentSource, i ) ) };
+            programs.push_back( linkProgram( vertexShader, fragmentShader ) );
+            glDeleteShader( vertexShader );
+            glDeleteShader( fragmentShader );
+        }
+
+        std::vector<unsigned int> vertexArrays( vertexArrayCount );
+        glGenVertexArrays( vertexArrayCount, vertexArrays.data() );
+        glBindBuffer( GL_ARRAY_BUFFER, setup.vbo );
+
+        for ( unsigned int vao : vertexArrays )
+        {
+            int const stride = 5 * sizeof( float );
+            glBindVertexArray( vao );
+            glVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, stride, (void*)( 0 * sizeof( float ) ) );
+            glEnableVertexAttribArray( 0 );
+            glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, stride, (void*)( 2 * sizeof( float ) ) );
+            glEnableVertexAttribArray( 1 );
+        }
+
+        std::mt19937 random{ 42 };
+        DrawQueue queue{};
+
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            unsigned int const program{ programs[random() % programCount] };
+            unsigned int const vao{ vertexArrays[random() % vertexArrayCount] };
+            float const depth{ static_cast<float>( random() % 1024 ) / 1024.0f };
+
+            queue.submit(
+                DrawKey::make( 0, false, program, vao, depth ),
+                { program, vao, Primitive::TRIANGLES, i * 3, 3 }
+            );
+        }
+
+        if ( isSorted )
+        {
+            queue.sort();
+        }
+
+        CommandBuffer commands{};
+        DrawQueue::Stats const stats{ queue.record( commands ) };
+
+        //* Drivers finish compiling programs on their first draw
+        executeGlCommands( commands );
+        glFinish();
+
+        for ( auto _ : state )
+        {
+            glClear( GL_COLOR_BUFFER_BIT );
+
+            executeGlCommands( commands );
+
+            glFinish();
+        }
+
+        glBindVertexArray( 0 );
+        glDeleteVertexArrays( vertexArrayCount, vertexArrays.data() );
+
+        for ( unsigned int program : programs )
+        {
+            glDeleteProgram( program );
+        }
+
+        setup.deinit();
+
+        state.SetItemsProcessed( state.iterations() * count );
+        state.counters["program_changes"] = stats.programChanges;
+        state.counters["vao_changes"] = stats.vertexArrayChanges;
+    }
+
+    //* `count` small meshes, alternating between the FULL and PACKED vertex formats:
+    //* - attributes: one VBO and VAO per mesh (the format is in the VAO), a VAO switch and draw call per mesh
+    //* - pulled: one storage buffer for all, decoded in the vertex shader, one multi-draw
+    void BM_VertexPulling(
+        benchmark::State& state,
+        bool isPulled
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        if ( isPulled && !GlPulledBatch::isSupported() )
+        {
+            state.SkipWithError( "No GL 4.3" );
+            return;
+        }
+
+        int const meshCount{ static_cast<int>( state.range( 0 ) ) };
+        int const trianglesPerMesh{ 8 };
+        int const verticesPerMesh{ 3 * trianglesPerMesh };
+        std::vector<float> const vertices{ gridVertices( Primitive::TRIANGLES, meshCount * trianglesPerMesh ) };
+
+        auto meshFormat = []( int mesh )
+        {
+            return ( mesh % 2 ) ? PulledFormat::PACKED : PulledFormat::FULL;
+        };
+
+        auto meshVertices = [&]( int mesh )
+        {
+            return vertices.data() + static_cast<size_t>( mesh ) * verticesPerMesh * 5;
+        };
+
+        unsigned int vertexShader{ compileShader(
+            GL_VERTEX_SHADER,
+            readFile( isPulled ? pulledVertexShaderPath : vertexShaderPath )
+        ) };
+        unsigned int fragmentShader{ compileShader( GL_FRAGMENT_SHADER, readFile( fragmentShaderPath ) ) };
+        unsigned int const program{ linkProgram( vertexShader, fragmentShader ) };
+        glDeleteShader( vertexShader );
+        glDeleteShader( fragmentShader );
+
+        if ( !isLinked( program ) )
+        {
+            glDeleteProgram( program );
+            state.SkipWithError( "Shader program failed" );
+            return;
+        }
+
+        glUseProgram( program );
+
+        GlPulledBatch batch{};
+        std::vector<unsigned int> vertexArrays( isPulled ? 0 : meshCount );
+        std::vector<unsigned int> buffers( isPulled ? 0 : meshCount );
+        size_t vertexBytes{};
+
+        if ( isPulled )
+        {
+            for ( int mesh{ 0 }; mesh < meshCount; ++mesh )
+            {
+                batch.addMesh( meshFormat( mesh ), meshVertices( mesh ), verticesPerMesh );
+            }
+
+            batch.upload();
+            vertexBytes = batch.vertexBytes();
+        }
+        else
+        {
+            glGenVertexArrays( meshCount, vertexArrays.data() );
+            glGenBuffers( meshCount, buffers.data() );
+
+            std::vector<uint32_t> words{};
+
+            for ( int mesh{ 0 }; mesh < meshCount; ++mesh )
+            {
+                words.clear();
+                GlPulledBatch::encode( meshFormat( mesh ), meshVertices( mesh ), verticesPerMesh, words );
+                vertexBytes += words.size() * sizeof( uint32_t );
+
+                glBindVertexArray( vertexArrays[mesh] );
+                glBindBuffer( GL_ARRAY_BUFFER, buffers[mesh] );
+                glBufferData(
+                    GL_ARRAY_BUFFER,
+                    static_cast<GLsizeiptr>( words.size() * sizeof( uint32_t ) ),
+                    words.data(),
+                    GL_STATIC_DRAW
+                );
+
+                //* Same decoding as pulled.vert, by the fixed function vertex fetch
+                if ( meshFormat( mesh ) == PulledFormat::PACKED )
+                {
+                    glVertexAttribPointer( 0, 2, GL_SHORT, GL_TRUE, 8, (void*)0 );
+                    glVertexAttribPointer( 1, 3, GL_UNSIGNED_BYTE, GL_TRUE, 8, (void*)4 );
+                }
+                else
+                {
+                    int const stride = 5 * sizeof( float );
+                    glVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, stride, (void*)( 0 * sizeof( float ) ) );
+                    glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, stride, (void*)( 2 * sizeof( float ) ) );
+                }
+
+                glEnableVertexAttribArray( 0 );
+                glEnableVertexAttribArray( 1 );
+            }
+        }
+
+        for ( auto _ : state )
+        {
+            glClear( GL_COLOR_BUFFER_BIT );
+
+            if ( isPulled )
+            {
+                batch.draw( Primitive::TRIANGLES );
+            }
+            else
+            {
+                for ( int mesh{ 0 }; mesh < meshCount; ++mesh )
+                {
+                    glBindVertexArray( vertexArrays[mesh] );
+                    glDrawArrays( GL_TRIANGLES, 0, verticesPerMesh );
+                }
+            }
+
+            glFinish();
+        }
+
+        glBindVertexArray( 0 );
+        glBindBuffer( GL_ARRAY_BUFFER, 0 );
+        glDeleteVertexArrays( static_cast<GLsizei>( vertexArrays.size() ), vertexArrays.data() );
+        glDeleteBuffers( static_cast<GLsizei>( buffers.size() ), buffers.data() );
+        batch.deinit();
+        glUseProgram( 0 );
+        glDeleteProgram( program );
+
+        state.SetItemsProcessed( state.iterations() * meshCount );
+        state.counters["vertex_bytes"] = static_cast<double>( vertexBytes );
+    }
+
+    //* `count` draws with per-object parameters (model matrix, tint) and per-frame ones (view-projection, time):
+    //* - uniforms: one glUniform* call per parameter
+    //* - ring: one memcpy into GlUniformRing and one glBindBufferRange per block
+    void BM_ObjectUniforms(
+        benchmark::State& state,
+        bool isRing
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+
+        DrawSetup setup{};
+
+        if ( !setup.init( gridVertices( Primitive::TRIANGLES, 1 ) ) )
+        {
+            setup.deinit();
+            state.SkipWithError( "Shader program failed" );
+            return;
+        }
+
+        unsigned int vertexShader{ compileShader(
+            GL_VERTEX_SHADER,
+            readFile( isRing ? uniformBlocksVertexShaderPath : uniformsVertexShaderPath )
+        ) };
+        unsigned int fragmentShader{ compileShader( GL_FRAGMENT_SHADER, readFile( fragmentShaderPath ) ) };
+        unsigned int const program{ linkProgram( vertexShader, fragmentShader ) };
+        glDeleteShader( vertexShader );
+        glDeleteShader( fragmentShader );
+
+        GlUniformRing ring{};
+
+        if ( !isLinked( program ) || ( isRing && !ring.init( static_cast<size_t>( count + 1 ) * 256 ) ) )
+        {
+            glDeleteProgram( program );
+            setup.deinit();
+            state.SkipWithError( "Shader program or uniform buffer failed" );
+            return;
+        }
+
+        glUseProgram( program );
+
+        int const viewProjectionLocation{ glGetUniformLocation( program, "viewProjection" ) };
+        int const timeLocation{ glGetUniformLocation( program, "time" ) };
+        int const modelLocation{ glGetUniformLocation( program, "model" ) };
+        int const tintLocation{ glGetUniformLocation( program, "tint" ) };
+
+        FrameBlock frameBlock{};
+        frameBlock.resolution = { static_cast<float>( WINDOW_WIDTH ), static_cast<float>( WINDOW_HEIGHT ) };
+
+        for ( int i{ 0 }; i < 4; ++i )
+        {
+            frameBlock.viewProjection.values[5 * i] = 1.0f;
+        }
+
+        ObjectBlock objectBlock{};
+        objectBlock.model = frameBlock.viewProjection;
+
+        for ( auto _ : state )
+        {
+            glClear( GL_COLOR_BUFFER_BIT );
+            frameBlock.time += 1.0f / 60.0f;
+
+            if ( isRing )
+            {
+                ring.beginFrame();
+                GlUniformRing::bind( FrameBlock::BINDING, ring.push( frameBlock ) );
+            }
+            else
+            {
+                glUniformMatrix4fv( viewProjectionLocation, 1, GL_FALSE, frameBlock.viewProjection.values );
+                glUniform1f( timeLocation, frameBlock.time );
+            }
+
+            for ( int i{ 0 }; i < count; ++i )
+            {
+                objectBlock.model.values[12] = static_cast<float>( i % 256 ) / 128.0f;
+                objectBlock.model.values[13] = static_cast<float>( ( i / 256 ) % 256 ) / 128.0f;
+                objectBlock.tint = { 1.0f, static_cast<float>( i % 7 ) / 7.0f, 1.0f, 1.0f };
+
+                if ( isRing )
+                {
+                    GlUniformRing::bind( ObjectBlock::BINDING, ring.push( objectBlock ) );
+                }
+                else
+                {
+                    glUniformMatrix4fv( modelLocation, 1, GL_FALSE, objectBlock.model.values );
+                    glUniform4fv( tintLocation, 1, &objectBlock.tint.x );
+                }
+
+                glDrawArrays( GL_TRIANGLES, 0, 3 );
+            }
+
+            if ( isRing )
+            {
+                ring.endFrame();
+            }
+
+            glFinish();
+        }
+
+        state.counters["overflows"] = static_cast<double>( ring.overflowCount() );
+
+        if ( isRing )
+        {
+            ring.deinit();
+        }
+
+        glUseProgram( 0 );
+        glDeleteProgram( program );
+        setup.deinit();
+
+        state.SetItemsProcessed( state.iterations() * count );
+    }
+
+    //* Camera frame for `count` objects: model and model-view-projection matrices on the CPU
+    //* (batched, SIMD), uploaded through the uniform ring as one storage buffer range, one instanced draw
+    void BM_CameraInstances( benchmark::State& state )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        if ( !glad_glShaderStorageBlockBinding )
+        {
+            state.SkipWithError( "No shader storage buffers (GL 4.3)" );
+            return;
+        }
+
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+
+        DrawSetup setup{};
+
+        if ( !setup.init( gridVertices( Primitive::TRIANGLES, 1 ) ) )
+        {
+            setup.deinit();
+            state.SkipWithError( "Shader program failed" );
+            return;
+        }
+
+        unsigned int vertexShader{ compileShader( GL_VERTEX_SHADER, readFile( instancedVertexShaderPath ) ) };
+        unsigned int fragmentShader{ compileShader( GL_FRAGMENT_SHADER, readFile( fragmentShaderPath ) ) };
+        unsigned int const program{ linkProgram( vertexShader, fragmentShader ) };
+        glDeleteShader( vertexShader );
+        glDeleteShader( fragmentShader );
+
+        GlUniformRing ring{};
+
+        if ( !isLinked( program ) || !ring.init( static_cast<size_t>( count ) * sizeof( Mat4 ) + 1024 ) )
+        {
+            glDeleteProgram( program );
+            setup.deinit();
+            state.SkipWithError( "Shader program or uniform buffer failed" );
+            return;
+        }
+
+        glUseProgram( program );
+
+        //* Objects on a grid in the xy-plane, slightly turned
+        std::vector<Transform> transforms( count );
+        int const columns{ static_cast<int>( std::ceil( std::sqrt( static_cast<float>( count ) ) ) ) };
+
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            transforms[i].position = {
+                4.0f * static_cast<float>( i % columns ) / columns - 2.0f,
+                4.0f * static_cast<float>( i / columns ) / columns - 2.0f,
+                0.0f
+            };
+            transforms[i].rotation = Math::fromAxisAngle( { 0.0f, 0.0f, 1.0f }, 0.01f * static_cast<float>( i ) );
+            transforms[i].scale = { 2.0f / columns, 2.0f / columns, 1.0f };
+        }
+
+        std::vector<Mat4> matrices( count );
+
+        Camera camera{};
+        float angle{};
+
+        FrameBlock frameBlock{};
+        frameBlock.resolution = { static_cast<float>( WINDOW_WIDTH ), static_cast<float>( WINDOW_HEIGHT ) };
+
+        for ( auto _ : state )
+        {
+            glClear( GL_COLOR_BUFFER_BIT );
+            ring.beginFrame();
+
+            angle += 0.01f;
+            camera.orbit( {}, 4.0f, 1.0f, angle );
+
+            Mat4 const viewProjection{ camera.viewProjection() };
+            std::memcpy( frameBlock.viewProjection.values, viewProjection.values, sizeof( Mat4 ) );
+            frameBlock.time += 1.0f / 60.0f;
+
+            Math::composeMatrices( transforms.data(), matrices.data(), count );
+            camera.modelViewProjections( matrices.data(), matrices.data(), count );
+
+            GlUniformRing::bind( FrameBlock::BINDING, ring.push( frameBlock ) );
+            GlUniformRing::bindStorage(
+                INSTANCE_MATRICES_BINDING,
+                ring.push( matrices.data(), matrices.size() * sizeof( Mat4 ) )
+            );
+
+            glDrawArraysInstanced( GL_TRIANGLES, 0, 3, count );
+
+            ring.endFrame();
+            glFinish();
+        }
+
+        state.counters["overflows"] = static_cast<double>( ring.overflowCount() );
+
+        ring.deinit();
+
+        glUseProgram( 0 );
+        glDeleteProgram( program );
+        setup.deinit();
+
+        state.SetItemsProcessed( state.iterations() * count );
+    }
+
+    //* Frame times while STREAM_LOAD_SIZE bytes are loaded in STREAM_CHUNK_SIZE buffers,
+    //* either on the render thread (one buffer per frame) or through GlUploader on a shared context
+    size_t const STREAM_LOAD_SIZE{ size_t{ 1 } << 30 };
+    size_t const STREAM_CHUNK_SIZE{ 16 << 20 };
+
+    void BM_StreamingLoad(
+        benchmark::State& state,
+        bool isAsync
+    )
+    {
+        if ( !requireContext( state ) )
+        {
+            return;
+        }
+
+        if ( isAsync && !HeadlessContext::createSharedContext() )
+        {
+            state.SkipWithError( "No shared context" );
+            return;
+        }
+
+        int const bufferCount{ static_cast<int>( STREAM_LOAD_SIZE / STREAM_CHUNK_SIZE ) };
+        int const primitiveCount{ 1 << 10 };
+
+        DrawSetup setup{};
+
+        if ( !setup.init( gridVertices( Primitive::TRIANGLES, primitiveCount ) ) )
+        {
+            setup.deinit();
+            state.SkipWithError( "Shader program failed" );
+            return;
+        }
+
+        //* Every load copies the same source, only the GL side matters
+        std::vector<std::byte> const source( STREAM_CHUNK_SIZE, std::byte{ 0x5a } );
+        std::vector<float> frameTimes{};
+
+        //* The upload thread's own context and table
+        GladGLContext uploadGl{};
+
+        for ( auto _ : state )
+        {
+            GlUploader uploader{};
+            int loadedCount{ 0 };
+            int requestedCount{ 0 };
+            frameTimes.clear();
+
+            if ( isAsync )
+            {
+                uploader.start(
+                    [&uploadGl]( bool isCurrent )
+                    {
+                        HeadlessContext::makeSharedCurrent( isCurrent );
+
+                        if ( isCurrent && !uploadGl.isLoaded() )
+                        {
+                            GladContext::load( uploadGl, reinterpret_cast<GLADloadproc>( HeadlessContext::procAddressLoader() ) );
+                        }
+
+                        GladContext::makeCurrent( isCurrent ? &uploadGl : nullptr );
+                    }
+                );
+            }
+
+            while ( loadedCount < bufferCount )
+            {
+                auto const frameStart{ std::chrono::steady_clock::now() };
+
+                if ( isAsync )
+                {
+                    //* Everything is requested up front, the loader works through the queue
+                    for ( ; requestedCount < bufferCount; ++requestedCount )
+                    {
+                        uploader.uploadBuffer( {}, source.data(), source.size() );
+                    }
+
+                    uploader.collect(
+                        [&]( GlUploader::Upload const& upload )
+                        {
+                            glDeleteBuffers( 1, &upload.buffer );
+                            ++loadedCount;
+                        }
+                    );
+                }
+                else
+                {
+                    unsigned int buffer{};
+                    glGenBuffers( 1, &buffer );
+                    glBindBuffer( GL_ARRAY_BUFFER, buffer );
+                    glBufferData(
+                        GL_ARRAY_BUFFER,
+                        static_cast<GLsizeiptr>( source.size() ),
+                        source.data(),
+                        GL_STATIC_DRAW
+                    );
+                    glDeleteBuffers( 1, &buffer );
+                    glBindBuffer( GL_ARRAY_BUFFER, setup.vbo );
+                    ++loadedCount;
+                }
+
+                glClear( GL_COLOR_BUFFER_BIT );
+                glDrawArrays( GL_TRIANGLES, 0, 3 * primitiveCount );
+                glFinish();
+
+                frameTimes.push_back(
+                    std::chrono::duration<float, std::milli>( std::chrono::steady_clock::now() - frameStart ).count()
+                );
+            }
+
+            uploader.stop();
+        }
+
+        setup.deinit();
+
+        FramePhaseSummary const summary{ summarizeSamples( frameTimes ) };
+
+        state.SetBytesProcessed( state.iterations() * static_cast<int64_t>( STREAM_LOAD_SIZE ) );
+        state.counters["frames"] = summary.count;
+        state.counters["p99_frame_ms"] = summary.p99;
+        state.counters["worst_frame_ms"] = summary.max;
+    }
+}
+
+BENCHMARK( BM_LoadGLFunctions )->Unit( benchmark::kMicrosecond );
+BENCHMARK( BM_LoadGladContext )->Unit( benchmark::kMicrosecond );
+BENCHMARK( BM_SwitchGladContext );
+
+BENCHMARK_CAPTURE( BM_CompileShader, vert, GL_VERTEX_SHADER, vertexShaderPath )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_CompileShader, frag, GL_FRAGMENT_SHADER, fragmentShaderPath )->Unit( benchmark::kMicrosecond );
+BENCHMARK( BM_LinkShaderProgram )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_CAPTURE( BM_UploadBuffer, static, BufferKind::STATIC )->RangeMultiplier( 8 )->Range( 64 << 10, 32 << 20 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_UploadBuffer, dynamic, BufferKind::DYNAMIC )->RangeMultiplier( 8 )->Range( 64 << 10, 32 << 20 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_UploadBuffer, persistent, BufferKind::PERSISTENT )->RangeMultiplier( 8 )->Range( 64 << 10, 32 << 20 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_CAPTURE( BM_VertexSetup, bind, false )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_VertexSetup, dsa, true )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_CAPTURE( BM_DrawPrimitives, points, Primitive::POINTS )->RangeMultiplier( 16 )->Range( 1 << 4, 1 << 20 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_DrawPrimitives, triangles, Primitive::TRIANGLES )->RangeMultiplier( 16 )->Range( 1 << 4, 1 << 20 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_CAPTURE( BM_DrawCalls, points, Primitive::POINTS )->RangeMultiplier( 8 )->Range( 1 << 3, 1 << 15 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_DrawCalls, triangles, Primitive::TRIANGLES )->RangeMultiplier( 8 )->Range( 1 << 3, 1 << 15 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_CAPTURE( BM_DrawCallsReplayed, triangles, Primitive::TRIANGLES )->RangeMultiplier( 8 )->Range( 1 << 3, 1 << 15 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_CAPTURE( BM_MixedMaterials, unsorted, false )->RangeMultiplier( 8 )->Range( 1 << 9, 1 << 15 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_MixedMaterials, sorted, true )->RangeMultiplier( 8 )->Range( 1 << 9, 1 << 15 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_CAPTURE( BM_VertexPulling, attributes, false )->RangeMultiplier( 4 )->Range( 1 << 6, 1 << 12 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_VertexPulling, pulled, true )->RangeMultiplier( 4 )->Range( 1 << 6, 1 << 12 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_CAPTURE( BM_ObjectUniforms, uniforms, false )->RangeMultiplier( 8 )->Range( 1 << 8, 1 << 14 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_CAPTURE( BM_ObjectUniforms, ring, true )->RangeMultiplier( 8 )->Range( 1 << 8, 1 << 14 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( BM_CameraInstances )->RangeMultiplier( 8 )->Range( 1 << 8, 1 << 14 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_CAPTURE( BM_StreamingLoad, sync, false )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+BENCHMARK_CAPTURE( BM_StreamingLoad, async, true )->Iterations( 1 )->Unit( benchmark::kMillisecond );
@@ -0,0 +1,235 @@
+#include "HeadlessContext.h"
+
+#include <iostream>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+namespace
+{
+    EGLDisplay display{ EGL_NO_DISPLAY };
+    EGLSurface surface{ EGL_NO_SURFACE };
+    EGLContext context{ EGL_NO_CONTEXT };
+    EGLConfig contextConfig{};
+
+    EGLSurface sharedSurface{ EGL_NO_SURFACE };
+    EGLContext sharedContext{ EGL_NO_CONTEXT };
+
+    EGLDisplay getDisplay()
+    {
+        auto getPlatformDisplay{ reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress( "eglGetPlatformDisplayEXT" )
+        ) };
+
+        if ( getPlatformDisplay )
+        {
+            EGLDisplay surfaceless{ getPlatformDisplay( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr ) };
+
+            if ( surfaceless != EGL_NO_DISPLAY && eglInitialize( surfaceless, nullptr, nullptr ) )
+            {
+                return surfaceless;
+            }
+        }
+
+        EGLDisplay fallback{ eglGetDisplay( EGL_DEFAULT_DISPLAY ) };
+
+        if ( fallback != EGL_NO_DISPLAY && eglInitialize( fallback, nullptr, nullptr ) )
+        {
+            return fallback;
+        }
+
+        return EGL_NO_DISPLAY;
+    }
+
+    EGLContext createContext(
+        EGLConfig config,
+        EGLContext shareContext
+    )
+    {
+        //* Newest first, buffer storage needs 4.4
+        static int const versions[][2]{
+            { 4, 6 },
+            { 4, 5 },
+            { 4, 4 },
+            { 3, 3 },
+        };
+
+        for ( auto const& version : versions )
+        {
+            EGLint const attributes[]{
+                EGL_CONTEXT_MAJOR_VERSION, version[0],
+                EGL_CONTEXT_MINOR_VERSION, version[1],
+                EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+                EGL_NONE
+            };
+
+            EGLContext created{ eglCreateContext( display, config, shareContext, attributes ) };
+
+            if ( created != EGL_NO_CONTEXT )
+            {
+                return created;
+            }
+        }
+
+        return EGL_NO_CONTEXT;
+    }
+}
+
+namespace HeadlessContext
+{
+    bool init(
+        int width,
+        int height
+    )
+    {
+        if ( isInitialized() )
+        {
+            return true;
+        }
+
+        display = getDisplay();
+
+        if ( display == EGL_NO_DISPLAY )
+        {
+            std::cerr << "[ERROR] EGL initialization failed!\n";
+            return false;
+        }
+
+        EGLint const configAttributes[]{
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8,
+            EGL_GREEN_SIZE, 8,
+            EGL_BLUE_SIZE, 8,
+            EGL_ALPHA_SIZE, 8,
+            EGL_NONE
+        };
+
+        EGLConfig config{};
+        EGLint configCount{};
+
+        if (
+            !eglChooseConfig( display, configAttributes, &config, 1, &configCount )
+            || configCount == 0
+            || !eglBindAPI( EGL_OPENGL_API )
+        )
+        {
+            std::cerr << "[ERROR] No EGL config for desktop OpenGL!\n";
+            deinit();
+            return false;
+        }
+
+        EGLint const surfaceAttributes[]{
+            EGL_WIDTH, width,
+            EGL_HEIGHT, height,
+            EGL_NONE
+        };
+
+        surface = eglCreatePbufferSurface( display, config, surfaceAttributes );
+        context = createContext( config, EGL_NO_CONTEXT );
+        contextConfig = config;
+
+        if (
+            surface == EGL_NO_SURFACE
+            || context == EGL_NO_CONTEXT
+            || !eglMakeCurrent( display, surface, surface, context )
+        )
+        {
+            std::cerr << "[ERROR] EGL context creation failed!\n";
+            deinit();
+            return false;
+        }
+
+        return true;
+    }
+
+    void deinit()
+    {
+        if ( display == EGL_NO_DISPLAY )
+        {
+            return;
+        }
+
+        eglMakeCurrent( display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+
+        if ( sharedContext != EGL_NO_CONTEXT )
+        {
+            eglDestroyContext( display, sharedContext );
+        }
+
+        if ( sharedSurface != EGL_NO_SURFACE )
+        {
+            eglDestroySurface( display, sharedSurface );
+        }
+
+        if ( context != EGL_NO_CONTEXT )
+        {
+            eglDestroyContext( display, context );
+        }
+
+        if ( surface != EGL_NO_SURFACE )
+        {
+            eglDestroySurface( display, surface );
+        }
+
+        eglTerminate( display );
+
+        display = EGL_NO_DISPLAY;
+        surface = EGL_NO_SURFACE;
+        context = EGL_NO_CONTEXT;
+        sharedSurface = EGL_NO_SURFACE;
+        sharedContext = EGL_NO_CONTEXT;
+    }
+
+    bool isInitialized()
+    {
+        return context != EGL_NO_CONTEXT;
+    }
+
+    bool createSharedContext()
+    {
+        if ( !isInitialized() )
+        {
+            return false;
+        }
+
+        if ( sharedContext != EGL_NO_CONTEXT )
+        {
+            return true;
+        }
+
+        EGLint const surfaceAttributes[]{
+            EGL_WIDTH, 1,
+            EGL_HEIGHT, 1,
+            EGL_NONE
+        };
+
+        sharedSurface = eglCreatePbufferSurface( display, contextConfig, surfaceAttributes );
+        sharedContext = createContext( contextConfig, context );
+
+        if ( sharedSurface == EGL_NO_SURFACE || sharedContext == EGL_NO_CONTEXT )
+        {
+            std::cerr << "[ERROR] EGL shared context creation failed!\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    void makeSharedCurrent( bool isCurrent )
+    {
+        if ( isCurrent )
+        {
+            eglMakeCurrent( display, sharedSurface, sharedSurface, sharedContext );
+        }
+        else
+        {
+            eglMakeCurrent( display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+        }
+    }
+
+    void* procAddressLoader()
+    {
+        return reinterpret_cast<void*>( eglGetProcAddress );
+    }
+}
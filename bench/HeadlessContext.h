@@ -0,0 +1,29 @@
+#ifndef IG20261019105000
+#define IG20261019105000
+
+//* Offscreen OpenGL context for benchmarks (EGL, no window/display needed)
+//* Prefers Mesa's surfaceless platform, falls back to the default EGL display.
+//* Requests the highest core profile available (4.6 down to 3.3) and renders into a pbuffer.
+namespace HeadlessContext
+{
+    //* Create and make current once per process, false if no context could be created
+    bool init(
+        int width,
+        int height
+    );
+
+    void deinit();
+
+    bool isInitialized();
+
+    //* Second context in the share group of the first (eg. for an upload thread), false if unsupported
+    bool createSharedContext();
+
+    //* Binds/unbinds the shared context on the calling thread
+    void makeSharedCurrent( bool isCurrent );
+
+    //* Loader for `rlLoadExtensions()`/`gladLoadGLLoader()`
+    void* procAddressLoader();
+}
+
+#endif
@@ -0,0 +1,122 @@
+#include "JobSystem.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    int const ELEMENT_COUNT{ 1 << 20 };
+    int const GRAIN_SIZE{ 4096 };
+
+    //* Stand-in for per element frame work (animation, culling, vertex generation)
+    void transform(
+        std::vector<float>& values,
+        int begin,
+        int end
+    )
+    {
+        for ( int i{ begin }; i < end; ++i )
+        {
+            float value{ values[i] };
+
+            for ( int step{ 0 }; step < 16; ++step )
+            {
+                value = std::sin( value ) * 0.5f + std::cos( value * 1.5f );
+            }
+
+            values[i] = value;
+        }
+    }
+
+    int maxWorkers()
+    {
+        return std::max( static_cast<int>( std::thread::hardware_concurrency() ), 1 );
+    }
+
+    //* Scaling over 1..N workers, compare items_per_second between the runs
+    void BM_ParallelFor( benchmark::State& state )
+    {
+        JobSystem jobs{ static_cast<int>( state.range( 0 ) ) };
+        std::vector<float> values( ELEMENT_COUNT, 1.0f );
+
+        for ( auto _ : state )
+        {
+            jobs.parallelFor(
+                ELEMENT_COUNT,
+                GRAIN_SIZE,
+                [&values]( int begin, int end )
+                {
+                    transform( values, begin, end );
+                }
+            );
+
+            benchmark::DoNotOptimize( values.data() );
+        }
+
+        state.SetItemsProcessed( state.iterations() * ELEMENT_COUNT );
+        state.counters["workers"] = static_cast<double>( jobs.workerCount() );
+    }
+
+    BENCHMARK( BM_ParallelFor )->DenseRange( 1, maxWorkers() )->UseRealTime()->Unit( benchmark::kMillisecond );
+
+    //* Spawn, steal and wait cost of empty jobs
+    void BM_JobOverhead( benchmark::State& state )
+    {
+        JobSystem jobs{ static_cast<int>( state.range( 0 ) ) };
+        int const jobCount{ 1024 };
+
+        for ( auto _ : state )
+        {
+            JobCounter counter{};
+
+            for ( int i{ 0 }; i < jobCount; ++i )
+            {
+                jobs.run( counter, []() {} );
+            }
+
+            jobs.wait( counter );
+        }
+
+        state.SetItemsProcessed( state.iterations() * jobCount );
+    }
+
+    BENCHMARK( BM_JobOverhead )->Arg( 1 )->Arg( maxWorkers() )->UseRealTime();
+
+    //* Dependencies: every job of a chain waits for its predecessor's counter
+    void BM_JobChain( benchmark::State& state )
+    {
+        JobSystem jobs{ maxWorkers() };
+        int const chainLength{ 64 };
+        std::vector<JobCounter> counters( chainLength );
+
+        for ( auto _ : state )
+        {
+            for ( int i{ 0 }; i < chainLength; ++i )
+            {
+                JobCounter* previous{ i ? &counters[i - 1] : nullptr };
+
+                jobs.run(
+                    counters[i],
+                    [&jobs, previous]()
+                    {
+                        if ( previous )
+                        {
+                            jobs.wait( *previous );
+                        }
+                    }
+                );
+            }
+
+            for ( JobCounter& counter : counters )
+            {
+                jobs.wait( counter );
+            }
+        }
+
+        state.SetItemsProcessed( state.iterations() * chainLength );
+    }
+
+    BENCHMARK( BM_JobChain )->UseRealTime();
+}
@@ -0,0 +1,145 @@
+#include "Camera.h"
+#include "CpuFeatures.h"
+#include "Math.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    std::vector<Transform> makeTransforms( int count )
+    {
+        std::vector<Transform> transforms( count );
+
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            float const t{ static_cast<float>( i ) };
+
+            transforms[i].position = { std::sin( t ), std::cos( 0.5f * t ), 0.01f * t };
+            transforms[i].rotation = Math::fromAxisAngle( { 1.0f, std::sin( t ), 0.5f }, 0.1f * t );
+            transforms[i].scale = { 1.0f + 0.1f * std::sin( t ), 1.0f, 0.5f };
+        }
+
+        return transforms;
+    }
+
+    Camera makeCamera()
+    {
+        Camera camera{};
+        camera.orbit( {}, 5.0f, 2.0f, 0.5f );
+
+        return camera;
+    }
+
+    //* Compare a SIMD level against the scalar reference, FMA may round differently
+    bool validate(
+        Mat4 const& left,
+        std::vector<Mat4> const& right,
+        SimdLevel level
+    )
+    {
+        std::vector<Mat4> reference( right.size() );
+        std::vector<Mat4> result( right.size() );
+        int const count{ static_cast<int>( right.size() ) };
+
+        Math::multiplyMatrices( left, right.data(), reference.data(), count, SimdLevel::SCALAR );
+        Math::multiplyMatrices( left, right.data(), result.data(), count, level );
+
+        for ( size_t i{ 0 }; i < reference.size(); ++i )
+        {
+            for ( int j{ 0 }; j < 16; ++j )
+            {
+                float const expected{ reference[i].values[j] };
+
+                if ( std::abs( expected - result[i].values[j] ) > 1e-5f * std::max( 1.0f, std::abs( expected ) ) )
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool isSupported( SimdLevel level )
+    {
+        SimdLevel const best{ Math::bestSimdLevel() };
+
+        return level == SimdLevel::SCALAR
+               || level == best
+               || ( level == SimdLevel::SSE && best == SimdLevel::AVX2 );
+    }
+
+    //* view projection * model for a batch of objects, as `Camera::modelViewProjections()`
+    void BM_MultiplyMatrices(
+        benchmark::State& state,
+        SimdLevel level
+    )
+    {
+        if ( !isSupported( level ) )
+        {
+            state.SkipWithError( "SIMD level not supported" );
+            return;
+        }
+
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+
+        std::vector<Transform> const transforms{ makeTransforms( count ) };
+        std::vector<Mat4> models( count );
+        std::vector<Mat4> out( count );
+        Math::composeMatrices( transforms.data(), models.data(), count );
+
+        Mat4 const viewProjection{ makeCamera().viewProjection() };
+
+        if ( !validate( viewProjection, models, level ) )
+        {
+            state.SkipWithError( "Result differs from scalar reference" );
+            return;
+        }
+
+        for ( auto _ : state )
+        {
+            Math::multiplyMatrices( viewProjection, models.data(), out.data(), count, level );
+            benchmark::ClobberMemory();
+        }
+
+        //* Single threaded, so this is per core
+        state.counters["matrices/s/core"] = benchmark::Counter(
+            static_cast<double>( state.iterations() ) * count,
+            benchmark::Counter::kIsRate
+        );
+        state.SetLabel( simdLevelName( level ) );
+    }
+
+    //* Whole CPU side of a frame: transforms to model matrices to model-view-projection matrices
+    void BM_CameraFrame( benchmark::State& state )
+    {
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+
+        std::vector<Transform> const transforms{ makeTransforms( count ) };
+        std::vector<Mat4> matrices( count );
+        Camera camera{ makeCamera() };
+        float angle{};
+
+        for ( auto _ : state )
+        {
+            angle += 0.01f;
+            camera.orbit( {}, 5.0f, 2.0f, angle );
+
+            Math::composeMatrices( transforms.data(), matrices.data(), count );
+            camera.modelViewProjections( matrices.data(), matrices.data(), count );
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * count );
+        state.SetLabel( simdLevelName( Math::bestSimdLevel() ) );
+    }
+}
+
+BENCHMARK_CAPTURE( BM_MultiplyMatrices, SCALAR, SimdLevel::SCALAR )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 16 );
+BENCHMARK_CAPTURE( BM_MultiplyMatrices, SSE, SimdLevel::SSE )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 16 );
+BENCHMARK_CAPTURE( BM_MultiplyMatrices, NEON, SimdLevel::NEON )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 16 );
+BENCHMARK_CAPTURE( BM_MultiplyMatrices, AVX2, SimdLevel::AVX2 )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 16 );
+
+BENCHMARK( BM_CameraFrame )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 16 );
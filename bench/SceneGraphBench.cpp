@@ -0,0 +1,161 @@
+#include "JobSystem.h"
+#include "Math.h"
+#include "SceneGraph.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //* Children per node, so 64k nodes are about six levels deep
+    int const BRANCHING{ 8 };
+
+    Transform nodeTransform( int node )
+    {
+        float const t{ static_cast<float>( node ) };
+
+        return {
+            { std::sin( t ), std::cos( t ), 0.1f },
+            Math::fromAxisAngle( { 0.0f, 0.0f, 1.0f }, 0.1f * t ),
+            { 0.9f, 0.9f, 0.9f }
+        };
+    }
+
+    //* Node i hangs below node ( i - 1 ) / BRANCHING
+    void buildTree(
+        SceneGraph& graph,
+        int count
+    )
+    {
+        graph.reserve( count );
+
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            graph.addNode( i ? ( i - 1 ) / BRANCHING : SceneGraph::NO_PARENT, nodeTransform( i ) );
+        }
+
+        graph.update();
+    }
+
+    int maxWorkers()
+    {
+        return std::max( static_cast<int>( std::thread::hardware_concurrency() ), 1 );
+    }
+
+    //* Args: node count, workers (1 runs without the job system), animated nodes in percent
+    //* Animated nodes are spread evenly from the last one (mostly leaves), their subtrees are recomputed too
+    void BM_SceneGraphUpdate( benchmark::State& state )
+    {
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+        int const workerCount{ static_cast<int>( state.range( 1 ) ) };
+        int const animatedPercent{ static_cast<int>( state.range( 2 ) ) };
+        int const stride{ 100 / animatedPercent };
+
+        std::optional<JobSystem> jobs{};
+
+        if ( workerCount > 1 )
+        {
+            jobs.emplace( workerCount );
+        }
+
+        SceneGraph graph{};
+        buildTree( graph, count );
+
+        float angle{};
+        int64_t updatedCount{};
+
+        for ( auto _ : state )
+        {
+            angle += 0.01f;
+            Quat const rotation{ Math::fromAxisAngle( { 0.0f, 0.0f, 1.0f }, angle ) };
+
+            for ( int node{ count - 1 }; node >= 0; node -= stride )
+            {
+                graph.setRotation( node, rotation );
+            }
+
+            graph.update( jobs ? &*jobs : nullptr );
+            updatedCount += graph.updatedCount();
+
+            benchmark::DoNotOptimize( graph.worldMatrices() );
+        }
+
+        state.counters["updated"] = benchmark::Counter(
+            static_cast<double>( updatedCount ),
+            benchmark::Counter::kAvgIterations
+        );
+        state.SetItemsProcessed( state.iterations() * count );
+    }
+
+    //* Baseline: heap allocated nodes, recursive update of the whole tree every frame
+    struct PointerNode
+    {
+        Transform local{};
+        Mat4 world{};
+        std::vector<std::unique_ptr<PointerNode>> children{};
+    };
+
+    void updatePointerTree(
+        PointerNode& node,
+        Mat4 const& parentWorld
+    )
+    {
+        node.world = parentWorld * Math::compose( node.local );
+
+        for ( auto& child : node.children )
+        {
+            updatePointerTree( *child, node.world );
+        }
+    }
+
+    void BM_PointerTreeUpdate( benchmark::State& state )
+    {
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+
+        //* Allocated in creation order, as a scene loaded node by node would be
+        std::vector<PointerNode*> nodes{};
+        nodes.reserve( count );
+
+        PointerNode root{};
+        root.local = nodeTransform( 0 );
+        nodes.push_back( &root );
+
+        for ( int i{ 1 }; i < count; ++i )
+        {
+            PointerNode& parent{ *nodes[( i - 1 ) / BRANCHING] };
+            parent.children.push_back( std::make_unique<PointerNode>() );
+            parent.children.back()->local = nodeTransform( i );
+            nodes.push_back( parent.children.back().get() );
+        }
+
+        float angle{};
+
+        for ( auto _ : state )
+        {
+            angle += 0.01f;
+            root.local.rotation = Math::fromAxisAngle( { 0.0f, 0.0f, 1.0f }, angle );
+
+            updatePointerTree( root, Mat4{} );
+
+            benchmark::DoNotOptimize( nodes.back()->world );
+        }
+
+        state.SetItemsProcessed( state.iterations() * count );
+    }
+}
+
+BENCHMARK( BM_SceneGraphUpdate )
+    ->ArgsProduct( { { 1 << 12, 1 << 16 }, { 1, maxWorkers() }, { 100, 1 } } )
+    ->ArgNames( { "nodes", "workers", "animated%" } )
+    ->UseRealTime()
+    ->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( BM_PointerTreeUpdate )
+    ->Arg( 1 << 12 )
+    ->Arg( 1 << 16 )
+    ->ArgName( "nodes" )
+    ->Unit( benchmark::kMicrosecond );
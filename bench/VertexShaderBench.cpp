@@ -0,0 +1,122 @@
+#include "VertexShader.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace
+{
+    template <typename TShader>
+    void fillInputs(
+        VertexStreamStorage& storage,
+        int count
+    )
+    {
+        storage.resize( TShader::INPUT_COUNT, count );
+        VertexStreams streams{ storage.streams() };
+
+        for ( int stream{ 0 }; stream < TShader::INPUT_COUNT; ++stream )
+        {
+            for ( int i{ 0 }; i < count; ++i )
+            {
+                streams.streams[stream][i] = std::sin( static_cast<float>( i * ( stream + 1 ) ) );
+            }
+        }
+    }
+
+    //* Compare a SIMD level against the scalar reference, FMA may round differently
+    template <typename TShader>
+    bool validate(
+        TShader const& shader,
+        SimdLevel level,
+        VertexStreamStorage& inputs,
+        int count
+    )
+    {
+        VertexStreamStorage reference{};
+        VertexStreamStorage result{};
+        reference.resize( TShader::OUTPUT_COUNT, count );
+        result.resize( TShader::OUTPUT_COUNT, count );
+
+        runVertexShader( shader, inputs.streams(), reference.streams(), 0, count, SimdLevel::SCALAR );
+        runVertexShader( shader, inputs.streams(), result.streams(), 0, count, level );
+
+        for ( size_t i{ 0 }; i < reference.data.size(); ++i )
+        {
+            if ( std::abs( reference.data[i] - result.data[i] ) > 1e-5f * std::max( 1.0f, std::abs( reference.data[i] ) ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename TShader>
+    void BM_VertexShader(
+        benchmark::State& state,
+        SimdLevel level
+    )
+    {
+        if (
+            level != SimdLevel::SCALAR
+            && level != bestSimdLevel()
+            && !( level == SimdLevel::SSE && bestSimdLevel() == SimdLevel::AVX2 )
+        )
+        {
+            state.SkipWithError( "SIMD level not supported" );
+            return;
+        }
+
+        int const count{ static_cast<int>( state.range( 0 ) ) };
+
+        TShader shader{};
+        VertexStreamStorage inputs{};
+        VertexStreamStorage outputs{};
+        fillInputs<TShader>( inputs, count );
+        outputs.resize( TShader::OUTPUT_COUNT, count );
+
+        if ( !validate( shader, level, inputs, count ) )
+        {
+            state.SkipWithError( "Result differs from scalar reference" );
+            return;
+        }
+
+        VertexStreams const in{ inputs.streams() };
+        VertexStreams const out{ outputs.streams() };
+
+        for ( auto _ : state )
+        {
+            runVertexShader( shader, in, out, 0, count, level );
+            benchmark::ClobberMemory();
+        }
+
+        //* Single threaded, so this is per core
+        state.counters["vertices/s/core"] = benchmark::Counter(
+            static_cast<double>( state.iterations() ) * count,
+            benchmark::Counter::kIsRate
+        );
+        state.SetLabel( simdLevelName( level ) );
+    }
+}
+
+#define REGISTER_VERTEX_SHADER_BENCHMARK( TShader, level )            \
+    BENCHMARK_CAPTURE( BM_##TShader, level, SimdLevel::level )        \
+        ->RangeMultiplier( 16 )                                       \
+        ->Range( 1 << 10, 1 << 18 );
+
+//* BENCHMARK_CAPTURE takes a plain function name
+#define REGISTER_VERTEX_SHADER_BENCHMARKS( TShader )    \
+    void BM_##TShader(                                  \
+        benchmark::State& state,                        \
+        SimdLevel level                                 \
+    )                                                   \
+    {                                                   \
+        BM_VertexShader<TShader>( state, level );       \
+    }                                                   \
+    REGISTER_VERTEX_SHADER_BENCHMARK( TShader, SCALAR ) \
+    REGISTER_VERTEX_SHADER_BENCHMARK( TShader, SSE )    \
+    REGISTER_VERTEX_SHADER_BENCHMARK( TShader, NEON )   \
+    REGISTER_VERTEX_SHADER_BENCHMARK( TShader, AVX2 )
+
+VERTEX_SHADERS( REGISTER_VERTEX_SHADER_BENCHMARKS )
@@ -0,0 +1,24 @@
+#include "HeadlessContext.h"
+#include <benchmark/benchmark.h>
+
+//* Benchmarks are registered in the other files of ./bench
+int main(
+    int argc,
+    char** argv
+)
+{
+    benchmark::Initialize( &argc, argv );
+
+    if ( benchmark::ReportUnrecognizedArguments( argc, argv ) )
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    //* Created lazily by the OpenGL benchmarks
+    HeadlessContext::deinit();
+
+    return 0;
+}
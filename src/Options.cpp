@@ -0,0 +1,169 @@
+#include "Options.h"
+
+#include "Backend.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+static void printUsage( char const* program )
+{
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --backend <opengl|raylib|software|all>\n"
+              << "                                 Rendering backend, 'all' runs the workload on each (default: raylib)\n"
+              << "  --frames <n>                   Stop after n frames (default: 0 = until closed)\n"
+              << "  --points                       Draw vertices as points instead of triangles\n"
+              << "  --threads <n>                  Software rasterizer threads (default: 0 = all cores)\n"
+              << "  --capture <file.ppm>           Write the last frame to file\n"
+              << "  --compare <file.ppm>           Compare the last frame pixel by pixel, fail on difference\n"
+              << "  --tolerance <n>                Channel difference --compare accepts (default: 0)\n"
+              << "  --profile <trace.json>         Profile frames, show a summary and write a Chrome trace\n"
+              << "  --frame-stats <file>           Write frame time percentiles/histograms (file.json) and per frame times (file.csv)\n"
+              << "  --late-input                   Poll input right before drawing (lower input latency)\n"
+              << "  --vsync <on|off|adaptive>      Swap interval (default: platform default)\n"
+              << "  --fps-limit <hz>               Limit the frame rate (default: 0 = unlimited)\n"
+              << "  --just-in-time                 Delay frames to finish right before the vblank\n"
+              << "  --render-thread                Draw on a render thread while the main thread prepares the next frame\n"
+              << "  --frames-in-flight <n>         Frames prepared ahead of the render thread (default: 2)\n"
+              << "  --alloc-guard <n>              Fail if the render loop allocates after n warm up frames (debug/test builds)\n"
+              << "  --help                         Show this message\n";
+}
+
+bool parseOptions(
+    Options& options,
+    int argc,
+    char** argv
+)
+{
+    for ( int i{ 1 }; i < argc; ++i )
+    {
+        std::string_view argument{ argv[i] };
+        bool hasValue{ i + 1 < argc };
+
+        if ( argument == "--backend" && hasValue )
+        {
+            std::string_view value{ argv[++i] };
+
+            if ( value == "opengl" )
+            {
+                options.backend = BackendType::OPENGL;
+            }
+            else if ( value == "raylib" )
+            {
+                options.backend = BackendType::RAYLIB;
+            }
+            else if ( value == "software" )
+            {
+                options.backend = BackendType::SOFTWARE;
+            }
+            else if ( value == "all" )
+            {
+                options.backend = BackendType::ALL;
+            }
+            else
+            {
+                std::cerr << "[ERROR] Unknown backend " << value << "\n";
+                return false;
+            }
+        }
+        else if ( argument == "--frames" && hasValue )
+        {
+            options.frames = std::atoi( argv[++i] );
+        }
+        else if ( argument == "--points" )
+        {
+            options.primitive = Primitive::POINTS;
+        }
+        else if ( argument == "--threads" && hasValue )
+        {
+            options.threads = std::atoi( argv[++i] );
+        }
+        else if ( argument == "--capture" && hasValue )
+        {
+            options.capturePath = argv[++i];
+        }
+        else if ( argument == "--compare" && hasValue )
+        {
+            options.comparePath = argv[++i];
+        }
+        else if ( argument == "--tolerance" && hasValue )
+        {
+            options.tolerance = std::atoi( argv[++i] );
+        }
+        else if ( argument == "--profile" && hasValue )
+        {
+            options.profilePath = argv[++i];
+        }
+        else if ( argument == "--frame-stats" && hasValue )
+        {
+            options.frameStatsPath = argv[++i];
+        }
+        else if ( argument == "--late-input" )
+        {
+            options.lateInput = true;
+        }
+        else if ( argument == "--vsync" && hasValue )
+        {
+            std::string_view value{ argv[++i] };
+
+            if ( value == "on" )
+            {
+                options.vsync = VsyncMode::ON;
+            }
+            else if ( value == "off" )
+            {
+                options.vsync = VsyncMode::OFF;
+            }
+            else if ( value == "adaptive" )
+            {
+                options.vsync = VsyncMode::ADAPTIVE;
+            }
+            else
+            {
+                std::cerr << "[ERROR] Unknown vsync mode " << value << "\n";
+                return false;
+            }
+        }
+        else if ( argument == "--fps-limit" && hasValue )
+        {
+            options.fpsLimit = std::atoi( argv[++i] );
+        }
+        else if ( argument == "--just-in-time" )
+        {
+            options.justInTime = true;
+        }
+        else if ( argument == "--render-thread" )
+        {
+            options.renderThread = true;
+        }
+        else if ( argument == "--frames-in-flight" && hasValue )
+        {
+            options.framesInFlight = std::max( std::atoi( argv[++i] ), 1 );
+        }
+        else if ( argument == "--alloc-guard" && hasValue )
+        {
+            options.allocationGuardFrames = std::max( std::atoi( argv[++i] ), 0 );
+        }
+        else
+        {
+            if ( argument != "--help" )
+            {
+                std::cerr << "[ERROR] Unknown argument " << argument << "\n";
+            }
+
+            printUsage( argv[0] );
+            return false;
+        }
+    }
+
+    //* The last frame has to exist
+    if (
+        ( !options.capturePath.empty() || !options.comparePath.empty() )
+        && options.frames == 0
+    )
+    {
+        options.frames = 1;
+    }
+
+    return true;
+}
@@ -0,0 +1,72 @@
+#ifndef IG20261019101900
+#define IG20261019101900
+
+#include "Backend.h"
+#include <string>
+
+enum class BackendType
+{
+    OPENGL,
+    RAYLIB,
+    SOFTWARE,
+    ALL,
+};
+
+//* Command line options
+struct Options
+{
+    BackendType backend{ BackendType::RAYLIB };
+
+    //* Stop after this many frames, 0 runs until the window is closed
+    int frames{ 0 };
+
+    Primitive primitive{ Primitive::TRIANGLES };
+
+    //* Software rasterizer threads, 0 uses all cores
+    int threads{ 0 };
+
+    //* Write the last frame to this PPM file
+    std::string capturePath{};
+
+    //* Compare the last frame against this PPM file
+    std::string comparePath{};
+
+    //* Largest channel difference `--compare` accepts
+    int tolerance{ 0 };
+
+    //* Record the profiler and write a Chrome trace to this file
+    std::string profilePath{};
+
+    //* Write frame time statistics to this file (.json) and per frame times next to it (.csv), on exit and on SIGUSR1
+    std::string frameStatsPath{};
+
+    //* Poll input after `beginFrame()`, right before the draw calls, instead of at the start of the frame
+    bool lateInput{ false };
+
+    VsyncMode vsync{ VsyncMode::DEFAULT };
+
+    //* Frame rate limit (sleep + spin), 0 is unlimited
+    int fpsLimit{ 0 };
+
+    //* Start frames as late as possible so they finish right before the vblank
+    //* (at the refresh rate unless `fpsLimit` is set)
+    bool justInTime{ false };
+
+    //* Draw on a render thread, the main thread polls input and prepares the next frames
+    bool renderThread{ false };
+
+    //* Frame packets the main thread may be ahead of the render thread (2 is double buffering)
+    int framesInFlight{ 2 };
+
+    //* Fail if anything is allocated after this many warm up frames, -1 is off
+    int allocationGuardFrames{ -1 };
+};
+
+//* Returns false on invalid arguments or `--help`
+bool parseOptions(
+    Options& options,
+    int argc,
+    char** argv
+);
+
+#endif
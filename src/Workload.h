@@ -0,0 +1,701 @@
+#ifndef IG20261019102000
+#define IG20261019102000
+
+#include "AllocationGuard.h"
+#include "Backend.h"
+#include "CommandBuffer.h"
+#include "DrawQueue.h"
+#include "FrameArena.h"
+#include "FramePacer.h"
+#include "FramePipeline.h"
+#include "FrameStats.h"
+#include "Log.h"
+#include "Options.h"
+#include "Profiler.h"
+#include "RgbaImage.h"
+#include "Signals.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int const WINDOW_WIDTH{ 800 };
+int const WINDOW_HEIGHT{ 800 };
+
+char const* const vertexShaderPath{ "assets/shaders/example.vert" };
+char const* const fragmentShaderPath{ "assets/shaders/example.frag" };
+
+//* Same output as example.vert, vertices pulled from storage buffers (GlPulledBatch, GL 4.3)
+char const* const pulledVertexShaderPath{ "assets/shaders/pulled.vert" };
+
+//* Transformed and tinted per draw, parameters from uniform blocks (GlUniformRing, UniformBlocks.h)
+//* or, for comparison, from plain uniforms
+char const* const uniformBlocksVertexShaderPath{ "assets/shaders/uniformBlocks.vert" };
+char const* const uniformsVertexShaderPath{ "assets/shaders/uniforms.vert" };
+
+//* Instanced, one model-view-projection matrix per instance from a storage buffer (Camera, GL 4.3)
+char const* const instancedVertexShaderPath{ "assets/shaders/instanced.vert" };
+
+//* Frames kept by the frame time recorder
+int const FRAME_STATS_CAPACITY{ 1 << 16 };
+
+//* Transient memory reserved per frame in flight
+size_t const FRAME_ARENA_SIZE{ 1 << 20 };
+
+//* Small enough to come from the recording thread's sub-arena
+size_t const COMMAND_BLOCK_SIZE{ 4 * 1024 };
+
+//* With `--backend all` every backend writes its own file: "stats.json" -> "stats-software_rasterizer.json"
+inline std::string outputPathFor(
+    std::string const& path,
+    char const* title,
+    Options const& options
+)
+{
+    if ( options.backend != BackendType::ALL )
+    {
+        return path;
+    }
+
+    std::string suffix{ std::string{ "-" } + title };
+    std::replace( suffix.begin(), suffix.end(), ' ', '_' );
+
+    size_t const extension{ path.find_last_of( '.' ) };
+    size_t const directory{ path.find_last_of( "/\\" ) };
+
+    if (
+        extension == std::string::npos
+        || ( directory != std::string::npos && extension < directory )
+    )
+    {
+        return path + suffix;
+    }
+
+    return path.substr( 0, extension ) + suffix + path.substr( extension );
+}
+
+inline void printFrameStats(
+    FrameStats const& frameStats,
+    char const* title
+)
+{
+    FramePhaseSummary const frame{ frameStats.summarize( static_cast<int>( FramePhase::COUNT ) ) };
+
+    std::cout << "[INFO] " << title << ": frame time p50 " << frame.p50 << " ms, p95 " << frame.p95
+              << " ms, p99 " << frame.p99 << " ms, max " << frame.max << " ms\n";
+}
+
+inline void printArenaStats(
+    FrameArena const& arena,
+    char const* title
+)
+{
+    FrameArena::Stats const stats{ arena.stats() };
+
+    std::cout << "[INFO] " << title << ": frame arena high water " << stats.highWaterBytes / 1024 << " KiB of "
+              << stats.bytesPerFrame / 1024 << " KiB per frame, " << stats.overflowCount << " overflows\n";
+}
+
+inline void printPacingStats(
+    FramePacer const& pacer,
+    char const* title
+)
+{
+    FramePhaseSummary const intervals{ pacer.intervals() };
+    FramePhaseSummary const jitter{ pacer.jitter() };
+
+    std::cout << "[INFO] " << title << ": present interval p50 " << intervals.p50 << " ms, p99 " << intervals.p99
+              << " ms, jitter p50 " << jitter.p50 << " ms, p99 " << jitter.p99 << " ms, max " << jitter.max
+              << " ms, paced wait " << pacer.meanWaitMs() << " ms/frame\n";
+}
+
+//* Limiter target: the frame rate limit, else the refresh rate for just in time pacing
+template <typename TBackend>
+double pacingTargetHz(
+    Backend<TBackend>& backend,
+    char const* title,
+    Options const& options
+)
+{
+    if ( options.fpsLimit > 0 )
+    {
+        return options.fpsLimit;
+    }
+
+    if ( !options.justInTime )
+    {
+        return 0.0;
+    }
+
+    int const refreshRate{ backend.refreshRate() };
+
+    if ( !refreshRate )
+    {
+        std::cout << "[INFO] " << title << ": refresh rate unknown, just in time pacing needs --fps-limit\n";
+    }
+
+    return refreshRate;
+}
+
+//* Capture and/or compare the frame, returns false on mismatch
+template <typename TBackend>
+bool checkLastFrame(
+    Backend<TBackend>& backend,
+    char const* title,
+    Options const& options
+)
+{
+    if (
+        options.capturePath.empty()
+        && options.comparePath.empty()
+    )
+    {
+        return true;
+    }
+
+    RgbaImage image{};
+    backend.readPixels( image );
+
+    if ( !options.capturePath.empty() )
+    {
+        writePpm( options.capturePath, image );
+    }
+
+    if ( options.comparePath.empty() )
+    {
+        return true;
+    }
+
+    RgbaImage reference{};
+
+    if ( !readPpm( options.comparePath, reference ) )
+    {
+        return false;
+    }
+
+    ImageDifference difference{ compareImages( image, reference ) };
+
+    std::cout << "[INFO] " << title << ": " << difference.differentPixels << " pixels differ from "
+              << options.comparePath << " (max channel difference " << difference.maxChannelDifference << ")\n";
+
+    return difference.maxChannelDifference <= options.tolerance;
+}
+
+//* Per frame data, prepared on the main thread ("simulation") and consumed by the renderer
+struct FramePacket
+{
+    int frame{};
+
+    //* px, py, r, g, b per vertex
+    std::array<float, 15> vertices{};
+
+    //* Buffer the vertices go to, resolved with the packet (0 while the buffer is not ready)
+    unsigned int vbo{};
+
+    //* Draws, sorted and recorded off the context thread
+    //* Commands live in the frame arena, valid until the packet's frame comes around again
+    DrawQueue drawQueue{};
+    CommandBuffer commands{ COMMAND_BLOCK_SIZE };
+
+    //* Main thread phases, milliseconds
+    float inputMs{};
+    float updateMs{};
+};
+
+//* Objects created once by `runWorkload()`
+struct WorkloadScene
+{
+    ProgramHandle shaderProgram{};
+    VertexArrayHandle vao{};
+    BufferHandle vbo{};
+};
+
+//* Everything the renderer keeps across frames, owned by the thread that presents
+struct FrameTiming
+{
+    FrameStats frameStats;
+    FramePacer pacer;
+    std::string frameStatsPath{};
+
+    //* Frames that allocated after the allocation guard's warm up
+    int64_t allocatingFrames{};
+};
+
+//* Off the context thread with a render thread: only looks up handles (`resolve()`)
+template <typename TBackend>
+void updateFrame(
+    Backend<TBackend> const& backend,
+    FramePacket& packet,
+    WorkloadScene const& scene,
+    FrameArena& arena,
+    Options const& options
+)
+{
+    //* The packet's previous use of this region is done (the pipeline released it)
+    arena.beginFrame( packet.frame );
+
+    //* Nothing is animated yet
+    //* A triangle in normalized device coordinates
+    // clang-format off
+    packet.vertices = {
+        // px, py, r, g, b
+        -0.5f, -0.5f,  +1.0f, +0.0f, +0.0f,
+        +0.5f, -0.5f,  +0.0f, +1.0f, +0.0f,
+        +0.0f, +0.5f,  +0.0f, +0.0f, +1.0f
+    };
+    // clang-format on
+
+    packet.vbo = backend.resolve( scene.vbo );
+
+    //* Draws are queued with their sort key, the recorded commands
+    //* - activate the shader
+    //* - bind the VAO to use
+    //* - draw
+    unsigned int const program{ backend.resolve( scene.shaderProgram ) };
+    unsigned int const vao{ backend.resolve( scene.vao ) };
+
+    packet.drawQueue.reset();
+    packet.drawQueue.submit(
+        DrawKey::make( 0, false, program, vao, 0.0f ),
+        { program, vao, options.primitive, 0, 3 }
+    );
+    packet.drawQueue.sort();
+
+    packet.commands.setArena( &arena );
+    packet.commands.reset();
+    packet.drawQueue.record( packet.commands );
+}
+
+//* Called by the presenting thread after each frame, counting starts once the warm up frames are done
+inline void checkFrameAllocations(
+    int frame,
+    FrameTiming& timing,
+    Options const& options
+)
+{
+    if ( AllocationGuard::takeFrameCount() )
+    {
+        ++timing.allocatingFrames;
+    }
+
+    if ( frame + 1 == options.allocationGuardFrames )
+    {
+        AllocationGuard::setEnabled( true );
+    }
+}
+
+//* Returns false if anything was allocated after the warm up
+inline bool printAllocationStats(
+    FrameTiming const& timing,
+    char const* title
+)
+{
+    std::vector<AllocationGuard::ScopeCount> const scopes{ AllocationGuard::scopeCounts() };
+
+    if ( scopes.empty() )
+    {
+        std::cout << "[INFO] " << title << ": no allocations after warm up\n";
+        return true;
+    }
+
+    Log::error( "{}: allocations in {} frames after warm up", title, timing.allocatingFrames );
+
+    for ( AllocationGuard::ScopeCount const& scope : scopes )
+    {
+        Log::error( "{}:   {}: {} ({} bytes)", title, scope.name, scope.count, scope.bytes );
+    }
+
+    return false;
+}
+
+//* Draw and present a packet, returns false if `checkLastFrame()` fails
+//* Frame statistics continue with the submit phase (`beginFrame()` and input/update are up to the caller)
+template <typename TBackend>
+bool renderFrame(
+    Backend<TBackend>& backend,
+    FramePacket const& packet,
+    FrameTiming& timing,
+    char const* title,
+    Options const& options
+)
+{
+    bool result{ true };
+    AllocationScope const allocationScope{ "render" };
+
+    {
+        PROFILE_ZONE( "begin frame" );
+        backend.beginFrame();
+    }
+
+    //* Input that arrives while the frame is set up still makes it into this frame
+    //* (counted as submit time, only without render thread: events are polled on the main thread)
+    if (
+        options.lateInput
+        && !options.renderThread
+    )
+    {
+        PROFILE_ZONE( "input" );
+        backend.pollInput();
+    }
+
+    {
+        PROFILE_ZONE( "upload" );
+        backend.updateVertexBuffer(
+            packet.vbo,
+            packet.vertices.data(),
+            sizeof( packet.vertices ),
+            0
+        );
+    }
+
+    {
+        PROFILE_ZONE( "draw" );
+        backend.executeCommands( packet.commands );
+    }
+
+    if ( Profiler::isEnabled() )
+    {
+        AllocationScope const overlayAllocationScope{ "profiler" };
+        backend.drawOverlayText( Profiler::summary().c_str() );
+    }
+
+    if ( packet.frame == options.frames - 1 )
+    {
+        //* Capture/compare is not part of the render loop
+        bool const isCountingAllocations{ AllocationGuard::isEnabled() };
+        AllocationGuard::setEnabled( false );
+
+        result = checkLastFrame( backend, title, options );
+
+        AllocationGuard::setEnabled( isCountingAllocations );
+    }
+
+    timing.frameStats.endPhase( FramePhase::SUBMIT );
+    timing.pacer.endWork();
+
+    {
+        PROFILE_ZONE( "end frame" );
+        backend.endFrame();
+    }
+
+    timing.pacer.endFrame();
+
+    timing.frameStats.endPhase( FramePhase::SWAP );
+    timing.frameStats.endFrame();
+    Profiler::endFrame();
+
+    if ( options.allocationGuardFrames >= 0 )
+    {
+        checkFrameAllocations( packet.frame, timing, options );
+    }
+
+    if (
+        Signals::consumeDumpRequest()
+        && !timing.frameStatsPath.empty()
+    )
+    {
+        timing.frameStats.write( timing.frameStatsPath );
+    }
+
+    return result;
+}
+
+//* Whether the main thread goes on with another frame
+template <typename TBackend>
+bool isRunning(
+    Backend<TBackend>& backend,
+    int frame,
+    Options const& options
+)
+{
+    return !backend.shouldClose()
+           && !Signals::isQuitRequested()
+           && ( options.frames == 0 || frame < options.frames );
+}
+
+//* Input, update and render in sequence on the calling thread, returns the frame count
+template <typename TBackend>
+int runFrames(
+    Backend<TBackend>& backend,
+    WorkloadScene const& scene,
+    FrameArena& arena,
+    FrameTiming& timing,
+    int& result,
+    char const* title,
+    Options const& options
+)
+{
+    int frame{ 0 };
+    FramePacket packet{};
+
+    while ( isRunning( backend, frame, options ) )
+    {
+        timing.pacer.waitForFrame();
+
+        Profiler::beginFrame();
+        timing.frameStats.beginFrame();
+
+        if ( !options.lateInput )
+        {
+            PROFILE_ZONE( "input" );
+            AllocationScope const allocationScope{ "input" };
+            backend.pollInput();
+        }
+
+        timing.frameStats.endPhase( FramePhase::INPUT );
+
+        {
+            PROFILE_ZONE( "update" );
+            AllocationScope const allocationScope{ "update" };
+            packet.frame = frame;
+            updateFrame( backend, packet, scene, arena, options );
+        }
+
+        timing.frameStats.endPhase( FramePhase::UPDATE );
+
+        if ( !renderFrame( backend, packet, timing, title, options ) )
+        {
+            result = 1;
+        }
+
+        ++frame;
+    }
+
+    return frame;
+}
+
+//* The main thread polls input and prepares packets up to `framesInFlight` frames ahead,
+//* a render thread owns the context and draws/presents them, returns the frame count
+//* Pacing and frame statistics run on the render thread.
+template <typename TBackend>
+int runFramesPipelined(
+    Backend<TBackend>& backend,
+    WorkloadScene const& scene,
+    FrameArena& arena,
+    FrameTiming& timing,
+    int& result,
+    char const* title,
+    Options const& options
+)
+{
+    FramePipeline<FramePacket> pipeline{ options.framesInFlight };
+    bool renderResult{ true };
+
+    backend.setContextCurrent( false );
+
+    std::thread renderThread{
+        [&]()
+        {
+            Profiler::setThreadName( "render" );
+            backend.setContextCurrent( true );
+
+            while ( FramePacket const* packet{ pipeline.consume() } )
+            {
+                timing.pacer.waitForFrame();
+
+                Profiler::beginFrame();
+                timing.frameStats.beginFrame();
+                timing.frameStats.addPhase( FramePhase::INPUT, packet->inputMs );
+                timing.frameStats.addPhase( FramePhase::UPDATE, packet->updateMs );
+
+                renderResult &= renderFrame( backend, *packet, timing, title, options );
+
+                pipeline.release();
+            }
+
+            backend.setContextCurrent( false );
+        }
+    };
+
+    int frame{ 0 };
+
+    while ( isRunning( backend, frame, options ) )
+    {
+        FramePacket& packet{ pipeline.acquire() };
+
+        int64_t const start{ Profiler::now() };
+
+        {
+            PROFILE_ZONE( "input" );
+            AllocationScope const allocationScope{ "input" };
+            backend.pollInput();
+        }
+
+        int64_t const inputEnd{ Profiler::now() };
+
+        {
+            PROFILE_ZONE( "update" );
+            AllocationScope const allocationScope{ "update" };
+            packet.frame = frame;
+            updateFrame( backend, packet, scene, arena, options );
+        }
+
+        packet.inputMs = static_cast<float>( inputEnd - start ) * 1e-6f;
+        packet.updateMs = static_cast<float>( Profiler::now() - inputEnd ) * 1e-6f;
+
+        pipeline.submit();
+        ++frame;
+    }
+
+    pipeline.close();
+    renderThread.join();
+
+    backend.setContextCurrent( true );
+
+    if ( !renderResult )
+    {
+        result = 1;
+    }
+
+    return frame;
+}
+
+//* Render loop, instantiated once per backend so every call below is resolved at compile time
+template <typename TBackend>
+int runWorkload(
+    Backend<TBackend>& backend,
+    char const* title,
+    Options const& options
+)
+{
+    if ( Profiler::isEnabled() )
+    {
+        Profiler::beginSession( title );
+    }
+
+    //* Initialize window and OpenGL context
+    if ( !backend.init( WINDOW_WIDTH, WINDOW_HEIGHT, title ) )
+    {
+        return 1;
+    }
+
+    backend.setVsync( options.vsync );
+
+    WorkloadScene scene{};
+
+    //* ShaderProgram (Load source, compile source, link program, compile program)
+    {
+        PROFILE_ZONE( "load shader" );
+        scene.shaderProgram = backend.loadShaderProgram(
+            vertexShaderPath,
+            fragmentShaderPath
+        );
+    }
+
+    bool const isPipelined{
+        options.renderThread
+        && backend.supportsRenderThread()
+    };
+
+    //* Packets `framesInFlight` frames apart share a region
+    FrameArena arena{
+        isPipelined ? options.framesInFlight : 1,
+        FRAME_ARENA_SIZE
+    };
+
+    //* Data, filled every frame by `updateFrame()`
+    FramePacket firstPacket{};
+    updateFrame( backend, firstPacket, scene, arena, options );
+
+    int const stride = 5 * sizeof( float );
+
+    //* VAO first, so the following vertex attributes are stored inside it
+    scene.vao = backend.loadVertexArray();
+    backend.enableVertexArray( scene.vao );
+
+    {
+        PROFILE_ZONE( "upload" );
+        scene.vbo = backend.loadVertexBuffer(
+            firstPacket.vertices.data(),
+            sizeof( firstPacket.vertices ),
+            true
+        );
+    }
+
+    //* Position
+    backend.setVertexAttribute( { 0, 2, stride, 0 * sizeof( float ) } );
+
+    //* Color
+    backend.setVertexAttribute( { 1, 3, stride, 2 * sizeof( float ) } );
+
+    backend.disableVertexArray();
+
+    //* Render loop
+    int result{ 0 };
+    FrameTiming timing{
+        FrameStats{ FRAME_STATS_CAPACITY },
+        FramePacer{
+            pacingTargetHz( backend, title, options ),
+            options.justInTime,
+            FRAME_STATS_CAPACITY
+        },
+        options.frameStatsPath.empty() ? "" : outputPathFor( options.frameStatsPath, title, options )
+    };
+
+    if (
+        options.renderThread
+        && !isPipelined
+    )
+    {
+        std::cout << "[INFO] " << title << ": no render thread support, rendering on the main thread\n";
+    }
+
+    backend.setFramesInFlight( isPipelined ? options.framesInFlight : 0 );
+
+    AllocationGuard::resetCounts();
+    AllocationGuard::setEnabled( options.allocationGuardFrames == 0 );
+
+    auto start{ std::chrono::steady_clock::now() };
+
+    int const frame{
+        isPipelined
+            ? runFramesPipelined( backend, scene, arena, timing, result, title, options )
+            : runFrames( backend, scene, arena, timing, result, title, options )
+    };
+
+    std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+
+    //* Reporting below allocates
+    AllocationGuard::setEnabled( false );
+
+    //* Messages of the run before its summary
+    Log::flush();
+
+    std::cout << "[INFO] " << title << ": " << frame << " frames in " << elapsed.count() << " ms ("
+              << ( frame ? elapsed.count() / frame : 0.0 ) << " ms/frame)\n";
+
+    printFrameStats( timing.frameStats, title );
+    printPacingStats( timing.pacer, title );
+    printArenaStats( arena, title );
+
+    if (
+        options.allocationGuardFrames >= 0
+        && !printAllocationStats( timing, title )
+    )
+    {
+        result = 1;
+    }
+
+    if (
+        !timing.frameStatsPath.empty()
+        && !timing.frameStats.write( timing.frameStatsPath )
+    )
+    {
+        result = 1;
+    }
+
+    //* Close: free all resources
+    backend.unloadVertexArray( scene.vao );
+    backend.unloadVertexBuffer( scene.vbo );
+    backend.unloadShaderProgram( scene.shaderProgram );
+
+    backend.deinit();
+
+    return result;
+}
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef IG20261019101500
+#define IG20261019101500
+
+#include "HandlePool.h"
+#include "RgbaImage.h"
+
+class CommandBuffer;
+
+//* Backend interface shared by all rendering backends
+//* Dispatch is static (CRTP): the render loop is instantiated once per backend,
+//* so no virtual call is paid per draw.
+//* Derived backends implement the `...Impl()` functions.
+//* Resources are handed out as generational handles, the `...Impl()` functions see the backend's ids (GL names).
+//* Unloading invalidates the handle at once, backends may delete the object later (once the GPU is done with it).
+
+enum class Primitive
+{
+    TRIANGLES,
+    POINTS,
+};
+
+enum class VsyncMode
+{
+    //* Whatever the platform/driver picks
+    DEFAULT,
+    OFF,
+    ON,
+    //* Sync when on time, tear instead of waiting a whole refresh when late (falls back to ON)
+    ADAPTIVE,
+};
+
+//* Typed handles of backend resources, see HandlePool.h
+using ProgramHandle = Handle<struct ProgramTag>;
+using VertexArrayHandle = Handle<struct VertexArrayTag>;
+using BufferHandle = Handle<struct BufferTag>;
+
+//* Describes one vertex shader input ("layout (location = index)")
+//* inside an interleaved float vertex buffer
+struct VertexAttribute
+{
+    unsigned int index{};
+    int componentCount{};
+    int stride{};
+    int offset{};
+};
+
+template <typename TDerived>
+class Backend
+{
+public:
+    //* Create window and context
+    bool init(
+        int width,
+        int height,
+        char const* title
+    )
+    {
+        return derived().initImpl( width, height, title );
+    }
+
+    void deinit() { derived().deinitImpl(); }
+
+    bool shouldClose() { return derived().shouldCloseImpl(); }
+
+    //* Swap interval, call after `init()`
+    void setVsync( VsyncMode mode ) { derived().setVsyncImpl( mode ); }
+
+    //* Of the monitor the window is on, 0 if unknown or there is no display
+    int refreshRate() { return derived().refreshRateImpl(); }
+
+    //* Whether drawing may move to another thread while window and input stay on the main thread
+    bool supportsRenderThread() { return derived().supportsRenderThreadImpl(); }
+
+    //* Bind/unbind the context on the calling thread, a context is current on at most one thread
+    void setContextCurrent( bool isCurrent ) { derived().setContextCurrentImpl( isCurrent ); }
+
+    //* Frames input may be polled ahead of the frame being presented (the render thread's pipeline depth),
+    //* call before the render loop
+    void setFramesInFlight( int count ) { derived().setFramesInFlightImpl( count ); }
+
+    //* Input events, once per frame before `beginFrame()`
+    void pollInput() { derived().pollInputImpl(); }
+
+    //* Frame
+    void beginFrame() { derived().beginFrameImpl(); }
+    void endFrame() { derived().endFrameImpl(); }
+
+    //* Shader program
+    ProgramHandle loadShaderProgram(
+        char const* vertexShaderPath,
+        char const* fragmentShaderPath
+    )
+    {
+        return programs_.create( derived().loadShaderProgramImpl( vertexShaderPath, fragmentShaderPath ) );
+    }
+
+    void unloadShaderProgram( ProgramHandle program )
+    {
+        if ( unsigned int const* id{ programs_.get( program ) } )
+        {
+            derived().unloadShaderProgramImpl( *id );
+            programs_.destroy( program );
+        }
+    }
+
+    void enableShaderProgram( ProgramHandle program ) { derived().enableShaderProgramImpl( resolve( program ) ); }
+
+    //* VAO
+    VertexArrayHandle loadVertexArray() { return vertexArrays_.create( derived().loadVertexArrayImpl() ); }
+
+    void unloadVertexArray( VertexArrayHandle vao )
+    {
+        if ( unsigned int const* id{ vertexArrays_.get( vao ) } )
+        {
+            derived().unloadVertexArrayImpl( *id );
+            vertexArrays_.destroy( vao );
+        }
+    }
+
+    void enableVertexArray( VertexArrayHandle vao ) { derived().enableVertexArrayImpl( resolve( vao ) ); }
+    void disableVertexArray() { derived().disableVertexArrayImpl(); }
+
+    //* VBO
+    BufferHandle loadVertexBuffer(
+        void const* data,
+        int size,
+        bool dynamic
+    )
+    {
+        return buffers_.create( derived().loadVertexBufferImpl( data, size, dynamic ) );
+    }
+
+    //* Upload on a background thread where the backend can (see GlUploader), else right away
+    //* The handle resolves to 0 until the buffer is ready (published by a later `pollInput()`),
+    //* `data` has to stay valid until then. Call on the main thread.
+    BufferHandle loadVertexBufferAsync(
+        void const* data,
+        int size
+    )
+    {
+        BufferHandle const handle{ buffers_.create( 0 ) };
+        derived().loadVertexBufferAsyncImpl( handle, data, size );
+
+        return handle;
+    }
+
+    bool isReady( BufferHandle vbo ) const { return resolve( vbo ) != 0; }
+
+    void unloadVertexBuffer( BufferHandle vbo )
+    {
+        if ( unsigned int const* id{ buffers_.get( vbo ) } )
+        {
+            //* Uploads still in flight are deleted by `completeUpload()`
+            if ( *id )
+            {
+                derived().unloadVertexBufferImpl( *id );
+            }
+
+            buffers_.destroy( vbo );
+        }
+    }
+
+    //* Overwrite `size` bytes at `offset`, the buffer keeps its size
+    void updateVertexBuffer(
+        BufferHandle vbo,
+        void const* data,
+        int size,
+        int offset
+    )
+    {
+        updateVertexBuffer( resolve( vbo ), data, size, offset );
+    }
+
+    //* By id resolved earlier (eg. on the main thread, for a render thread), 0 (not ready) is skipped
+    void updateVertexBuffer(
+        unsigned int vbo,
+        void const* data,
+        int size,
+        int offset
+    )
+    {
+        if ( vbo )
+        {
+            derived().updateVertexBufferImpl( vbo, data, size, offset );
+        }
+    }
+
+    //* Backend id of a live handle, 0 for stale ones (recorded commands and sort keys use ids)
+    unsigned int resolve( ProgramHandle program ) const { return valueOr( programs_.get( program ) ); }
+    unsigned int resolve( VertexArrayHandle vao ) const { return valueOr( vertexArrays_.get( vao ) ); }
+    unsigned int resolve( BufferHandle vbo ) const { return valueOr( buffers_.get( vbo ) ); }
+
+    //* Vertex layout, stored in the currently enabled VAO
+    void setVertexAttribute( VertexAttribute const& attribute ) { derived().setVertexAttributeImpl( attribute ); }
+
+    //* Draw
+    void draw(
+        Primitive primitive,
+        int first,
+        int count
+    )
+    {
+        derived().drawImpl( primitive, first, count );
+    }
+
+    //* Replay recorded commands, in order (context thread only)
+    void executeCommands( CommandBuffer const& commands ) { derived().executeCommandsImpl( commands ); }
+
+    //* Read back the current frame, call before `endFrame()`
+    void readPixels( RgbaImage& image ) { derived().readPixelsImpl( image ); }
+
+    //* Show text (eg. the profiler summary) for the current frame, call before `endFrame()`
+    //* Backends without text rendering show it elsewhere (window title, stdout)
+    void drawOverlayText( char const* text ) { derived().drawOverlayTextImpl( text ); }
+
+protected:
+    //* Publish a finished `loadVertexBufferAsync()`, the buffer is deleted if the handle was unloaded meanwhile
+    void completeUpload(
+        BufferHandle handle,
+        unsigned int id
+    )
+    {
+        if ( unsigned int* value{ buffers_.get( handle ) } )
+        {
+            *value = id;
+            return;
+        }
+
+        derived().unloadVertexBufferImpl( id );
+    }
+
+private:
+    TDerived& derived() { return static_cast<TDerived&>( *this ); }
+
+    static unsigned int valueOr( unsigned int const* id ) { return id ? *id : 0; }
+
+    HandlePool<ProgramHandle, unsigned int> programs_{};
+    HandlePool<VertexArrayHandle, unsigned int> vertexArrays_{};
+    HandlePool<BufferHandle, unsigned int> buffers_{};
+};
+
+#endif
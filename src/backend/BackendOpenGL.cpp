@@ -0,0 +1,781 @@
+#include "BackendOpenGL.h"
+
+#include "Backend.h"
+#include "CommandBuffer.h"
+#include "File.h"
+#include "FrameStats.h"
+#include "GlCommands.h"
+#include "GpuProfiler.h"
+#include "InputLatency.h"
+#include "Log.h"
+#include "PresentTimer.h"
+#include "Profiler.h"
+#include "RgbaImage.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "GladContext.h"
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+//* Sync viewport to window
+static void updateViewport(
+    [[maybe_unused]] GLFWwindow* window,
+    int width,
+    int height
+)
+{
+    glViewport(
+        0,     // left
+        0,     // bottom
+        width, // right
+        height // top
+    );
+}
+
+//* Input callbacks run inside `glfwPollEvents()`, timestamps are taken on dispatch
+//* (GLFW does not expose the OS event time)
+static InputLatency& inputLatencyOf( GLFWwindow* window )
+{
+    return static_cast<BackendOpenGL*>( glfwGetWindowUserPointer( window ) )->inputLatency();
+}
+
+static void onKey(
+    GLFWwindow* window,
+    int key,
+    [[maybe_unused]] int scancode,
+    int action,
+    [[maybe_unused]] int mods
+)
+{
+    inputLatencyOf( window ).onInput( Profiler::now() );
+
+    if (
+        key == GLFW_KEY_ESCAPE
+        && action == GLFW_PRESS
+    )
+    {
+        glfwSetWindowShouldClose(
+            window,
+            true
+        );
+    }
+}
+
+static void onMouseButton(
+    GLFWwindow* window,
+    [[maybe_unused]] int button,
+    [[maybe_unused]] int action,
+    [[maybe_unused]] int mods
+)
+{
+    inputLatencyOf( window ).onInput( Profiler::now() );
+}
+
+static void onCursorPos(
+    GLFWwindow* window,
+    [[maybe_unused]] double x,
+    [[maybe_unused]] double y
+)
+{
+    inputLatencyOf( window ).onInput( Profiler::now() );
+}
+
+//* KHR_debug messages go to the log (may be called on a driver thread)
+static void GLAPIENTRY onDebugMessage(
+    [[maybe_unused]] GLenum source,
+    [[maybe_unused]] GLenum type,
+    GLuint id,
+    GLenum severity,
+    GLsizei length,
+    GLchar const* message,
+    [[maybe_unused]] void const* userParam
+)
+{
+    std::string_view const text{
+        message,
+        length < 0 ? std::strlen( message ) : static_cast<size_t>( length )
+    };
+
+    switch ( severity )
+    {
+        case GL_DEBUG_SEVERITY_HIGH:
+            Log::error( "OpenGL {}: {}", id, text );
+            break;
+        case GL_DEBUG_SEVERITY_MEDIUM:
+            Log::warning( "OpenGL {}: {}", id, text );
+            break;
+        case GL_DEBUG_SEVERITY_LOW:
+            Log::info( "OpenGL {}: {}", id, text );
+            break;
+        default:
+            Log::trace( "OpenGL {}: {}", id, text );
+            break;
+    }
+}
+
+static GLuint compileShader(
+    GLenum type,
+    char const* path
+)
+{
+    GLuint shader = glCreateShader( type );
+
+    //* Load shader source code
+    std::string shaderSource{ readFile( path ) };
+    char const* shaderCode{ shaderSource.c_str() };
+
+    glShaderSource(
+        shader,
+        1,
+        &shaderCode,
+        NULL
+    );
+
+    //* Compile shader
+    glCompileShader( shader );
+
+    //* Error handling for shader compilation
+    int success;
+    char infoLog[512];
+
+    glGetShaderiv( shader, GL_COMPILE_STATUS, &success );
+    if ( !success )
+    {
+        glGetShaderInfoLog( shader, 512, NULL, infoLog );
+        Log::error( "Shader compilation failed ({})\n{}", path, infoLog );
+    }
+
+    return shader;
+}
+
+bool BackendOpenGL::initImpl(
+    int width,
+    int height,
+    char const* title
+)
+{
+    title_ = title;
+
+    //* GLFW: Init and configure
+    glfwInit();
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 3 );
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 3 );
+    glfwWindowHint( GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE );
+    glfwWindowHint( GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE );
+
+#if defined( DEBUG )
+    glfwWindowHint( GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE );
+#endif
+
+    //* GLFW: Create window
+    window_ = glfwCreateWindow( width, height, title, NULL, NULL );
+
+    if ( !window_ )
+    {
+        Log::error( "Window creation failed!" );
+        glfwTerminate();
+        return false;
+    }
+
+    glfwMakeContextCurrent( window_ );
+    GladContext::makeCurrent( &gl_ );
+
+    //* Callbacks
+    glfwSetWindowUserPointer( window_, this );
+
+    glfwSetFramebufferSizeCallback(
+        window_,
+        updateViewport
+    );
+
+    glfwSetKeyCallback( window_, onKey );
+    glfwSetMouseButtonCallback( window_, onMouseButton );
+    glfwSetCursorPosCallback( window_, onCursorPos );
+
+    //* GLAD: Load OpenGL function pointers
+    //* Into this context's own table, the global `glad_gl*` pointers belong to raylib (linked into the same binary)
+    if ( !GladContext::load( gl_, reinterpret_cast<GLADloadproc>( glfwGetProcAddress ) ) || !glCreateShader )
+    {
+        Log::error( "GLAD initialization failed!" );
+        GladContext::makeCurrent( nullptr );
+        glfwDestroyWindow( window_ );
+        glfwTerminate();
+        return false;
+    }
+
+    //* Driver messages (GL 4.3 or KHR_debug), notifications only if trace messages are compiled in
+    if ( glad_glDebugMessageCallback )
+    {
+        glEnable( GL_DEBUG_OUTPUT );
+        glDebugMessageCallback( onDebugMessage, nullptr );
+        glDebugMessageControl(
+            GL_DONT_CARE,
+            GL_DONT_CARE,
+            GL_DEBUG_SEVERITY_NOTIFICATION,
+            0,
+            nullptr,
+            Log::MIN_LEVEL == LogLevel::TRACE
+        );
+    }
+
+    isDsa_ = gl_.isVersion( 4, 5 );
+    Log::info( "OpenGL {}.{}, {} resource setup", gl_.majorVersion, gl_.minorVersion, isDsa_ ? "DSA" : "bind-to-edit" );
+
+    //* Let the vertex shader set `gl_PointSize` when drawing as points
+    glEnable( GL_PROGRAM_POINT_SIZE );
+
+    gpuProfiler_.init();
+    presentTimer_.init();
+
+    //* Hidden window for the upload context, shares objects with the main one
+    glfwWindowHint( GLFW_VISIBLE, GLFW_FALSE );
+    uploadWindow_ = glfwCreateWindow( 1, 1, "upload", NULL, window_ );
+    glfwWindowHint( GLFW_VISIBLE, GLFW_TRUE );
+
+    if ( uploadWindow_ )
+    {
+        uploader_.start(
+            [this]( bool isCurrent )
+            {
+                glfwMakeContextCurrent( isCurrent ? uploadWindow_ : nullptr );
+
+                //* Loaded on the upload thread, where its context is current
+                if ( isCurrent && !uploadGl_.isLoaded() )
+                {
+                    GladContext::load( uploadGl_, reinterpret_cast<GLADloadproc>( glfwGetProcAddress ) );
+                }
+
+                GladContext::makeCurrent( isCurrent ? &uploadGl_ : nullptr );
+            }
+        );
+    }
+    else
+    {
+        Log::warning( "No upload context, buffers are uploaded on the render thread" );
+    }
+
+    return true;
+}
+
+void BackendOpenGL::deinitImpl()
+{
+    FramePhaseSummary const latency{ inputLatency_.summarize() };
+
+    if ( latency.count )
+    {
+        std::cout << "[INFO] " << title_ << ": input-to-present p50 " << latency.p50 << " ms, p95 " << latency.p95
+                  << " ms, p99 " << latency.p99 << " ms, max " << latency.max << " ms (" << latency.count << " frames with input)\n";
+    }
+
+    uploader_.stop();
+
+    if ( uploadWindow_ )
+    {
+        glfwDestroyWindow( uploadWindow_ );
+        uploadWindow_ = nullptr;
+    }
+
+    deletionQueue_.finish(
+        [this]( GlDeletionQueue::Entry const& entry )
+        {
+            deleteResource( entry );
+        }
+    );
+
+    presentTimer_.deinit();
+    gpuProfiler_.deinit();
+
+    GladContext::makeCurrent( nullptr );
+    glfwDestroyWindow( window_ );
+    glfwTerminate();
+    window_ = nullptr;
+}
+
+bool BackendOpenGL::shouldCloseImpl()
+{
+    return glfwWindowShouldClose( window_ );
+}
+
+void BackendOpenGL::setVsyncImpl( VsyncMode mode )
+{
+    switch ( mode )
+    {
+        case VsyncMode::DEFAULT:
+            break;
+
+        case VsyncMode::OFF:
+            glfwSwapInterval( 0 );
+            break;
+
+        case VsyncMode::ON:
+            glfwSwapInterval( 1 );
+            break;
+
+        case VsyncMode::ADAPTIVE:
+        {
+            //* Negative intervals need the swap_control_tear extensions
+            bool const isSupported{
+                glfwExtensionSupported( "WGL_EXT_swap_control_tear" )
+                || glfwExtensionSupported( "GLX_EXT_swap_control_tear" )
+            };
+
+            if ( !isSupported )
+            {
+                std::cout << "[INFO] Adaptive vsync not supported, using vsync\n";
+            }
+
+            glfwSwapInterval( isSupported ? -1 : 1 );
+            break;
+        }
+    }
+}
+
+int BackendOpenGL::refreshRateImpl()
+{
+    //* Windowed mode has no monitor of its own
+    GLFWmonitor* monitor{ glfwGetWindowMonitor( window_ ) };
+
+    if ( !monitor )
+    {
+        monitor = glfwGetPrimaryMonitor();
+    }
+
+    GLFWvidmode const* mode{ monitor ? glfwGetVideoMode( monitor ) : nullptr };
+
+    return mode ? mode->refreshRate : 0;
+}
+
+//* GLFW allows making a context current on any thread,
+//* only window creation and event processing have to stay on the main thread
+bool BackendOpenGL::supportsRenderThreadImpl()
+{
+    return true;
+}
+
+void BackendOpenGL::setContextCurrentImpl( bool isCurrent )
+{
+    glfwMakeContextCurrent( isCurrent ? window_ : nullptr );
+    GladContext::makeCurrent( isCurrent ? &gl_ : nullptr );
+}
+
+//* A tagged frame waits for its present time, read up to PresentTimer::FRAMES_IN_FLIGHT frames after its swap
+void BackendOpenGL::setFramesInFlightImpl( int count )
+{
+    inputLatency_.setMaxPendingFrames( count + PresentTimer::FRAMES_IN_FLIGHT + 1 );
+}
+
+void BackendOpenGL::pollInputImpl()
+{
+    glfwPollEvents();
+
+    {
+        std::lock_guard<std::mutex> lock( windowTitleMutex_ );
+
+        if ( isWindowTitlePending_ )
+        {
+            glfwSetWindowTitle( window_, windowTitle_.c_str() );
+            isWindowTitlePending_ = false;
+        }
+    }
+    inputLatency_.tagFrame( inputFrame_ );
+    ++inputFrame_;
+
+    //* Handles belong to the main thread
+    uploader_.collect(
+        [this]( GlUploader::Upload const& upload )
+        {
+            completeUpload( upload.handle, upload.buffer );
+        }
+    );
+}
+
+void BackendOpenGL::beginFrameImpl()
+{
+    deletionQueue_.collect(
+        [this]( GlDeletionQueue::Entry const& entry )
+        {
+            deleteResource( entry );
+        }
+    );
+
+    gpuProfiler_.beginFrame();
+    PROFILE_GPU_ZONE( gpuProfiler_, "clear" );
+
+    //* Set clearing color and clear/reset window
+    glClearColor(
+        0.0f,
+        0.0f,
+        0.0f,
+        1.0f
+    );
+    glClear( GL_COLOR_BUFFER_BIT );
+}
+
+void BackendOpenGL::endFrameImpl()
+{
+    gpuProfiler_.endFrame();
+    deletionQueue_.endFrame();
+
+    //* GLFW: Swap main buffers
+    {
+        PROFILE_ZONE( "swap" );
+        glfwSwapBuffers( window_ );
+    }
+
+    presentTimer_.afterSwap( presentFrame_, inputLatency_ );
+    ++presentFrame_;
+}
+
+//* ShaderProgram (Load source, compile source, link program, compile program)
+unsigned int BackendOpenGL::loadShaderProgramImpl(
+    char const* vertexShaderPath,
+    char const* fragmentShaderPath
+)
+{
+    GLuint vertexShader = compileShader( GL_VERTEX_SHADER, vertexShaderPath );
+    GLuint fragmentShader = compileShader( GL_FRAGMENT_SHADER, fragmentShaderPath );
+
+    //* Shader program
+    GLuint shaderProgram = glCreateProgram();
+    glAttachShader(
+        shaderProgram,
+        vertexShader
+    );
+    glAttachShader(
+        shaderProgram,
+        fragmentShader
+    );
+
+    glLinkProgram( shaderProgram );
+
+    //* Error handling
+    int success;
+    char infoLog[512];
+
+    glGetProgramiv( shaderProgram, GL_LINK_STATUS, &success );
+    if ( !success )
+    {
+        glGetProgramInfoLog( shaderProgram, 512, NULL, infoLog );
+        Log::error( "Shader program linking failed\n{}", infoLog );
+    }
+
+    //* Delete shaders after linking
+    glDeleteShader( vertexShader );
+    glDeleteShader( fragmentShader );
+
+    return shaderProgram;
+}
+
+void BackendOpenGL::unloadShaderProgramImpl( unsigned int program )
+{
+    deletionQueue_.push( GlResource::PROGRAM, program );
+}
+
+void BackendOpenGL::enableShaderProgramImpl( unsigned int program )
+{
+    glUseProgram( program );
+}
+
+//* VAO (vertex array object):
+//* - how to access VBO
+//* or
+//* - what is the structure of the VBO
+unsigned int BackendOpenGL::loadVertexArrayImpl()
+{
+    GLuint vao; // (unsigned int) reference ID
+
+    //* DSA: the object exists right away (glGen* only reserves the name until the first bind)
+    if ( isDsa_ )
+    {
+        glCreateVertexArrays( 1, &vao );
+
+        return vao;
+    }
+
+    //* Create buffer(s) (aka. data storage) on the GPU
+    //* and store a reference to it
+    glGenVertexArrays(
+        1,
+        &vao
+    );
+
+    return vao;
+}
+
+void BackendOpenGL::unloadVertexArrayImpl( unsigned int vao )
+{
+    deletionQueue_.push( GlResource::VERTEX_ARRAY, vao );
+}
+
+//* Bind VAO
+//* Any subsequent vertex attribute calls from that point on will be stored inside the VAO
+//* A vertex array object stores the following:
+//* - Calls to `glEnableVertexAttribArray` or `glDisableVertexAttribArray`.
+//* - Vertex attribute configurations via `glVertexAttribPointer`.
+//* - Vertex buffer objects associated with vertex attributes by calls to `glVertexAttribPointer`.
+void BackendOpenGL::enableVertexArrayImpl( unsigned int vao )
+{
+    glBindVertexArray( vao );
+    editVertexArray_ = vao;
+}
+
+void BackendOpenGL::disableVertexArrayImpl()
+{
+    glBindVertexArray( 0 );
+    editVertexArray_ = 0;
+}
+
+//* VBO (vertex buffer object): to manage used GPU memory (aka. buffer)
+//* - stores (generated) buffer object names
+//* - to send (large) batches of data
+//* Gen, Bind and Buffer
+unsigned int BackendOpenGL::loadVertexBufferImpl(
+    void const* data,
+    int size,
+    bool dynamic
+)
+{
+    GLuint vbo; // (unsigned int) reference ID
+
+    //* DSA: immutable storage, `updateVertexBuffer()` is allowed on every buffer
+    if ( isDsa_ )
+    {
+        glCreateBuffers( 1, &vbo );
+        glNamedBufferStorage(
+            vbo,
+            size,
+            data,
+            GL_DYNAMIC_STORAGE_BIT
+        );
+
+        editBuffer_ = vbo;
+
+        return vbo;
+    }
+
+    //* Create buffer(s) (aka. data storage) on the GPU
+    //* and store a reference to it
+    glGenBuffers(
+        1, // amount of buffers
+        &vbo
+    );
+
+    //* Bind the VBO to the GL_ARRAY_BUFFER target (like a pointer)
+    //* In other words: the GL_ARRAY_BUFFER now targets/points to the VBO
+    glBindBuffer(
+        GL_ARRAY_BUFFER,
+        vbo
+    );
+
+    //* Copies user-defined data ('vertices' in this case)
+    //* into currently bound buffer.
+    glBufferData(
+        GL_ARRAY_BUFFER,
+        size,
+        data,
+        dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW
+    );
+
+    return vbo;
+}
+
+void BackendOpenGL::loadVertexBufferAsyncImpl(
+    BufferHandle handle,
+    void const* data,
+    int size
+)
+{
+    if ( !uploader_.isRunning() )
+    {
+        completeUpload( handle, loadVertexBufferImpl( data, size, false ) );
+        return;
+    }
+
+    uploader_.uploadBuffer( handle, data, static_cast<size_t>( size ) );
+}
+
+void BackendOpenGL::unloadVertexBufferImpl( unsigned int vbo )
+{
+    deletionQueue_.push( GlResource::BUFFER, vbo );
+}
+
+void BackendOpenGL::updateVertexBufferImpl(
+    unsigned int vbo,
+    void const* data,
+    int size,
+    int offset
+)
+{
+    if ( isDsa_ )
+    {
+        glNamedBufferSubData(
+            vbo,
+            offset,
+            size,
+            data
+        );
+
+        return;
+    }
+
+    glBindBuffer(
+        GL_ARRAY_BUFFER,
+        vbo
+    );
+
+    glBufferSubData(
+        GL_ARRAY_BUFFER,
+        offset,
+        size,
+        data
+    );
+}
+
+//* Bind VAO before here, needed for following functions!
+
+//* Link vertex attributes (vertices/input to vertex shader): they must match the inputs in the vertex shader ["layout (location = X)"]
+//* "When you read the input for the vertex shaders vertex attribute(s),
+//* interpret (periodically) every [stride] bits,
+//* starting from [index]
+//* as [type],
+//* which appears first at [pointer] within the data"
+//* This is stored in the currently bound VAO (if bound)
+void BackendOpenGL::setVertexAttributeImpl( VertexAttribute const& attribute )
+{
+    //* DSA: one buffer binding point per attribute, so `offset` and `stride` mean the same as above
+    if ( isDsa_ )
+    {
+        glVertexArrayVertexBuffer(
+            editVertexArray_,
+            attribute.index, // binding point
+            editBuffer_,
+            attribute.offset,
+            attribute.stride
+        );
+
+        glVertexArrayAttribFormat(
+            editVertexArray_,
+            attribute.index,
+            attribute.componentCount,
+            GL_FLOAT,
+            GL_FALSE,
+            0 // relative to the binding's offset
+        );
+
+        glVertexArrayAttribBinding( editVertexArray_, attribute.index, attribute.index );
+        glEnableVertexArrayAttrib( editVertexArray_, attribute.index );
+
+        return;
+    }
+
+    glVertexAttribPointer(
+        attribute.index, // "layout (location = index)" in vertex shader
+        attribute.componentCount,
+        GL_FLOAT,
+        GL_FALSE,
+        attribute.stride,
+        (void*)( (size_t)attribute.offset )
+    );
+
+    //* Enable the vertex attribute (aka. input data)
+    //* This is also stored in the currently bound VAO (if bound)
+    glEnableVertexAttribArray( attribute.index );
+}
+
+void BackendOpenGL::drawImpl(
+    Primitive primitive,
+    int first,
+    int count
+)
+{
+    PROFILE_GPU_ZONE( gpuProfiler_, "draw" );
+
+    glDrawArrays(
+        ( primitive == Primitive::POINTS ) ? GL_POINTS : GL_TRIANGLES,
+        first,
+        count
+    );
+}
+
+void BackendOpenGL::executeCommandsImpl( CommandBuffer const& commands )
+{
+    PROFILE_GPU_ZONE( gpuProfiler_, "commands" );
+
+    executeGlCommands( commands );
+}
+
+void BackendOpenGL::readPixelsImpl( RgbaImage& image )
+{
+    glfwGetFramebufferSize( window_, &image.width, &image.height );
+
+    size_t const rowSize{ static_cast<size_t>( image.width ) * 4 };
+    std::vector<unsigned char> pixels( rowSize * image.height );
+
+    glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+    glReadPixels(
+        0,
+        0,
+        image.width,
+        image.height,
+        GL_RGBA,
+        GL_UNSIGNED_BYTE,
+        pixels.data()
+    );
+
+    //* OpenGL rows go bottom to top
+    image.pixels.resize( pixels.size() );
+
+    for ( int row{ 0 }; row < image.height; ++row )
+    {
+        std::copy(
+            pixels.begin() + ( image.height - 1 - row ) * rowSize,
+            pixels.begin() + ( image.height - row ) * rowSize,
+            image.pixels.begin() + row * rowSize
+        );
+    }
+}
+
+void BackendOpenGL::drawOverlayTextImpl( char const* text )
+{
+    std::string_view const firstLine{ std::string_view{ text }.substr( 0, std::string_view{ text }.find( '\n' ) ) };
+
+    if ( firstLine == overlayText_ )
+    {
+        return;
+    }
+
+    overlayText_ = firstLine;
+
+    std::lock_guard<std::mutex> lock( windowTitleMutex_ );
+
+    windowTitle_ = overlayText_.empty() ? title_ : title_ + " | " + overlayText_;
+    isWindowTitlePending_ = true;
+}
+
+void BackendOpenGL::deleteResource( GlDeletionQueue::Entry const& entry )
+{
+    switch ( entry.type )
+    {
+        case GlResource::PROGRAM:
+            glDeleteProgram( entry.id );
+            break;
+
+        case GlResource::VERTEX_ARRAY:
+            glDeleteVertexArrays( 1, &entry.id );
+            break;
+
+        case GlResource::BUFFER:
+            glDeleteBuffers( 1, &entry.id );
+            break;
+
+        case GlResource::TEXTURE:
+            glDeleteTextures( 1, &entry.id );
+            break;
+    }
+}
@@ -0,0 +1,144 @@
+#ifndef IG20261019101600
+#define IG20261019101600
+
+#include "Backend.h"
+#include "GladContext.h"
+#include "GlDeletionQueue.h"
+#include "GlUploader.h"
+#include "GpuProfiler.h"
+#include "InputLatency.h"
+#include "PresentTimer.h"
+#include "RgbaImage.h"
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+struct GLFWwindow;
+
+//* Raw OpenGL 3.3 core backend (GLFW window, glad function pointers)
+class BackendOpenGL : public Backend<BackendOpenGL>
+{
+    friend class Backend<BackendOpenGL>;
+
+    GLFWwindow* window_{ nullptr };
+
+    //* Function pointers of the window's context, current on whichever thread holds the context
+    GladGLContext gl_{};
+
+    //* Direct state access (GL 4.5), chosen at init when the context has it:
+    //* objects are created and edited by name instead of being bound first.
+    //* The VAO and buffer that `setVertexAttribute()` edits are tracked here then (last enabled/loaded),
+    //* where the bind path uses the GL bindings.
+    bool isDsa_{};
+    unsigned int editVertexArray_{};
+    unsigned int editBuffer_{};
+
+    std::string title_{};
+    std::string overlayText_{};
+
+    //* Window functions are main thread only: the overlay (drawn on the render thread) is
+    //* shown in the window title by the next `pollInput()`
+    std::mutex windowTitleMutex_{};
+    std::string windowTitle_{};
+    bool isWindowTitlePending_{};
+
+    GpuProfiler gpuProfiler_{};
+
+    //* Unloaded objects, deleted once the frames using them are done
+    GlDeletionQueue deletionQueue_{};
+
+    //* `loadVertexBufferAsync()` runs on the uploader's thread, in the hidden window's (shared) context
+    GlUploader uploader_{};
+    GLFWwindow* uploadWindow_{ nullptr };
+    GladGLContext uploadGl_{};
+
+    //* Input is timestamped in GLFW callbacks, frames are tagged in `pollInput()`
+    InputLatency inputLatency_{ INPUT_LATENCY_CAPACITY, PresentTimer::FRAMES_IN_FLIGHT + 1 };
+    PresentTimer presentTimer_{};
+
+    //* Counted separately, polling and presenting may be on different threads
+    int64_t inputFrame_{};
+    int64_t presentFrame_{};
+
+public:
+    static int const INPUT_LATENCY_CAPACITY{ 1 << 14 };
+
+    InputLatency& inputLatency() { return inputLatency_; }
+
+private:
+    bool initImpl(
+        int width,
+        int height,
+        char const* title
+    );
+
+    void deinitImpl();
+
+    bool shouldCloseImpl();
+
+    void setVsyncImpl( VsyncMode mode );
+    int refreshRateImpl();
+
+    bool supportsRenderThreadImpl();
+    void setContextCurrentImpl( bool isCurrent );
+    void setFramesInFlightImpl( int count );
+
+    void pollInputImpl();
+
+    void beginFrameImpl();
+    void endFrameImpl();
+
+    unsigned int loadShaderProgramImpl(
+        char const* vertexShaderPath,
+        char const* fragmentShaderPath
+    );
+
+    void unloadShaderProgramImpl( unsigned int program );
+    void enableShaderProgramImpl( unsigned int program );
+
+    unsigned int loadVertexArrayImpl();
+    void unloadVertexArrayImpl( unsigned int vao );
+    void enableVertexArrayImpl( unsigned int vao );
+    void disableVertexArrayImpl();
+
+    unsigned int loadVertexBufferImpl(
+        void const* data,
+        int size,
+        bool dynamic
+    );
+
+    void loadVertexBufferAsyncImpl(
+        BufferHandle handle,
+        void const* data,
+        int size
+    );
+
+    void unloadVertexBufferImpl( unsigned int vbo );
+
+    void updateVertexBufferImpl(
+        unsigned int vbo,
+        void const* data,
+        int size,
+        int offset
+    );
+
+    void setVertexAttributeImpl( VertexAttribute const& attribute );
+
+    void drawImpl(
+        Primitive primitive,
+        int first,
+        int count
+    );
+
+    void executeCommandsImpl( CommandBuffer const& commands );
+
+    void readPixelsImpl( RgbaImage& image );
+
+    //* Only the first line, in the window title (set by the next `pollInput()`)
+    void drawOverlayTextImpl( char const* text );
+
+    //* Called by `deletionQueue_`
+    void deleteResource( GlDeletionQueue::Entry const& entry );
+};
+
+#endif
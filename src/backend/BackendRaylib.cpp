@@ -0,0 +1,400 @@
+#include "BackendRaylib.h"
+
+#include "Backend.h"
+#include "CommandBuffer.h"
+#include "GpuProfiler.h"
+#include "Profiler.h"
+#include "RgbaImage.h"
+#include <cstdint>
+#include <raylib.h>
+#include <rlgl.h>
+
+bool BackendRaylib::initImpl(
+    int width,
+    int height,
+    char const* title
+)
+{
+    InitWindow(
+        width,
+        height,
+        title
+    );
+
+    if ( !IsWindowReady() )
+    {
+        return false;
+    }
+
+    //* OpenGL function pointers are loaded by now (into glad's globals)
+    GladContext::loadFromGlobals( gl_ );
+    GladContext::makeCurrent( &gl_ );
+
+    gpuProfiler_.init();
+
+    return true;
+}
+
+void BackendRaylib::deinitImpl()
+{
+    deletionQueue_.finish(
+        [this]( GlDeletionQueue::Entry const& entry )
+        {
+            deleteResource( entry );
+        }
+    );
+
+    gpuProfiler_.deinit();
+    GladContext::makeCurrent( nullptr );
+    CloseWindow();
+}
+
+bool BackendRaylib::shouldCloseImpl()
+{
+    return WindowShouldClose();
+}
+
+void BackendRaylib::setVsyncImpl( VsyncMode mode )
+{
+    //* Frame limiting is done by the FramePacer, raylib's own wait in `EndDrawing()` would stack on top
+    SetTargetFPS( 0 );
+
+    switch ( mode )
+    {
+        case VsyncMode::DEFAULT:
+            break;
+
+        case VsyncMode::OFF:
+            ClearWindowState( FLAG_VSYNC_HINT );
+            break;
+
+        //* raylib has no adaptive swap interval
+        case VsyncMode::ON:
+        case VsyncMode::ADAPTIVE:
+            SetWindowState( FLAG_VSYNC_HINT );
+            break;
+    }
+}
+
+int BackendRaylib::refreshRateImpl()
+{
+    return GetMonitorRefreshRate( GetCurrentMonitor() );
+}
+
+//* raylib keeps window, input and context in global state of the calling thread
+bool BackendRaylib::supportsRenderThreadImpl()
+{
+    return false;
+}
+
+void BackendRaylib::setContextCurrentImpl( [[maybe_unused]] bool isCurrent ) {}
+
+void BackendRaylib::setFramesInFlightImpl( [[maybe_unused]] int count ) {}
+
+//* raylib polls input events in `EndDrawing()`
+void BackendRaylib::pollInputImpl() {}
+
+void BackendRaylib::beginFrameImpl()
+{
+    BeginDrawing(); // Seems to only update time?
+
+    deletionQueue_.collect(
+        [this]( GlDeletionQueue::Entry const& entry )
+        {
+            deleteResource( entry );
+        }
+    );
+
+    gpuProfiler_.beginFrame();
+    PROFILE_GPU_ZONE( gpuProfiler_, "clear" );
+
+    ClearBackground( BLACK );
+}
+
+void BackendRaylib::endFrameImpl()
+{
+    //* Flushes raylib's batch (eg. the overlay text)
+    {
+        PROFILE_GPU_ZONE( gpuProfiler_, "batch" );
+        rlDrawRenderBatchActive();
+    }
+
+    gpuProfiler_.endFrame();
+    deletionQueue_.endFrame();
+
+    //* Swap, wait and poll events
+    PROFILE_ZONE( "swap" );
+    EndDrawing();
+}
+
+unsigned int BackendRaylib::loadShaderProgramImpl(
+    char const* vertexShaderPath,
+    char const* fragmentShaderPath
+)
+{
+    Shader shader = LoadShader(
+        vertexShaderPath,
+        fragmentShaderPath
+    );
+
+    shaders_.push_back( shader );
+
+    return shader.id;
+}
+
+void BackendRaylib::unloadShaderProgramImpl( unsigned int program )
+{
+    deletionQueue_.push( GlResource::PROGRAM, program );
+}
+
+void BackendRaylib::enableShaderProgramImpl( unsigned int program )
+{
+    rlEnableShader( program );
+}
+
+unsigned int BackendRaylib::loadVertexArrayImpl()
+{
+    return rlLoadVertexArray();
+}
+
+void BackendRaylib::unloadVertexArrayImpl( unsigned int vao )
+{
+    deletionQueue_.push( GlResource::VERTEX_ARRAY, vao );
+}
+
+void BackendRaylib::enableVertexArrayImpl( unsigned int vao )
+{
+    rlEnableVertexArray( vao );
+}
+
+void BackendRaylib::disableVertexArrayImpl()
+{
+    rlDisableVertexArray();
+}
+
+unsigned int BackendRaylib::loadVertexBufferImpl(
+    void const* data,
+    int size,
+    bool dynamic
+)
+{
+    return rlLoadVertexBuffer(
+        data,
+        size,
+        dynamic
+    );
+}
+
+//* raylib offers no second context, uploads right away
+void BackendRaylib::loadVertexBufferAsyncImpl(
+    BufferHandle handle,
+    void const* data,
+    int size
+)
+{
+    completeUpload( handle, loadVertexBufferImpl( data, size, false ) );
+}
+
+void BackendRaylib::unloadVertexBufferImpl( unsigned int vbo )
+{
+    deletionQueue_.push( GlResource::BUFFER, vbo );
+}
+
+void BackendRaylib::updateVertexBufferImpl(
+    unsigned int vbo,
+    void const* data,
+    int size,
+    int offset
+)
+{
+    rlUpdateVertexBuffer(
+        vbo,
+        data,
+        size,
+        offset
+    );
+}
+
+void BackendRaylib::setVertexAttributeImpl( VertexAttribute const& attribute )
+{
+    rlSetVertexAttribute(
+        attribute.index,
+        attribute.componentCount,
+        RL_FLOAT,
+        false,
+        attribute.stride,
+        attribute.offset
+    );
+
+    rlEnableVertexAttribute( attribute.index );
+}
+
+void BackendRaylib::drawImpl(
+    Primitive primitive,
+    int first,
+    int count
+)
+{
+    PROFILE_GPU_ZONE( gpuProfiler_, "draw" );
+
+    //* rlgl only draws triangles, draw them as points instead
+    if ( primitive == Primitive::POINTS )
+    {
+        rlEnablePointMode();
+    }
+
+    rlDrawVertexArray(
+        first,
+        count
+    );
+
+    if ( primitive == Primitive::POINTS )
+    {
+        rlDisablePointMode();
+    }
+}
+
+namespace
+{
+    struct RlglCommandVisitor
+    {
+        void bindProgram( unsigned int program ) { rlEnableShader( program ); }
+
+        void bindVertexArray( unsigned int vao ) { rlEnableVertexArray( vao ); }
+
+        void setUniform(
+            int location,
+            UniformType type,
+            float const* values
+        )
+        {
+            switch ( type )
+            {
+                case UniformType::FLOAT:
+                    rlSetUniform( location, values, RL_SHADER_UNIFORM_FLOAT, 1 );
+                    break;
+                case UniformType::VEC2:
+                    rlSetUniform( location, values, RL_SHADER_UNIFORM_VEC2, 1 );
+                    break;
+                case UniformType::VEC3:
+                    rlSetUniform( location, values, RL_SHADER_UNIFORM_VEC3, 1 );
+                    break;
+                case UniformType::VEC4:
+                    rlSetUniform( location, values, RL_SHADER_UNIFORM_VEC4, 1 );
+                    break;
+                case UniformType::MAT4:
+                {
+                    //* Matrix members are named by their column major index
+                    // clang-format off
+                    Matrix const matrix{
+                        values[0], values[4], values[8], values[12],
+                        values[1], values[5], values[9], values[13],
+                        values[2], values[6], values[10], values[14],
+                        values[3], values[7], values[11], values[15]
+                    };
+                    // clang-format on
+                    rlSetUniformMatrix( location, matrix );
+                    break;
+                }
+            }
+        }
+
+        //* rlgl has no uniform buffers, through the context's GL table
+        void bindUniformRange(
+            unsigned int binding,
+            unsigned int buffer,
+            uint32_t offset,
+            uint32_t size
+        )
+        {
+            //* Size 0 is a range the uniform ring could not fit, binding it is GL_INVALID_VALUE
+            if ( !size )
+            {
+                return;
+            }
+
+            glBindBufferRange( GL_UNIFORM_BUFFER, binding, buffer, offset, size );
+        }
+
+        void draw(
+            Primitive primitive,
+            int first,
+            int count
+        )
+        {
+            if ( primitive == Primitive::POINTS )
+            {
+                rlEnablePointMode();
+            }
+
+            rlDrawVertexArray( first, count );
+
+            if ( primitive == Primitive::POINTS )
+            {
+                rlDisablePointMode();
+            }
+        }
+    };
+}
+
+void BackendRaylib::executeCommandsImpl( CommandBuffer const& commands )
+{
+    PROFILE_GPU_ZONE( gpuProfiler_, "commands" );
+
+    RlglCommandVisitor visitor{};
+    commands.replay( visitor );
+}
+
+void BackendRaylib::readPixelsImpl( RgbaImage& image )
+{
+    image.width = GetRenderWidth();
+    image.height = GetRenderHeight();
+
+    //* Already flipped to rows top to bottom
+    unsigned char* pixels{ rlReadScreenPixels( image.width, image.height ) };
+
+    image.pixels.assign( pixels, pixels + static_cast<size_t>( image.width ) * image.height * 4 );
+
+    MemFree( pixels );
+}
+
+void BackendRaylib::drawOverlayTextImpl( char const* text )
+{
+    DrawText(
+        text,
+        10,
+        10,
+        20,
+        GREEN
+    );
+}
+
+void BackendRaylib::deleteResource( GlDeletionQueue::Entry const& entry )
+{
+    switch ( entry.type )
+    {
+        case GlResource::PROGRAM:
+            for ( auto it{ shaders_.begin() }; it != shaders_.end(); ++it )
+            {
+                if ( it->id == entry.id )
+                {
+                    UnloadShader( *it );
+                    shaders_.erase( it );
+                    break;
+                }
+            }
+            break;
+
+        case GlResource::VERTEX_ARRAY:
+            rlUnloadVertexArray( entry.id );
+            break;
+
+        case GlResource::BUFFER:
+            rlUnloadVertexBuffer( entry.id );
+            break;
+
+        case GlResource::TEXTURE:
+            rlUnloadTexture( entry.id );
+            break;
+    }
+}
@@ -0,0 +1,103 @@
+#ifndef IG20261019101800
+#define IG20261019101800
+
+#include "Backend.h"
+#include "GladContext.h"
+#include "GlDeletionQueue.h"
+#include "GpuProfiler.h"
+#include "RgbaImage.h"
+#include <raylib.h>
+#include <vector>
+
+//* raylib/rlgl backend
+class BackendRaylib : public Backend<BackendRaylib>
+{
+    friend class Backend<BackendRaylib>;
+
+    //* Loaded shaders, needed for `UnloadShader()`
+    std::vector<Shader> shaders_{};
+
+    //* Copy of the pointers rlgl loaded, for the GL calls made outside of raylib (profiler, deletion queue)
+    GladGLContext gl_{};
+
+    GpuProfiler gpuProfiler_{};
+
+    //* Unloaded objects, deleted once the frames using them are done
+    GlDeletionQueue deletionQueue_{};
+
+private:
+    bool initImpl(
+        int width,
+        int height,
+        char const* title
+    );
+
+    void deinitImpl();
+
+    bool shouldCloseImpl();
+
+    void setVsyncImpl( VsyncMode mode );
+    int refreshRateImpl();
+
+    bool supportsRenderThreadImpl();
+    void setContextCurrentImpl( bool isCurrent );
+    void setFramesInFlightImpl( int count );
+
+    void pollInputImpl();
+
+    void beginFrameImpl();
+    void endFrameImpl();
+
+    unsigned int loadShaderProgramImpl(
+        char const* vertexShaderPath,
+        char const* fragmentShaderPath
+    );
+
+    void unloadShaderProgramImpl( unsigned int program );
+    void enableShaderProgramImpl( unsigned int program );
+
+    unsigned int loadVertexArrayImpl();
+    void unloadVertexArrayImpl( unsigned int vao );
+    void enableVertexArrayImpl( unsigned int vao );
+    void disableVertexArrayImpl();
+
+    unsigned int loadVertexBufferImpl(
+        void const* data,
+        int size,
+        bool dynamic
+    );
+
+    void loadVertexBufferAsyncImpl(
+        BufferHandle handle,
+        void const* data,
+        int size
+    );
+
+    void unloadVertexBufferImpl( unsigned int vbo );
+
+    void updateVertexBufferImpl(
+        unsigned int vbo,
+        void const* data,
+        int size,
+        int offset
+    );
+
+    void setVertexAttributeImpl( VertexAttribute const& attribute );
+
+    void drawImpl(
+        Primitive primitive,
+        int first,
+        int count
+    );
+
+    void executeCommandsImpl( CommandBuffer const& commands );
+
+    void readPixelsImpl( RgbaImage& image );
+
+    void drawOverlayTextImpl( char const* text );
+
+    //* Called by `deletionQueue_`
+    void deleteResource( GlDeletionQueue::Entry const& entry );
+};
+
+#endif
@@ -0,0 +1,112 @@
+#include "CommandBuffer.h"
+
+#include "Backend.h"
+#include "LinearAllocator.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace
+{
+    size_t const COMMAND_ALIGNMENT{ 4 };
+}
+
+int uniformFloatCount( UniformType type )
+{
+    switch ( type )
+    {
+        case UniformType::FLOAT:
+            return 1;
+        case UniformType::VEC2:
+            return 2;
+        case UniformType::VEC3:
+            return 3;
+        case UniformType::VEC4:
+            return 4;
+        case UniformType::MAT4:
+            return 16;
+    }
+
+    return 0;
+}
+
+CommandBuffer::CommandBuffer( size_t blockSize )
+    : allocator_( blockSize )
+{
+}
+
+template <typename TCommand>
+TCommand& CommandBuffer::push(
+    CommandType type,
+    size_t payloadSize
+)
+{
+    static_assert( alignof( TCommand ) <= COMMAND_ALIGNMENT );
+
+    //* Sizes stay multiples of the alignment, so commands of a block are contiguous
+    size_t const size{ ( sizeof( TCommand ) + payloadSize + COMMAND_ALIGNMENT - 1 ) & ~( COMMAND_ALIGNMENT - 1 ) };
+
+    TCommand* command{ new ( allocator_.allocate( size, COMMAND_ALIGNMENT ) ) TCommand{} };
+    command->header = { type, 0, static_cast<uint16_t>( size ) };
+    ++commandCount_;
+
+    return *command;
+}
+
+void CommandBuffer::bindProgram( unsigned int program )
+{
+    push<BindProgramCommand>( CommandType::BIND_PROGRAM ).program = program;
+}
+
+void CommandBuffer::bindVertexArray( unsigned int vao )
+{
+    push<BindVertexArrayCommand>( CommandType::BIND_VERTEX_ARRAY ).vao = vao;
+}
+
+void CommandBuffer::setUniform(
+    int location,
+    UniformType type,
+    float const* values
+)
+{
+    size_t const payloadSize{ uniformFloatCount( type ) * sizeof( float ) };
+
+    SetUniformCommand& command{ push<SetUniformCommand>( CommandType::SET_UNIFORM, payloadSize ) };
+    command.uniformType = type;
+    command.location = location;
+
+    std::memcpy( reinterpret_cast<std::byte*>( &command ) + sizeof( SetUniformCommand ), values, payloadSize );
+}
+
+void CommandBuffer::bindUniformRange(
+    unsigned int binding,
+    unsigned int buffer,
+    uint32_t offset,
+    uint32_t size
+)
+{
+    BindUniformRangeCommand& command{ push<BindUniformRangeCommand>( CommandType::BIND_UNIFORM_RANGE ) };
+    command.binding = binding;
+    command.buffer = buffer;
+    command.offset = offset;
+    command.size = size;
+}
+
+void CommandBuffer::draw(
+    Primitive primitive,
+    int first,
+    int count
+)
+{
+    DrawCommand& command{ push<DrawCommand>( CommandType::DRAW ) };
+    command.primitive = primitive;
+    command.first = first;
+    command.count = count;
+}
+
+void CommandBuffer::reset()
+{
+    allocator_.reset();
+    commandCount_ = 0;
+}
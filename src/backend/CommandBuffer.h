@@ -0,0 +1,180 @@
+#ifndef IG20261019110200
+#define IG20261019110200
+
+#include "Backend.h"
+#include "LinearAllocator.h"
+#include <cstddef>
+#include <cstdint>
+
+enum class UniformType : uint8_t
+{
+    FLOAT,
+    VEC2,
+    VEC3,
+    VEC4,
+    MAT4,
+};
+
+int uniformFloatCount( UniformType type );
+
+enum class CommandType : uint8_t
+{
+    BIND_PROGRAM,
+    BIND_VERTEX_ARRAY,
+    SET_UNIFORM,
+    BIND_UNIFORM_RANGE,
+    DRAW,
+};
+
+//* Deferred draw commands, API agnostic
+//* - any thread records into its own buffer (storage comes from a LinearAllocator, reused after `reset()`)
+//* - the context thread replays buffers with `Backend::executeCommands()`, in recording order
+//* Commands are packed back to back, 4 byte aligned, each starting with a CommandHeader.
+class CommandBuffer
+{
+public:
+    struct CommandHeader
+    {
+        CommandType type{};
+        uint8_t padding{};
+        //* Including the header
+        uint16_t size{};
+    };
+
+    struct BindProgramCommand
+    {
+        CommandHeader header{};
+        unsigned int program{};
+    };
+
+    struct BindVertexArrayCommand
+    {
+        CommandHeader header{};
+        unsigned int vao{};
+    };
+
+    //* Followed by `uniformFloatCount( uniformType )` floats (matrices column major)
+    struct SetUniformCommand
+    {
+        CommandHeader header{};
+        UniformType uniformType{};
+        int location{};
+    };
+
+    //* Uniform block binding point to a range of a uniform buffer (eg. from GlUniformRing)
+    struct BindUniformRangeCommand
+    {
+        CommandHeader header{};
+        unsigned int binding{};
+        unsigned int buffer{};
+        uint32_t offset{};
+        uint32_t size{};
+    };
+
+    struct DrawCommand
+    {
+        CommandHeader header{};
+        Primitive primitive{};
+        int first{};
+        int count{};
+    };
+
+    explicit CommandBuffer( size_t blockSize = LinearAllocator::DEFAULT_BLOCK_SIZE );
+
+    void bindProgram( unsigned int program );
+    void bindVertexArray( unsigned int vao );
+
+    void setUniform(
+        int location,
+        UniformType type,
+        float const* values
+    );
+
+    void bindUniformRange(
+        unsigned int binding,
+        unsigned int buffer,
+        uint32_t offset,
+        uint32_t size
+    );
+
+    void draw(
+        Primitive primitive,
+        int first,
+        int count
+    );
+
+    void reset();
+
+    //* Record into a frame arena (see `LinearAllocator::setArena()`)
+    void setArena( FrameArena* arena ) { allocator_.setArena( arena ); }
+
+    int commandCount() const { return commandCount_; }
+    size_t bytesUsed() const { return allocator_.bytesUsed(); }
+
+    //* Calls `visitor.bindProgram()`, `.bindVertexArray()`, `.setUniform()`, `.bindUniformRange()` and `.draw()` per command
+    template <typename TVisitor>
+    void replay( TVisitor& visitor ) const
+    {
+        for ( size_t i{ 0 }; i < allocator_.activeBlockCount(); ++i )
+        {
+            LinearAllocator::Block const& block{ allocator_.blocks()[i] };
+            std::byte const* command{ block.memory };
+            std::byte const* const end{ command + block.used };
+
+            while ( command < end )
+            {
+                CommandHeader const& header{ *reinterpret_cast<CommandHeader const*>( command ) };
+
+                switch ( header.type )
+                {
+                    case CommandType::BIND_PROGRAM:
+                        visitor.bindProgram( reinterpret_cast<BindProgramCommand const*>( command )->program );
+                        break;
+
+                    case CommandType::BIND_VERTEX_ARRAY:
+                        visitor.bindVertexArray( reinterpret_cast<BindVertexArrayCommand const*>( command )->vao );
+                        break;
+
+                    case CommandType::SET_UNIFORM:
+                    {
+                        SetUniformCommand const& uniform{ *reinterpret_cast<SetUniformCommand const*>( command ) };
+                        visitor.setUniform(
+                            uniform.location,
+                            uniform.uniformType,
+                            reinterpret_cast<float const*>( command + sizeof( SetUniformCommand ) )
+                        );
+                        break;
+                    }
+
+                    case CommandType::BIND_UNIFORM_RANGE:
+                    {
+                        BindUniformRangeCommand const& range{ *reinterpret_cast<BindUniformRangeCommand const*>( command ) };
+                        visitor.bindUniformRange( range.binding, range.buffer, range.offset, range.size );
+                        break;
+                    }
+
+                    case CommandType::DRAW:
+                    {
+                        DrawCommand const& draw{ *reinterpret_cast<DrawCommand const*>( command ) };
+                        visitor.draw( draw.primitive, draw.first, draw.count );
+                        break;
+                    }
+                }
+
+                command += header.size;
+            }
+        }
+    }
+
+private:
+    template <typename TCommand>
+    TCommand& push(
+        CommandType type,
+        size_t payloadSize = 0
+    );
+
+    LinearAllocator allocator_;
+    int commandCount_{};
+};
+
+#endif
@@ -0,0 +1,178 @@
+#include "DrawQueue.h"
+
+#include "Backend.h"
+#include "CommandBuffer.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    uint64_t bits(
+        uint64_t value,
+        int count
+    )
+    {
+        return value & ( ( uint64_t{ 1 } << count ) - 1 );
+    }
+}
+
+uint64_t DrawKey::make(
+    int layer,
+    bool isTranslucent,
+    unsigned int program,
+    unsigned int vertexArray,
+    float depth
+)
+{
+    uint64_t const maxDepth{ ( uint64_t{ 1 } << DEPTH_BITS ) - 1 };
+    uint64_t const quantizedDepth{ static_cast<uint64_t>( std::clamp( depth, 0.0f, 1.0f ) * maxDepth ) };
+
+    uint64_t key{ bits( static_cast<uint64_t>( layer ), LAYER_BITS ) };
+    key = ( key << 1 ) | ( isTranslucent ? 1 : 0 );
+
+    if ( isTranslucent )
+    {
+        key = ( key << DEPTH_BITS ) | ( maxDepth - quantizedDepth );
+        key = ( key << PROGRAM_BITS ) | bits( program, PROGRAM_BITS );
+        key = ( key << VERTEX_ARRAY_BITS ) | bits( vertexArray, VERTEX_ARRAY_BITS );
+    }
+    else
+    {
+        key = ( key << PROGRAM_BITS ) | bits( program, PROGRAM_BITS );
+        key = ( key << VERTEX_ARRAY_BITS ) | bits( vertexArray, VERTEX_ARRAY_BITS );
+        key = ( key << DEPTH_BITS ) | quantizedDepth;
+    }
+
+    return key << ( 64 - LAYER_BITS - 1 - DEPTH_BITS - PROGRAM_BITS - VERTEX_ARRAY_BITS );
+}
+
+void DrawQueue::submit(
+    uint64_t key,
+    Draw const& draw
+)
+{
+    entries_.push_back( { key, static_cast<uint32_t>( draws_.size() ) } );
+    draws_.push_back( draw );
+    draws_.back().uniformLocation = -1;
+}
+
+void DrawQueue::submit(
+    uint64_t key,
+    Draw draw,
+    int uniformLocation,
+    UniformType uniformType,
+    float const* values
+)
+{
+    draw.uniformLocation = uniformLocation;
+    draw.uniformType = uniformType;
+    draw.uniformOffset = static_cast<int>( uniformValues_.size() );
+    uniformValues_.insert( uniformValues_.end(), values, values + uniformFloatCount( uniformType ) );
+
+    entries_.push_back( { key, static_cast<uint32_t>( draws_.size() ) } );
+    draws_.push_back( draw );
+}
+
+void DrawQueue::sort()
+{
+    size_t const count{ entries_.size() };
+
+    if ( count < 2 )
+    {
+        return;
+    }
+
+    //* LSD radix sort, 8 bit digits; all histograms in one pass,
+    //* digits that are the same for every key (eg. unused bits, a single layer) are skipped
+    std::array<std::array<uint32_t, 256>, 8> histograms{};
+
+    for ( Entry const& entry : entries_ )
+    {
+        for ( int digit{ 0 }; digit < 8; ++digit )
+        {
+            ++histograms[digit][( entry.key >> ( digit * 8 ) ) & 0xff];
+        }
+    }
+
+    scratch_.resize( count );
+
+    for ( int digit{ 0 }; digit < 8; ++digit )
+    {
+        std::array<uint32_t, 256>& histogram{ histograms[digit] };
+
+        if ( histogram[( entries_.front().key >> ( digit * 8 ) ) & 0xff] == count )
+        {
+            continue;
+        }
+
+        //* Counts to start offsets
+        uint32_t offset{ 0 };
+
+        for ( uint32_t& bucket : histogram )
+        {
+            uint32_t const bucketCount{ bucket };
+            bucket = offset;
+            offset += bucketCount;
+        }
+
+        for ( Entry const& entry : entries_ )
+        {
+            scratch_[histogram[( entry.key >> ( digit * 8 ) ) & 0xff]++] = entry;
+        }
+
+        std::swap( entries_, scratch_ );
+    }
+}
+
+DrawQueue::Stats DrawQueue::record( CommandBuffer& commands ) const
+{
+    Stats stats{};
+
+    //* 0 is never a valid program/VAO for a draw, so the first draw always binds
+    unsigned int program{ 0 };
+    unsigned int vertexArray{ 0 };
+
+    for ( Entry const& entry : entries_ )
+    {
+        Draw const& draw{ draws_[entry.draw] };
+
+        if ( draw.program != program )
+        {
+            program = draw.program;
+            commands.bindProgram( program );
+            ++stats.programChanges;
+        }
+
+        if ( draw.vertexArray != vertexArray )
+        {
+            vertexArray = draw.vertexArray;
+            commands.bindVertexArray( vertexArray );
+            ++stats.vertexArrayChanges;
+        }
+
+        if ( draw.uniformLocation >= 0 )
+        {
+            commands.setUniform( draw.uniformLocation, draw.uniformType, uniformValues_.data() + draw.uniformOffset );
+        }
+
+        commands.draw( draw.primitive, draw.first, draw.count );
+        ++stats.draws;
+    }
+
+    if ( vertexArray )
+    {
+        commands.bindVertexArray( 0 );
+    }
+
+    return stats;
+}
+
+void DrawQueue::reset()
+{
+    entries_.clear();
+    draws_.clear();
+    uniformValues_.clear();
+}
@@ -0,0 +1,95 @@
+#ifndef IG20261019110400
+#define IG20261019110400
+
+#include "Backend.h"
+#include "CommandBuffer.h"
+#include <cstdint>
+#include <vector>
+
+//* Sort key, most significant first:
+//* | layer 4 | translucent 1 | opaque:      program 11 | vertex array 16 | depth 24      | unused 8 |
+//* |         |               | translucent: far-to-near depth 24 | program 11 | vertex array 16 | unused 8 |
+//* - layers (eg. world, effects, UI) draw in order
+//* - opaque draws are grouped by state (fewest program and VAO switches), then front to back
+//* - translucent draws go after all opaque ones of their layer, back to front
+//* Program and vertex array are truncated GL names (or any small ids), depth is [0, 1] (near to far).
+struct DrawKey
+{
+    static int const LAYER_BITS{ 4 };
+    static int const PROGRAM_BITS{ 11 };
+    static int const VERTEX_ARRAY_BITS{ 16 };
+    static int const DEPTH_BITS{ 24 };
+
+    static uint64_t make(
+        int layer,
+        bool isTranslucent,
+        unsigned int program,
+        unsigned int vertexArray,
+        float depth
+    );
+};
+
+//* Draws of one frame, sorted by key before they are recorded
+//* `record()` emits only the state changes between consecutive draws (state cache) and counts them.
+class DrawQueue
+{
+public:
+    struct Draw
+    {
+        unsigned int program{};
+        unsigned int vertexArray{};
+        Primitive primitive{};
+        int first{};
+        int count{};
+        //* -1 without uniform
+        int uniformLocation{ -1 };
+        UniformType uniformType{};
+        //* Into `uniformValues_`
+        int uniformOffset{};
+    };
+
+    struct Stats
+    {
+        int draws{};
+        int programChanges{};
+        int vertexArrayChanges{};
+    };
+
+    void submit(
+        uint64_t key,
+        Draw const& draw
+    );
+
+    //* With a uniform set right before the draw (values are copied)
+    void submit(
+        uint64_t key,
+        Draw draw,
+        int uniformLocation,
+        UniformType uniformType,
+        float const* values
+    );
+
+    //* Radix sort by key, stable (equal keys keep submission order)
+    void sort();
+
+    //* Append the draws in their current order, ends with no VAO bound
+    Stats record( CommandBuffer& commands ) const;
+
+    void reset();
+
+    int size() const { return static_cast<int>( entries_.size() ); }
+
+private:
+    struct Entry
+    {
+        uint64_t key{};
+        uint32_t draw{};
+    };
+
+    std::vector<Entry> entries_{};
+    std::vector<Entry> scratch_{};
+    std::vector<Draw> draws_{};
+    std::vector<float> uniformValues_{};
+};
+
+#endif
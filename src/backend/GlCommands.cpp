@@ -0,0 +1,78 @@
+#include "GlCommands.h"
+
+#include "Backend.h"
+#include "CommandBuffer.h"
+#include <cstdint>
+
+#include "GladContext.h"
+
+namespace
+{
+    struct GlCommandVisitor
+    {
+        void bindProgram( unsigned int program ) { glUseProgram( program ); }
+
+        void bindVertexArray( unsigned int vao ) { glBindVertexArray( vao ); }
+
+        void setUniform(
+            int location,
+            UniformType type,
+            float const* values
+        )
+        {
+            switch ( type )
+            {
+                case UniformType::FLOAT:
+                    glUniform1fv( location, 1, values );
+                    break;
+                case UniformType::VEC2:
+                    glUniform2fv( location, 1, values );
+                    break;
+                case UniformType::VEC3:
+                    glUniform3fv( location, 1, values );
+                    break;
+                case UniformType::VEC4:
+                    glUniform4fv( location, 1, values );
+                    break;
+                case UniformType::MAT4:
+                    glUniformMatrix4fv( location, 1, GL_FALSE, values );
+                    break;
+            }
+        }
+
+        void bindUniformRange(
+            unsigned int binding,
+            unsigned int buffer,
+            uint32_t offset,
+            uint32_t size
+        )
+        {
+            //* Size 0 is a range the uniform ring could not fit, binding it is GL_INVALID_VALUE
+            if ( !size )
+            {
+                return;
+            }
+
+            glBindBufferRange( GL_UNIFORM_BUFFER, binding, buffer, offset, size );
+        }
+
+        void draw(
+            Primitive primitive,
+            int first,
+            int count
+        )
+        {
+            glDrawArrays(
+                ( primitive == Primitive::POINTS ) ? GL_POINTS : GL_TRIANGLES,
+                first,
+                count
+            );
+        }
+    };
+}
+
+void executeGlCommands( CommandBuffer const& commands )
+{
+    GlCommandVisitor visitor{};
+    commands.replay( visitor );
+}
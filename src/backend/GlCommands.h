@@ -0,0 +1,10 @@
+#ifndef IG20261019110300
+#define IG20261019110300
+
+#include "CommandBuffer.h"
+
+//* Replay a command buffer on the current OpenGL context, in one loop over the glad function pointers
+//* (no state tracking: redundant binds are for the recorder to avoid)
+void executeGlCommands( CommandBuffer const& commands );
+
+#endif
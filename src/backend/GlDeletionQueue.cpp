@@ -0,0 +1,92 @@
+#include "GlDeletionQueue.h"
+
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "GladContext.h"
+
+void GlDeletionQueue::push(
+    GlResource type,
+    unsigned int id
+)
+{
+    if ( id )
+    {
+        std::lock_guard<std::mutex> lock( pendingMutex_ );
+        pending_.push_back( { type, id } );
+    }
+}
+
+void GlDeletionQueue::endFrame()
+{
+    ++frame_;
+
+    std::lock_guard<std::mutex> lock( pendingMutex_ );
+
+    //* No fence for frames that deleted nothing
+    if ( pending_.empty() )
+    {
+        return;
+    }
+
+    void* const fence{ glad_glFenceSync ? glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 ) : nullptr };
+
+    //* The batch takes the pending entries, pending_ gets a spare list's storage
+    std::vector<Entry> entries{};
+
+    if ( !spareEntries_.empty() )
+    {
+        entries.swap( spareEntries_.back() );
+        spareEntries_.pop_back();
+    }
+
+    entries.swap( pending_ );
+    batches_.push_back( { fence, frame_, std::move( entries ) } );
+}
+
+size_t GlDeletionQueue::pendingCount() const
+{
+    size_t count{};
+
+    {
+        std::lock_guard<std::mutex> lock( pendingMutex_ );
+        count = pending_.size();
+    }
+
+    for ( Batch const& batch : batches_ )
+    {
+        count += batch.entries.size();
+    }
+
+    return count;
+}
+
+bool GlDeletionQueue::isDone( Batch const& batch ) const
+{
+    if ( !batch.fence )
+    {
+        return frame_ - batch.frame >= FALLBACK_FRAMES;
+    }
+
+    //* Timeout 0: only polls
+    GLenum const status{ glClientWaitSync( static_cast<GLsync>( batch.fence ), 0, 0 ) };
+
+    return status == GL_ALREADY_SIGNALED
+           || status == GL_CONDITION_SATISFIED;
+}
+
+void GlDeletionQueue::releaseFence( Batch& batch )
+{
+    if ( batch.fence )
+    {
+        glDeleteSync( static_cast<GLsync>( batch.fence ) );
+        batch.fence = nullptr;
+    }
+}
+
+void GlDeletionQueue::waitIdle()
+{
+    glFinish();
+}
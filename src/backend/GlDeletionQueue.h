@@ -0,0 +1,136 @@
+#ifndef IG20261019110900
+#define IG20261019110900
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+enum class GlResource : uint8_t
+{
+    PROGRAM,
+    VERTEX_ARRAY,
+    BUFFER,
+    TEXTURE,
+};
+
+//* Deletes GL objects once the GPU is done with them, deleting in flight objects can stall the driver
+//* - `push()` queues an object, the next `endFrame()` puts a fence behind that frame's commands
+//* - `collect()` (at frame start) deletes the objects whose fence signaled, it never waits
+//* - `finish()` (before the context goes away) waits for the GPU and deletes the rest
+//* Without fence support objects are deleted FALLBACK_FRAMES frames later.
+//* The deleter is called as `deleter( entry )` for each object, on the context thread.
+//* `push()` may run on any thread (eg. the main thread while a render thread owns the context),
+//* everything else on the context thread.
+class GlDeletionQueue
+{
+public:
+    static int const FALLBACK_FRAMES{ 3 };
+
+    struct Entry
+    {
+        GlResource type{};
+        unsigned int id{};
+    };
+
+    void push(
+        GlResource type,
+        unsigned int id
+    );
+
+    void endFrame();
+
+    template <typename TDeleter>
+    void collect( TDeleter&& deleter )
+    {
+        size_t done{ 0 };
+
+        //* Fences signal in order
+        while (
+            done < batches_.size()
+            && isDone( batches_[done] )
+        )
+        {
+            deleteBatch( batches_[done], deleter );
+            ++done;
+        }
+
+        batches_.erase( batches_.begin(), batches_.begin() + static_cast<std::ptrdiff_t>( done ) );
+    }
+
+    template <typename TDeleter>
+    void finish( TDeleter&& deleter )
+    {
+        if (
+            batches_.empty()
+            && pendingCount() == 0
+        )
+        {
+            return;
+        }
+
+        waitIdle();
+
+        for ( Batch& batch : batches_ )
+        {
+            deleteBatch( batch, deleter );
+        }
+
+        batches_.clear();
+
+        std::lock_guard<std::mutex> lock( pendingMutex_ );
+
+        for ( Entry const& entry : pending_ )
+        {
+            deleter( entry );
+        }
+
+        pending_.clear();
+    }
+
+    size_t pendingCount() const;
+
+private:
+    struct Batch
+    {
+        //* GLsync, nullptr without fence support
+        void* fence{};
+        int64_t frame{};
+        std::vector<Entry> entries{};
+    };
+
+    template <typename TDeleter>
+    void deleteBatch(
+        Batch& batch,
+        TDeleter& deleter
+    )
+    {
+        for ( Entry const& entry : batch.entries )
+        {
+            deleter( entry );
+        }
+
+        releaseFence( batch );
+
+        //* Its storage becomes a later frame's pending list
+        batch.entries.clear();
+        spareEntries_.push_back( std::move( batch.entries ) );
+    }
+
+    bool isDone( Batch const& batch ) const;
+    void releaseFence( Batch& batch );
+    void waitIdle();
+
+    //* Guards `pending_` only, batches are touched on the context thread alone
+    mutable std::mutex pendingMutex_{};
+    std::vector<Entry> pending_{};
+
+    std::vector<Batch> batches_{};
+
+    //* Entry lists of deleted batches, kept for their capacity (no allocation once warmed up)
+    std::vector<std::vector<Entry>> spareEntries_{};
+    int64_t frame_{};
+};
+
+#endif
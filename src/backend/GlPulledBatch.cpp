@@ -0,0 +1,170 @@
+#include "GlPulledBatch.h"
+
+#include "Backend.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "GladContext.h"
+
+namespace
+{
+    int const FLOATS_PER_VERTEX{ 5 };
+
+    uint32_t packSnorm16( float value )
+    {
+        return static_cast<uint16_t>( static_cast<int16_t>( std::lround( std::clamp( value, -1.0f, 1.0f ) * 32767.0f ) ) );
+    }
+
+    uint32_t packUnorm8( float value )
+    {
+        return static_cast<uint32_t>( std::lround( std::clamp( value, 0.0f, 1.0f ) * 255.0f ) );
+    }
+
+    uint32_t floatBits( float value )
+    {
+        uint32_t bits{};
+        std::memcpy( &bits, &value, sizeof( bits ) );
+
+        return bits;
+    }
+
+    template <typename T>
+    unsigned int createBuffer( std::vector<T> const& data )
+    {
+        unsigned int buffer{};
+        glGenBuffers( 1, &buffer );
+        glBindBuffer( GL_COPY_WRITE_BUFFER, buffer );
+        glBufferData(
+            GL_COPY_WRITE_BUFFER,
+            static_cast<GLsizeiptr>( data.size() * sizeof( T ) ),
+            data.data(),
+            GL_STATIC_DRAW
+        );
+        glBindBuffer( GL_COPY_WRITE_BUFFER, 0 );
+
+        return buffer;
+    }
+}
+
+int GlPulledBatch::addMesh(
+    PulledFormat format,
+    float const* vertices,
+    int vertexCount
+)
+{
+    meshes_.push_back( { static_cast<uint32_t>( words_.size() ), format, vertexCount_, 0 } );
+    commands_.push_back( { static_cast<uint32_t>( vertexCount ), 1, vertexCount_, static_cast<uint32_t>( commands_.size() ) } );
+
+    encode( format, vertices, vertexCount, words_ );
+
+    vertexCount_ += static_cast<uint32_t>( vertexCount );
+
+    return static_cast<int>( meshes_.size() ) - 1;
+}
+
+void GlPulledBatch::encode(
+    PulledFormat format,
+    float const* vertices,
+    int vertexCount,
+    std::vector<uint32_t>& words
+)
+{
+    for ( int i{ 0 }; i < vertexCount; ++i )
+    {
+        float const* vertex{ vertices + static_cast<size_t>( i ) * FLOATS_PER_VERTEX };
+
+        switch ( format )
+        {
+            case PulledFormat::FULL:
+                for ( int component{ 0 }; component < FLOATS_PER_VERTEX; ++component )
+                {
+                    words.push_back( floatBits( vertex[component] ) );
+                }
+                break;
+            case PulledFormat::PACKED:
+                words.push_back( packSnorm16( vertex[0] ) | packSnorm16( vertex[1] ) << 16 );
+                words.push_back(
+                    packUnorm8( vertex[2] )
+                    | packUnorm8( vertex[3] ) << 8
+                    | packUnorm8( vertex[4] ) << 16
+                    | 0xffu << 24
+                );
+                break;
+        }
+    }
+}
+
+bool GlPulledBatch::isSupported()
+{
+    GladGLContext const* gl{ GladContext::current() };
+
+    return gl && gl->isVersion( 4, 3 );
+}
+
+bool GlPulledBatch::upload()
+{
+    if ( !isSupported() || meshes_.empty() )
+    {
+        return false;
+    }
+
+    //* Mesh index per draw, fetched with the draw's base instance
+    std::vector<uint32_t> meshIndices( meshes_.size() );
+    std::iota( meshIndices.begin(), meshIndices.end(), 0u );
+
+    vertexBuffer_ = createBuffer( words_ );
+    meshBuffer_ = createBuffer( meshes_ );
+    meshIndexBuffer_ = createBuffer( meshIndices );
+    indirectBuffer_ = createBuffer( commands_ );
+
+    //* The only attribute, integer and per instance
+    glGenVertexArrays( 1, &vao_ );
+    glBindVertexArray( vao_ );
+    glBindBuffer( GL_ARRAY_BUFFER, meshIndexBuffer_ );
+    glVertexAttribIPointer( 0, 1, GL_UNSIGNED_INT, sizeof( uint32_t ), nullptr );
+    glVertexAttribDivisor( 0, 1 );
+    glEnableVertexAttribArray( 0 );
+    glBindVertexArray( 0 );
+    glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+    return true;
+}
+
+void GlPulledBatch::draw( Primitive primitive ) const
+{
+    glBindBufferBase( GL_SHADER_STORAGE_BUFFER, VERTEX_BINDING, vertexBuffer_ );
+    glBindBufferBase( GL_SHADER_STORAGE_BUFFER, MESH_BINDING, meshBuffer_ );
+    glBindBuffer( GL_DRAW_INDIRECT_BUFFER, indirectBuffer_ );
+    glBindVertexArray( vao_ );
+
+    glMultiDrawArraysIndirect(
+        ( primitive == Primitive::POINTS ) ? GL_POINTS : GL_TRIANGLES,
+        nullptr,
+        static_cast<GLsizei>( commands_.size() ),
+        0
+    );
+
+    //* Unbind like `upload()`, so later bind-to-edit setup cannot change the batch's VAO
+    glBindVertexArray( 0 );
+    glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+}
+
+void GlPulledBatch::deinit()
+{
+    if ( !vao_ )
+    {
+        *this = {};
+        return;
+    }
+
+    unsigned int const buffers[]{ vertexBuffer_, meshBuffer_, meshIndexBuffer_, indirectBuffer_ };
+
+    glDeleteBuffers( 4, buffers );
+    glDeleteVertexArrays( 1, &vao_ );
+
+    *this = {};
+}
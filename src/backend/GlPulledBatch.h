@@ -0,0 +1,94 @@
+#ifndef IG20261019111300
+#define IG20261019111300
+
+#include "Backend.h"
+#include <cstdint>
+#include <vector>
+
+//* Vertex formats decoded by assets/shaders/pulled.vert (same values)
+enum class PulledFormat : uint32_t
+{
+    //* As example.vert's attributes: vec2 position, vec3 color, floats (20 bytes)
+    FULL,
+    //* Position as 2x snorm16, color as 4x unorm8 (8 bytes)
+    PACKED,
+};
+
+//* Meshes of any `PulledFormat` in one storage buffer, drawn with one multi-draw (GL 4.3)
+//* - the vertex shader pulls its vertices from the buffer by `gl_VertexID` and decodes them
+//*   (assets/shaders/pulled.vert), so meshes share one program, one buffer and one (attribute-less) VAO
+//* - the mesh of a draw comes from an instanced attribute, indexed by the draw's base instance
+//*   (no gl_DrawID before 4.6)
+//* Fill with `addMesh()`, then `upload()` once; `draw()` with the pulling program in use.
+class GlPulledBatch
+{
+public:
+    //* Storage buffer binding points, as in the shader
+    static unsigned int const VERTEX_BINDING{ 0 };
+    static unsigned int const MESH_BINDING{ 1 };
+
+    //* Input is example.vert's layout (5 floats per vertex), encoded into `format`
+    //* Returns the mesh index
+    int addMesh(
+        PulledFormat format,
+        float const* vertices,
+        int vertexCount
+    );
+
+    //* False without GL 4.3 (storage buffers, indirect multi-draw)
+    bool upload();
+
+    //* All meshes, one draw call
+    void draw( Primitive primitive ) const;
+
+    void deinit();
+
+    int meshCount() const { return static_cast<int>( meshes_.size() ); }
+
+    //* Bytes of vertex data in the buffer
+    size_t vertexBytes() const { return words_.size() * sizeof( uint32_t ); }
+
+    static bool isSupported();
+
+    //* Appends the words of `vertexCount` vertices (example.vert's layout) in `format`
+    static void encode(
+        PulledFormat format,
+        float const* vertices,
+        int vertexCount,
+        std::vector<uint32_t>& words
+    );
+
+private:
+    //* std430, as `Mesh` in the shader
+    struct Mesh
+    {
+        uint32_t firstWord{};
+        PulledFormat format{};
+        uint32_t firstVertex{};
+        uint32_t padding{};
+    };
+
+    static_assert( sizeof( Mesh ) == 16 );
+
+    //* As GL's DrawArraysIndirectCommand
+    struct DrawCommand
+    {
+        uint32_t count{};
+        uint32_t instanceCount{};
+        uint32_t first{};
+        uint32_t baseInstance{};
+    };
+
+    std::vector<uint32_t> words_{};
+    std::vector<Mesh> meshes_{};
+    std::vector<DrawCommand> commands_{};
+    uint32_t vertexCount_{};
+
+    unsigned int vao_{};
+    unsigned int vertexBuffer_{};
+    unsigned int meshBuffer_{};
+    unsigned int meshIndexBuffer_{};
+    unsigned int indirectBuffer_{};
+};
+
+#endif
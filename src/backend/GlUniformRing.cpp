@@ -0,0 +1,176 @@
+#include "GlUniformRing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "GladContext.h"
+
+namespace
+{
+    size_t alignUp(
+        size_t value,
+        size_t alignment
+    )
+    {
+        return ( value + alignment - 1 ) / alignment * alignment;
+    }
+}
+
+bool GlUniformRing::init( size_t bytesPerFrame )
+{
+    if ( !glad_glBindBufferRange )
+    {
+        return false;
+    }
+
+    GLint alignment{};
+    glGetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment );
+
+    //* Offsets work for either binding target
+    if ( glad_glShaderStorageBlockBinding )
+    {
+        GLint storageAlignment{};
+        glGetIntegerv( GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment );
+
+        alignment = std::max( alignment, storageAlignment );
+    }
+
+    offsetAlignment_ = static_cast<size_t>( alignment > 0 ? alignment : 256 );
+    regionSize_ = alignUp( bytesPerFrame, offsetAlignment_ );
+
+    GLsizeiptr const size{ static_cast<GLsizeiptr>( regionSize_ * REGION_COUNT ) };
+
+    glGenBuffers( 1, &buffer_ );
+    glBindBuffer( GL_UNIFORM_BUFFER, buffer_ );
+
+    if ( glad_glBufferStorage )
+    {
+        GLbitfield const flags{ GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT };
+
+        //* Dynamic storage keeps `push()`'s glBufferSubData path working if the map fails (mapped_ stays nullptr)
+        glBufferStorage( GL_UNIFORM_BUFFER, size, nullptr, flags | GL_DYNAMIC_STORAGE_BIT );
+        mapped_ = static_cast<std::byte*>( glMapBufferRange( GL_UNIFORM_BUFFER, 0, size, flags ) );
+    }
+    else
+    {
+        glBufferData( GL_UNIFORM_BUFFER, size, nullptr, GL_STREAM_DRAW );
+    }
+
+    glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+
+    region_ = 0;
+    regionUsed_.store( 0, std::memory_order_relaxed );
+
+    return true;
+}
+
+void GlUniformRing::deinit()
+{
+    for ( void*& fence : fences_ )
+    {
+        if ( fence )
+        {
+            glDeleteSync( static_cast<GLsync>( fence ) );
+            fence = nullptr;
+        }
+    }
+
+    if ( mapped_ )
+    {
+        glBindBuffer( GL_UNIFORM_BUFFER, buffer_ );
+        glUnmapBuffer( GL_UNIFORM_BUFFER );
+        glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+        mapped_ = nullptr;
+    }
+
+    glDeleteBuffers( 1, &buffer_ );
+    buffer_ = 0;
+}
+
+void GlUniformRing::beginFrame()
+{
+    region_ = ( region_ + 1 ) % REGION_COUNT;
+    regionUsed_.store( 0, std::memory_order_relaxed );
+
+    void*& fence{ fences_[region_] };
+
+    if ( !fence )
+    {
+        return;
+    }
+
+    //* The GPU is REGION_COUNT frames behind at most, this only waits when it is even further behind
+    while ( glClientWaitSync( static_cast<GLsync>( fence ), GL_SYNC_FLUSH_COMMANDS_BIT, UINT64_C( 1'000'000'000 ) ) == GL_TIMEOUT_EXPIRED )
+    {
+    }
+
+    glDeleteSync( static_cast<GLsync>( fence ) );
+    fence = nullptr;
+}
+
+void GlUniformRing::endFrame()
+{
+    if ( glad_glFenceSync )
+    {
+        fences_[region_] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    }
+}
+
+GlUniformRing::Range GlUniformRing::push(
+    void const* data,
+    size_t size
+)
+{
+    size_t const alignedSize{ alignUp( size, offsetAlignment_ ) };
+    size_t const offset{ regionUsed_.fetch_add( alignedSize, std::memory_order_relaxed ) };
+
+    if ( offset + alignedSize > regionSize_ )
+    {
+        overflowCount_.fetch_add( 1, std::memory_order_relaxed );
+        return { buffer_, 0, 0 };
+    }
+
+    size_t const bufferOffset{ static_cast<size_t>( region_ ) * regionSize_ + offset };
+
+    if ( mapped_ )
+    {
+        std::memcpy( mapped_ + bufferOffset, data, size );
+    }
+    else
+    {
+        glBindBuffer( GL_UNIFORM_BUFFER, buffer_ );
+        glBufferSubData( GL_UNIFORM_BUFFER, static_cast<GLintptr>( bufferOffset ), static_cast<GLsizeiptr>( size ), data );
+        glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+    }
+
+    return { buffer_, static_cast<uint32_t>( bufferOffset ), static_cast<uint32_t>( size ) };
+}
+
+void GlUniformRing::bind(
+    unsigned int binding,
+    Range const& range
+)
+{
+    if ( !range.size )
+    {
+        return;
+    }
+
+    glBindBufferRange( GL_UNIFORM_BUFFER, binding, range.buffer, range.offset, range.size );
+}
+
+void GlUniformRing::bindStorage(
+    unsigned int binding,
+    Range const& range
+)
+{
+    if ( !range.size )
+    {
+        return;
+    }
+
+    glBindBufferRange( GL_SHADER_STORAGE_BUFFER, binding, range.buffer, range.offset, range.size );
+}
@@ -0,0 +1,86 @@
+#ifndef IG20261019111600
+#define IG20261019111600
+
+#include "Std140.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+//* Per-frame uniform data in one buffer, sub-allocated per draw and bound with `glBindBufferRange()`
+//* - one region per frame in flight; `beginFrame()` waits for the region's fence from REGION_COUNT
+//*   frames ago (normally long signaled), `endFrame()` fences it
+//* - GL 4.4: the buffer is persistently mapped (coherent), `push()` is a memcpy and may run on any
+//*   thread recording for the current frame
+//* - before 4.4: `push()` is a glBufferSubData and has to run on the context thread
+//* - GL 4.3: ranges can be bound as storage buffers too (eg. arrays of per-instance matrices,
+//*   larger than a uniform block may be)
+//* Blocks that do not fit the region are dropped (range with size 0) and counted.
+class GlUniformRing
+{
+public:
+    static int const REGION_COUNT{ 3 };
+
+    //* A pushed block, as `glBindBufferRange()` wants it
+    struct Range
+    {
+        unsigned int buffer{};
+        uint32_t offset{};
+        uint32_t size{};
+    };
+
+    //* Context thread, false without uniform buffers (GL 3.1)
+    bool init( size_t bytesPerFrame );
+    void deinit();
+
+    //* Context thread, around all pushes and draws of a frame
+    void beginFrame();
+    void endFrame();
+
+    Range push(
+        void const* data,
+        size_t size
+    );
+
+    template <typename TBlock>
+    Range push( TBlock const& block )
+    {
+        static_assert( std::is_trivially_copyable_v<TBlock> );
+        static_assert( sizeof( TBlock ) % Std140::BLOCK_ALIGNMENT == 0, "Not a std140 block (see Std140.h)" );
+
+        return push( &block, sizeof( TBlock ) );
+    }
+
+    //* Context thread
+    static void bind(
+        unsigned int binding,
+        Range const& range
+    );
+
+    //* Context thread, to a `std430` shader storage block
+    static void bindStorage(
+        unsigned int binding,
+        Range const& range
+    );
+
+    bool isPersistent() const { return mapped_ != nullptr; }
+
+    int64_t overflowCount() const { return overflowCount_.load( std::memory_order_relaxed ); }
+
+private:
+    unsigned int buffer_{};
+    std::byte* mapped_{};
+
+    size_t regionSize_{};
+    //* GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT (and GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT)
+    size_t offsetAlignment_{};
+
+    int region_{};
+    std::atomic<size_t> regionUsed_{};
+    std::atomic<int64_t> overflowCount_{};
+    std::array<void*, REGION_COUNT> fences_{};
+};
+
+#endif
@@ -0,0 +1,161 @@
+#include "GlUploader.h"
+
+#include "Profiler.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "GladContext.h"
+
+void GlUploader::start( std::function<void( bool )> setCurrent )
+{
+    if ( isRunning() )
+    {
+        return;
+    }
+
+    isStopping_ = false;
+    thread_ = std::thread{
+        [this, setCurrent = std::move( setCurrent )]()
+        {
+            run( setCurrent );
+        }
+    };
+}
+
+void GlUploader::stop()
+{
+    if ( !isRunning() )
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        isStopping_ = true;
+        requests_.clear();
+    }
+
+    wake_.notify_one();
+    thread_.join();
+}
+
+void GlUploader::uploadBuffer(
+    BufferHandle handle,
+    void const* data,
+    size_t size
+)
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        requests_.push_back( { handle, data, size, 0 } );
+    }
+
+    wake_.notify_one();
+}
+
+size_t GlUploader::pendingCount() const
+{
+    std::lock_guard<std::mutex> lock( mutex_ );
+
+    return requests_.size() + inFlightCount_ + completed_.size();
+}
+
+void GlUploader::run( std::function<void( bool )> setCurrent )
+{
+    Profiler::setThreadName( "upload" );
+    setCurrent( true );
+
+    std::unique_lock<std::mutex> lock( mutex_ );
+
+    while ( true )
+    {
+        wake_.wait(
+            lock,
+            [this]()
+            {
+                return isStopping_ || !requests_.empty();
+            }
+        );
+
+        if ( isStopping_ )
+        {
+            break;
+        }
+
+        Upload request{ requests_.front() };
+        requests_.pop_front();
+        ++inFlightCount_;
+
+        lock.unlock();
+        upload( request );
+        lock.lock();
+
+        --inFlightCount_;
+        completed_.push_back( request );
+    }
+
+    //* Nobody collects these anymore
+    for ( Upload const& upload : completed_ )
+    {
+        glDeleteBuffers( 1, &upload.buffer );
+    }
+
+    completed_.clear();
+    lock.unlock();
+
+    setCurrent( false );
+}
+
+void GlUploader::upload( Upload& upload )
+{
+    PROFILE_ZONE( "upload buffer" );
+
+    //* DSA (GL 4.5) if this context has it, no binding to restore then
+    bool const isDsa{ glad_glNamedBufferStorage != nullptr };
+
+    if ( isDsa )
+    {
+        glCreateBuffers( 1, &upload.buffer );
+        glNamedBufferStorage( upload.buffer, static_cast<GLsizeiptr>( upload.size ), nullptr, GL_DYNAMIC_STORAGE_BIT );
+    }
+    else
+    {
+        glGenBuffers( 1, &upload.buffer );
+        glBindBuffer( GL_ARRAY_BUFFER, upload.buffer );
+        glBufferData( GL_ARRAY_BUFFER, static_cast<GLsizeiptr>( upload.size ), nullptr, GL_STATIC_DRAW );
+    }
+
+    for ( size_t offset{ 0 }; offset < upload.size; offset += CHUNK_SIZE )
+    {
+        GLsizeiptr const chunkSize{ static_cast<GLsizeiptr>( std::min( size_t{ CHUNK_SIZE }, upload.size - offset ) ) };
+        void const* chunk{ static_cast<std::byte const*>( upload.data ) + offset };
+
+        if ( isDsa )
+        {
+            glNamedBufferSubData( upload.buffer, static_cast<GLintptr>( offset ), chunkSize, chunk );
+        }
+        else
+        {
+            glBufferSubData( GL_ARRAY_BUFFER, static_cast<GLintptr>( offset ), chunkSize, chunk );
+        }
+    }
+
+    if ( !isDsa )
+    {
+        glBindBuffer( GL_ARRAY_BUFFER, 0 );
+    }
+
+    //* Other contexts may use the buffer once the copy is done on the GPU
+    GLsync const fence{ glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 ) };
+
+    while ( glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, UINT64_C( 1'000'000'000 ) ) == GL_TIMEOUT_EXPIRED )
+    {
+    }
+
+    glDeleteSync( fence );
+}
@@ -0,0 +1,87 @@
+#ifndef IG20261019111000
+#define IG20261019111000
+
+#include "Backend.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//* Buffer uploads on a background thread with its own GL context (shared with the render context)
+//* - the upload thread creates the buffer, copies the data in chunks, fences and waits for the fence,
+//*   so a buffer coming out of `collect()` is complete and may be bound by any context of the share group
+//* - large loads no longer stall the render thread in `glBufferData()`
+//* `start()`, `uploadBuffer()`, `collect()` and `stop()` are for one (any) thread, not the upload thread.
+class GlUploader
+{
+public:
+    //* Copied with one `glBufferSubData()` each
+    static size_t const CHUNK_SIZE{ 4 << 20 };
+
+    struct Upload
+    {
+        BufferHandle handle{};
+        void const* data{};
+        size_t size{};
+        //* GL name, once done
+        unsigned int buffer{};
+    };
+
+    ~GlUploader() { stop(); }
+
+    //* `setCurrent( true/false )` binds/unbinds the upload context on the calling (upload) thread
+    void start( std::function<void( bool )> setCurrent );
+
+    //* Pending uploads are dropped, finished but uncollected buffers are deleted
+    void stop();
+
+    bool isRunning() const { return thread_.joinable(); }
+
+    //* `data` has to stay valid until the buffer comes out of `collect()`
+    void uploadBuffer(
+        BufferHandle handle,
+        void const* data,
+        size_t size
+    );
+
+    //* Calls `onCompleted( upload )` for uploads finished since the last call
+    template <typename TCallback>
+    void collect( TCallback&& onCompleted )
+    {
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            collected_.swap( completed_ );
+        }
+
+        for ( Upload const& upload : collected_ )
+        {
+            onCompleted( upload );
+        }
+
+        collected_.clear();
+    }
+
+    //* Requested but not collected yet
+    size_t pendingCount() const;
+
+private:
+    void run( std::function<void( bool )> setCurrent );
+    void upload( Upload& upload );
+
+    mutable std::mutex mutex_{};
+    std::condition_variable wake_{};
+    bool isStopping_{};
+
+    std::deque<Upload> requests_{};
+    std::vector<Upload> completed_{};
+    std::vector<Upload> collected_{};
+    //* Taken by the upload thread, not completed yet
+    size_t inFlightCount_{};
+
+    std::thread thread_{};
+};
+
+#endif
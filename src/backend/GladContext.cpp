@@ -0,0 +1,135 @@
+//* Needs glad's own globals for `loadFromGlobals()`
+#define GLAD_CONTEXT_NO_REDIRECT
+#include "GladContext.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    //* Same as glad: "major.minor..." from GL_VERSION, desktop OpenGL only
+    void loadVersion( GladGLContext& table )
+    {
+        table.majorVersion = 0;
+        table.minorVersion = 0;
+
+        char const* version{ table.GetString ? reinterpret_cast<char const*>( table.GetString( GL_VERSION ) ) : nullptr };
+
+        if ( !version || std::sscanf( version, "%d.%d", &table.majorVersion, &table.minorVersion ) != 2 )
+        {
+            table.majorVersion = 0;
+            table.minorVersion = 0;
+        }
+    }
+
+    //* Core profiles only list extensions through glGetStringi (3.0+), older contexts in one string
+    bool hasExtension(
+        GladGLContext const& table,
+        char const* extension
+    )
+    {
+        if ( table.GetStringi )
+        {
+            GLint count{};
+            table.GetIntegerv( GL_NUM_EXTENSIONS, &count );
+
+            for ( GLint i{ 0 }; i < count; ++i )
+            {
+                char const* name{ reinterpret_cast<char const*>( table.GetStringi( GL_EXTENSIONS, static_cast<GLuint>( i ) ) ) };
+
+                if ( name && std::strcmp( name, extension ) == 0 )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        char const* extensions{ reinterpret_cast<char const*>( table.GetString( GL_EXTENSIONS ) ) };
+        size_t const length{ std::strlen( extension ) };
+
+        //* Whole names only, "GL_KHR_debug" is not "GL_KHR_debug_output"
+        for (
+            char const* found{ extensions ? std::strstr( extensions, extension ) : nullptr };
+            found;
+            found = std::strstr( found + length, extension )
+        )
+        {
+            if (
+                ( found == extensions || found[-1] == ' ' )
+                && ( found[length] == ' ' || found[length] == '\0' )
+            )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+//* Functions of extensions the loader asks for on older contexts too (desktop names, no suffix)
+// clang-format off
+#define GLAD_CONTEXT_KHR_DEBUG_FUNCTIONS( X ) \
+    X( PFNGLDEBUGMESSAGECONTROLPROC, DebugMessageControl ) \
+    X( PFNGLDEBUGMESSAGEINSERTPROC, DebugMessageInsert ) \
+    X( PFNGLDEBUGMESSAGECALLBACKPROC, DebugMessageCallback ) \
+    X( PFNGLGETDEBUGMESSAGELOGPROC, GetDebugMessageLog ) \
+    X( PFNGLPUSHDEBUGGROUPPROC, PushDebugGroup ) \
+    X( PFNGLPOPDEBUGGROUPPROC, PopDebugGroup ) \
+    X( PFNGLOBJECTLABELPROC, ObjectLabel ) \
+    X( PFNGLGETOBJECTLABELPROC, GetObjectLabel ) \
+    X( PFNGLOBJECTPTRLABELPROC, ObjectPtrLabel ) \
+    X( PFNGLGETOBJECTPTRLABELPROC, GetObjectPtrLabel )
+// clang-format on
+
+namespace GladContext
+{
+    bool load(
+        GladGLContext& table,
+        GLADloadproc loader
+    )
+    {
+        table = {};
+        table.GetString = reinterpret_cast<PFNGLGETSTRINGPROC>( loader( "glGetString" ) );
+
+        loadVersion( table );
+
+        if ( !table.majorVersion )
+        {
+            table = {};
+            return false;
+        }
+
+        //* Some loaders (eg. EGL) return stubs for anything, only ask for what the version provides
+#define GLAD_CONTEXT_LOAD( type, name, major, minor ) \
+    table.name = table.isVersion( major, minor ) ? reinterpret_cast<type>( loader( "gl" #name ) ) : nullptr;
+        GLAD_GL_FUNCTIONS( GLAD_CONTEXT_LOAD )
+#undef GLAD_CONTEXT_LOAD
+
+        //* Below 4.3 the debug output still comes with the extension
+        if (
+            !table.isVersion( 4, 3 )
+            && hasExtension( table, "GL_KHR_debug" )
+        )
+        {
+#define GLAD_CONTEXT_LOAD_EXTENSION( type, name ) table.name = reinterpret_cast<type>( loader( "gl" #name ) );
+            GLAD_CONTEXT_KHR_DEBUG_FUNCTIONS( GLAD_CONTEXT_LOAD_EXTENSION )
+#undef GLAD_CONTEXT_LOAD_EXTENSION
+        }
+
+        return true;
+    }
+
+    bool loadFromGlobals( GladGLContext& table )
+    {
+#define GLAD_CONTEXT_COPY( type, name, major, minor ) table.name = glad_gl##name;
+        GLAD_GL_FUNCTIONS( GLAD_CONTEXT_COPY )
+#undef GLAD_CONTEXT_COPY
+
+        loadVersion( table );
+
+        return table.isLoaded();
+    }
+}
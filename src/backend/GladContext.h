@@ -0,0 +1,63 @@
+#ifndef IG20261019111100
+#define IG20261019111100
+
+#include "GladFunctions.h"
+
+#include <glad/glad.h>
+
+//* OpenGL function pointers of one context
+//* glad keeps one process-global set of `glad_gl*` pointers, which is only right as long as all contexts
+//* come from the same driver and share one loader call. Including this header instead of <glad/glad.h>
+//* routes every `gl*` call (and `glad_gl*` check) through the table current on the calling thread:
+//* - every context gets its own table, loaded once while that context is current
+//* - `makeCurrent( &table )` goes next to every context switch (eg. glfwMakeContextCurrent),
+//*   it is a thread-local pointer store, no reload
+//* - like glad, functions newer than the context's version stay nullptr,
+//*   except the ones of listed extensions that are loaded anyway (GL_KHR_debug)
+//* - calls without a current table dereference nullptr, like calls through unloaded glad pointers
+struct GladGLContext
+{
+#define GLAD_CONTEXT_MEMBER( type, name, major, minor ) type name{};
+    GLAD_GL_FUNCTIONS( GLAD_CONTEXT_MEMBER )
+#undef GLAD_CONTEXT_MEMBER
+
+    //* Version of the context the table was loaded for, 0.0 if not loaded (or OpenGL ES)
+    int majorVersion{};
+    int minorVersion{};
+
+    bool isLoaded() const { return GetString != nullptr; }
+
+    bool isVersion(
+        int major,
+        int minor
+    ) const
+    {
+        return majorVersion > major || ( majorVersion == major && minorVersion >= minor );
+    }
+};
+
+namespace GladContext
+{
+    //* Table of the calling thread, see `makeCurrent()`
+    inline thread_local GladGLContext const* currentTable{ nullptr };
+
+    //* Resolves all functions with `loader` (eg. glfwGetProcAddress), the context has to be current
+    //* False if not even glGetString could be loaded
+    bool load(
+        GladGLContext& table,
+        GLADloadproc loader
+    );
+
+    //* Copies glad's global pointers, for contexts loaded by someone else (raylib's `rlLoadExtensions()`)
+    bool loadFromGlobals( GladGLContext& table );
+
+    inline void makeCurrent( GladGLContext const* table ) { currentTable = table; }
+
+    inline GladGLContext const* current() { return currentTable; }
+}
+
+#if !defined( GLAD_CONTEXT_NO_REDIRECT )
+#include "GladRedirect.h"
+#endif
+
+#endif
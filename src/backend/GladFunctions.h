@@ -0,0 +1,710 @@
+#ifndef IG20261019111200
+#define IG20261019111200
+
+//* OpenGL 4.6 core functions as `X( type, name, major, minor )` entries,
+//* `name` without the "gl" prefix, `major.minor` the core version that introduced it
+//* Generated from lib/glad/glad.h, same order; regenerate together with it
+// clang-format off
+#define GLAD_GL_FUNCTIONS( X ) \
+    X( PFNGLCULLFACEPROC, CullFace, 1, 0 ) \
+    X( PFNGLFRONTFACEPROC, FrontFace, 1, 0 ) \
+    X( PFNGLHINTPROC, Hint, 1, 0 ) \
+    X( PFNGLLINEWIDTHPROC, LineWidth, 1, 0 ) \
+    X( PFNGLPOINTSIZEPROC, PointSize, 1, 0 ) \
+    X( PFNGLPOLYGONMODEPROC, PolygonMode, 1, 0 ) \
+    X( PFNGLSCISSORPROC, Scissor, 1, 0 ) \
+    X( PFNGLTEXPARAMETERFPROC, TexParameterf, 1, 0 ) \
+    X( PFNGLTEXPARAMETERFVPROC, TexParameterfv, 1, 0 ) \
+    X( PFNGLTEXPARAMETERIPROC, TexParameteri, 1, 0 ) \
+    X( PFNGLTEXPARAMETERIVPROC, TexParameteriv, 1, 0 ) \
+    X( PFNGLTEXIMAGE1DPROC, TexImage1D, 1, 0 ) \
+    X( PFNGLTEXIMAGE2DPROC, TexImage2D, 1, 0 ) \
+    X( PFNGLDRAWBUFFERPROC, DrawBuffer, 1, 0 ) \
+    X( PFNGLCLEARPROC, Clear, 1, 0 ) \
+    X( PFNGLCLEARCOLORPROC, ClearColor, 1, 0 ) \
+    X( PFNGLCLEARSTENCILPROC, ClearStencil, 1, 0 ) \
+    X( PFNGLCLEARDEPTHPROC, ClearDepth, 1, 0 ) \
+    X( PFNGLSTENCILMASKPROC, StencilMask, 1, 0 ) \
+    X( PFNGLCOLORMASKPROC, ColorMask, 1, 0 ) \
+    X( PFNGLDEPTHMASKPROC, DepthMask, 1, 0 ) \
+    X( PFNGLDISABLEPROC, Disable, 1, 0 ) \
+    X( PFNGLENABLEPROC, Enable, 1, 0 ) \
+    X( PFNGLFINISHPROC, Finish, 1, 0 ) \
+    X( PFNGLFLUSHPROC, Flush, 1, 0 ) \
+    X( PFNGLBLENDFUNCPROC, BlendFunc, 1, 0 ) \
+    X( PFNGLLOGICOPPROC, LogicOp, 1, 0 ) \
+    X( PFNGLSTENCILFUNCPROC, StencilFunc, 1, 0 ) \
+    X( PFNGLSTENCILOPPROC, StencilOp, 1, 0 ) \
+    X( PFNGLDEPTHFUNCPROC, DepthFunc, 1, 0 ) \
+    X( PFNGLPIXELSTOREFPROC, PixelStoref, 1, 0 ) \
+    X( PFNGLPIXELSTOREIPROC, PixelStorei, 1, 0 ) \
+    X( PFNGLREADBUFFERPROC, ReadBuffer, 1, 0 ) \
+    X( PFNGLREADPIXELSPROC, ReadPixels, 1, 0 ) \
+    X( PFNGLGETBOOLEANVPROC, GetBooleanv, 1, 0 ) \
+    X( PFNGLGETDOUBLEVPROC, GetDoublev, 1, 0 ) \
+    X( PFNGLGETERRORPROC, GetError, 1, 0 ) \
+    X( PFNGLGETFLOATVPROC, GetFloatv, 1, 0 ) \
+    X( PFNGLGETINTEGERVPROC, GetIntegerv, 1, 0 ) \
+    X( PFNGLGETSTRINGPROC, GetString, 1, 0 ) \
+    X( PFNGLGETTEXIMAGEPROC, GetTexImage, 1, 0 ) \
+    X( PFNGLGETTEXPARAMETERFVPROC, GetTexParameterfv, 1, 0 ) \
+    X( PFNGLGETTEXPARAMETERIVPROC, GetTexParameteriv, 1, 0 ) \
+    X( PFNGLGETTEXLEVELPARAMETERFVPROC, GetTexLevelParameterfv, 1, 0 ) \
+    X( PFNGLGETTEXLEVELPARAMETERIVPROC, GetTexLevelParameteriv, 1, 0 ) \
+    X( PFNGLISENABLEDPROC, IsEnabled, 1, 0 ) \
+    X( PFNGLDEPTHRANGEPROC, DepthRange, 1, 0 ) \
+    X( PFNGLVIEWPORTPROC, Viewport, 1, 0 ) \
+    X( PFNGLDRAWARRAYSPROC, DrawArrays, 1, 1 ) \
+    X( PFNGLDRAWELEMENTSPROC, DrawElements, 1, 1 ) \
+    X( PFNGLPOLYGONOFFSETPROC, PolygonOffset, 1, 1 ) \
+    X( PFNGLCOPYTEXIMAGE1DPROC, CopyTexImage1D, 1, 1 ) \
+    X( PFNGLCOPYTEXIMAGE2DPROC, CopyTexImage2D, 1, 1 ) \
+    X( PFNGLCOPYTEXSUBIMAGE1DPROC, CopyTexSubImage1D, 1, 1 ) \
+    X( PFNGLCOPYTEXSUBIMAGE2DPROC, CopyTexSubImage2D, 1, 1 ) \
+    X( PFNGLTEXSUBIMAGE1DPROC, TexSubImage1D, 1, 1 ) \
+    X( PFNGLTEXSUBIMAGE2DPROC, TexSubImage2D, 1, 1 ) \
+    X( PFNGLBINDTEXTUREPROC, BindTexture, 1, 1 ) \
+    X( PFNGLDELETETEXTURESPROC, DeleteTextures, 1, 1 ) \
+    X( PFNGLGENTEXTURESPROC, GenTextures, 1, 1 ) \
+    X( PFNGLISTEXTUREPROC, IsTexture, 1, 1 ) \
+    X( PFNGLDRAWRANGEELEMENTSPROC, DrawRangeElements, 1, 2 ) \
+    X( PFNGLTEXIMAGE3DPROC, TexImage3D, 1, 2 ) \
+    X( PFNGLTEXSUBIMAGE3DPROC, TexSubImage3D, 1, 2 ) \
+    X( PFNGLCOPYTEXSUBIMAGE3DPROC, CopyTexSubImage3D, 1, 2 ) \
+    X( PFNGLACTIVETEXTUREPROC, ActiveTexture, 1, 3 ) \
+    X( PFNGLSAMPLECOVERAGEPROC, SampleCoverage, 1, 3 ) \
+    X( PFNGLCOMPRESSEDTEXIMAGE3DPROC, CompressedTexImage3D, 1, 3 ) \
+    X( PFNGLCOMPRESSEDTEXIMAGE2DPROC, CompressedTexImage2D, 1, 3 ) \
+    X( PFNGLCOMPRESSEDTEXIMAGE1DPROC, CompressedTexImage1D, 1, 3 ) \
+    X( PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, CompressedTexSubImage3D, 1, 3 ) \
+    X( PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, CompressedTexSubImage2D, 1, 3 ) \
+    X( PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, CompressedTexSubImage1D, 1, 3 ) \
+    X( PFNGLGETCOMPRESSEDTEXIMAGEPROC, GetCompressedTexImage, 1, 3 ) \
+    X( PFNGLBLENDFUNCSEPARATEPROC, BlendFuncSeparate, 1, 4 ) \
+    X( PFNGLMULTIDRAWARRAYSPROC, MultiDrawArrays, 1, 4 ) \
+    X( PFNGLMULTIDRAWELEMENTSPROC, MultiDrawElements, 1, 4 ) \
+    X( PFNGLPOINTPARAMETERFPROC, PointParameterf, 1, 4 ) \
+    X( PFNGLPOINTPARAMETERFVPROC, PointParameterfv, 1, 4 ) \
+    X( PFNGLPOINTPARAMETERIPROC, PointParameteri, 1, 4 ) \
+    X( PFNGLPOINTPARAMETERIVPROC, PointParameteriv, 1, 4 ) \
+    X( PFNGLBLENDCOLORPROC, BlendColor, 1, 4 ) \
+    X( PFNGLBLENDEQUATIONPROC, BlendEquation, 1, 4 ) \
+    X( PFNGLGENQUERIESPROC, GenQueries, 1, 5 ) \
+    X( PFNGLDELETEQUERIESPROC, DeleteQueries, 1, 5 ) \
+    X( PFNGLISQUERYPROC, IsQuery, 1, 5 ) \
+    X( PFNGLBEGINQUERYPROC, BeginQuery, 1, 5 ) \
+    X( PFNGLENDQUERYPROC, EndQuery, 1, 5 ) \
+    X( PFNGLGETQUERYIVPROC, GetQueryiv, 1, 5 ) \
+    X( PFNGLGETQUERYOBJECTIVPROC, GetQueryObjectiv, 1, 5 ) \
+    X( PFNGLGETQUERYOBJECTUIVPROC, GetQueryObjectuiv, 1, 5 ) \
+    X( PFNGLBINDBUFFERPROC, BindBuffer, 1, 5 ) \
+    X( PFNGLDELETEBUFFERSPROC, DeleteBuffers, 1, 5 ) \
+    X( PFNGLGENBUFFERSPROC, GenBuffers, 1, 5 ) \
+    X( PFNGLISBUFFERPROC, IsBuffer, 1, 5 ) \
+    X( PFNGLBUFFERDATAPROC, BufferData, 1, 5 ) \
+    X( PFNGLBUFFERSUBDATAPROC, BufferSubData, 1, 5 ) \
+    X( PFNGLGETBUFFERSUBDATAPROC, GetBufferSubData, 1, 5 ) \
+    X( PFNGLMAPBUFFERPROC, MapBuffer, 1, 5 ) \
+    X( PFNGLUNMAPBUFFERPROC, UnmapBuffer, 1, 5 ) \
+    X( PFNGLGETBUFFERPARAMETERIVPROC, GetBufferParameteriv, 1, 5 ) \
+    X( PFNGLGETBUFFERPOINTERVPROC, GetBufferPointerv, 1, 5 ) \
+    X( PFNGLBLENDEQUATIONSEPARATEPROC, BlendEquationSeparate, 2, 0 ) \
+    X( PFNGLDRAWBUFFERSPROC, DrawBuffers, 2, 0 ) \
+    X( PFNGLSTENCILOPSEPARATEPROC, StencilOpSeparate, 2, 0 ) \
+    X( PFNGLSTENCILFUNCSEPARATEPROC, StencilFuncSeparate, 2, 0 ) \
+    X( PFNGLSTENCILMASKSEPARATEPROC, StencilMaskSeparate, 2, 0 ) \
+    X( PFNGLATTACHSHADERPROC, AttachShader, 2, 0 ) \
+    X( PFNGLBINDATTRIBLOCATIONPROC, BindAttribLocation, 2, 0 ) \
+    X( PFNGLCOMPILESHADERPROC, CompileShader, 2, 0 ) \
+    X( PFNGLCREATEPROGRAMPROC, CreateProgram, 2, 0 ) \
+    X( PFNGLCREATESHADERPROC, CreateShader, 2, 0 ) \
+    X( PFNGLDELETEPROGRAMPROC, DeleteProgram, 2, 0 ) \
+    X( PFNGLDELETESHADERPROC, DeleteShader, 2, 0 ) \
+    X( PFNGLDETACHSHADERPROC, DetachShader, 2, 0 ) \
+    X( PFNGLDISABLEVERTEXATTRIBARRAYPROC, DisableVertexAttribArray, 2, 0 ) \
+    X( PFNGLENABLEVERTEXATTRIBARRAYPROC, EnableVertexAttribArray, 2, 0 ) \
+    X( PFNGLGETACTIVEATTRIBPROC, GetActiveAttrib, 2, 0 ) \
+    X( PFNGLGETACTIVEUNIFORMPROC, GetActiveUniform, 2, 0 ) \
+    X( PFNGLGETATTACHEDSHADERSPROC, GetAttachedShaders, 2, 0 ) \
+    X( PFNGLGETATTRIBLOCATIONPROC, GetAttribLocation, 2, 0 ) \
+    X( PFNGLGETPROGRAMIVPROC, GetProgramiv, 2, 0 ) \
+    X( PFNGLGETPROGRAMINFOLOGPROC, GetProgramInfoLog, 2, 0 ) \
+    X( PFNGLGETSHADERIVPROC, GetShaderiv, 2, 0 ) \
+    X( PFNGLGETSHADERINFOLOGPROC, GetShaderInfoLog, 2, 0 ) \
+    X( PFNGLGETSHADERSOURCEPROC, GetShaderSource, 2, 0 ) \
+    X( PFNGLGETUNIFORMLOCATIONPROC, GetUniformLocation, 2, 0 ) \
+    X( PFNGLGETUNIFORMFVPROC, GetUniformfv, 2, 0 ) \
+    X( PFNGLGETUNIFORMIVPROC, GetUniformiv, 2, 0 ) \
+    X( PFNGLGETVERTEXATTRIBDVPROC, GetVertexAttribdv, 2, 0 ) \
+    X( PFNGLGETVERTEXATTRIBFVPROC, GetVertexAttribfv, 2, 0 ) \
+    X( PFNGLGETVERTEXATTRIBIVPROC, GetVertexAttribiv, 2, 0 ) \
+    X( PFNGLGETVERTEXATTRIBPOINTERVPROC, GetVertexAttribPointerv, 2, 0 ) \
+    X( PFNGLISPROGRAMPROC, IsProgram, 2, 0 ) \
+    X( PFNGLISSHADERPROC, IsShader, 2, 0 ) \
+    X( PFNGLLINKPROGRAMPROC, LinkProgram, 2, 0 ) \
+    X( PFNGLSHADERSOURCEPROC, ShaderSource, 2, 0 ) \
+    X( PFNGLUSEPROGRAMPROC, UseProgram, 2, 0 ) \
+    X( PFNGLUNIFORM1FPROC, Uniform1f, 2, 0 ) \
+    X( PFNGLUNIFORM2FPROC, Uniform2f, 2, 0 ) \
+    X( PFNGLUNIFORM3FPROC, Uniform3f, 2, 0 ) \
+    X( PFNGLUNIFORM4FPROC, Uniform4f, 2, 0 ) \
+    X( PFNGLUNIFORM1IPROC, Uniform1i, 2, 0 ) \
+    X( PFNGLUNIFORM2IPROC, Uniform2i, 2, 0 ) \
+    X( PFNGLUNIFORM3IPROC, Uniform3i, 2, 0 ) \
+    X( PFNGLUNIFORM4IPROC, Uniform4i, 2, 0 ) \
+    X( PFNGLUNIFORM1FVPROC, Uniform1fv, 2, 0 ) \
+    X( PFNGLUNIFORM2FVPROC, Uniform2fv, 2, 0 ) \
+    X( PFNGLUNIFORM3FVPROC, Uniform3fv, 2, 0 ) \
+    X( PFNGLUNIFORM4FVPROC, Uniform4fv, 2, 0 ) \
+    X( PFNGLUNIFORM1IVPROC, Uniform1iv, 2, 0 ) \
+    X( PFNGLUNIFORM2IVPROC, Uniform2iv, 2, 0 ) \
+    X( PFNGLUNIFORM3IVPROC, Uniform3iv, 2, 0 ) \
+    X( PFNGLUNIFORM4IVPROC, Uniform4iv, 2, 0 ) \
+    X( PFNGLUNIFORMMATRIX2FVPROC, UniformMatrix2fv, 2, 0 ) \
+    X( PFNGLUNIFORMMATRIX3FVPROC, UniformMatrix3fv, 2, 0 ) \
+    X( PFNGLUNIFORMMATRIX4FVPROC, UniformMatrix4fv, 2, 0 ) \
+    X( PFNGLVALIDATEPROGRAMPROC, ValidateProgram, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB1DPROC, VertexAttrib1d, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB1DVPROC, VertexAttrib1dv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB1FPROC, VertexAttrib1f, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB1FVPROC, VertexAttrib1fv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB1SPROC, VertexAttrib1s, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB1SVPROC, VertexAttrib1sv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB2DPROC, VertexAttrib2d, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB2DVPROC, VertexAttrib2dv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB2FPROC, VertexAttrib2f, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB2FVPROC, VertexAttrib2fv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB2SPROC, VertexAttrib2s, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB2SVPROC, VertexAttrib2sv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB3DPROC, VertexAttrib3d, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB3DVPROC, VertexAttrib3dv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB3FPROC, VertexAttrib3f, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB3FVPROC, VertexAttrib3fv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB3SPROC, VertexAttrib3s, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB3SVPROC, VertexAttrib3sv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4NBVPROC, VertexAttrib4Nbv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4NIVPROC, VertexAttrib4Niv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4NSVPROC, VertexAttrib4Nsv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4NUBPROC, VertexAttrib4Nub, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4NUBVPROC, VertexAttrib4Nubv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4NUIVPROC, VertexAttrib4Nuiv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4NUSVPROC, VertexAttrib4Nusv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4BVPROC, VertexAttrib4bv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4DPROC, VertexAttrib4d, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4DVPROC, VertexAttrib4dv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4FPROC, VertexAttrib4f, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4FVPROC, VertexAttrib4fv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4IVPROC, VertexAttrib4iv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4SPROC, VertexAttrib4s, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4SVPROC, VertexAttrib4sv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4UBVPROC, VertexAttrib4ubv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4UIVPROC, VertexAttrib4uiv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIB4USVPROC, VertexAttrib4usv, 2, 0 ) \
+    X( PFNGLVERTEXATTRIBPOINTERPROC, VertexAttribPointer, 2, 0 ) \
+    X( PFNGLUNIFORMMATRIX2X3FVPROC, UniformMatrix2x3fv, 2, 1 ) \
+    X( PFNGLUNIFORMMATRIX3X2FVPROC, UniformMatrix3x2fv, 2, 1 ) \
+    X( PFNGLUNIFORMMATRIX2X4FVPROC, UniformMatrix2x4fv, 2, 1 ) \
+    X( PFNGLUNIFORMMATRIX4X2FVPROC, UniformMatrix4x2fv, 2, 1 ) \
+    X( PFNGLUNIFORMMATRIX3X4FVPROC, UniformMatrix3x4fv, 2, 1 ) \
+    X( PFNGLUNIFORMMATRIX4X3FVPROC, UniformMatrix4x3fv, 2, 1 ) \
+    X( PFNGLCOLORMASKIPROC, ColorMaski, 3, 0 ) \
+    X( PFNGLGETBOOLEANI_VPROC, GetBooleani_v, 3, 0 ) \
+    X( PFNGLGETINTEGERI_VPROC, GetIntegeri_v, 3, 0 ) \
+    X( PFNGLENABLEIPROC, Enablei, 3, 0 ) \
+    X( PFNGLDISABLEIPROC, Disablei, 3, 0 ) \
+    X( PFNGLISENABLEDIPROC, IsEnabledi, 3, 0 ) \
+    X( PFNGLBEGINTRANSFORMFEEDBACKPROC, BeginTransformFeedback, 3, 0 ) \
+    X( PFNGLENDTRANSFORMFEEDBACKPROC, EndTransformFeedback, 3, 0 ) \
+    X( PFNGLBINDBUFFERRANGEPROC, BindBufferRange, 3, 0 ) \
+    X( PFNGLBINDBUFFERBASEPROC, BindBufferBase, 3, 0 ) \
+    X( PFNGLTRANSFORMFEEDBACKVARYINGSPROC, TransformFeedbackVaryings, 3, 0 ) \
+    X( PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, GetTransformFeedbackVarying, 3, 0 ) \
+    X( PFNGLCLAMPCOLORPROC, ClampColor, 3, 0 ) \
+    X( PFNGLBEGINCONDITIONALRENDERPROC, BeginConditionalRender, 3, 0 ) \
+    X( PFNGLENDCONDITIONALRENDERPROC, EndConditionalRender, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBIPOINTERPROC, VertexAttribIPointer, 3, 0 ) \
+    X( PFNGLGETVERTEXATTRIBIIVPROC, GetVertexAttribIiv, 3, 0 ) \
+    X( PFNGLGETVERTEXATTRIBIUIVPROC, GetVertexAttribIuiv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI1IPROC, VertexAttribI1i, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI2IPROC, VertexAttribI2i, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI3IPROC, VertexAttribI3i, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI4IPROC, VertexAttribI4i, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI1UIPROC, VertexAttribI1ui, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI2UIPROC, VertexAttribI2ui, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI3UIPROC, VertexAttribI3ui, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI4UIPROC, VertexAttribI4ui, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI1IVPROC, VertexAttribI1iv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI2IVPROC, VertexAttribI2iv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI3IVPROC, VertexAttribI3iv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI4IVPROC, VertexAttribI4iv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI1UIVPROC, VertexAttribI1uiv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI2UIVPROC, VertexAttribI2uiv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI3UIVPROC, VertexAttribI3uiv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI4UIVPROC, VertexAttribI4uiv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI4BVPROC, VertexAttribI4bv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI4SVPROC, VertexAttribI4sv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI4UBVPROC, VertexAttribI4ubv, 3, 0 ) \
+    X( PFNGLVERTEXATTRIBI4USVPROC, VertexAttribI4usv, 3, 0 ) \
+    X( PFNGLGETUNIFORMUIVPROC, GetUniformuiv, 3, 0 ) \
+    X( PFNGLBINDFRAGDATALOCATIONPROC, BindFragDataLocation, 3, 0 ) \
+    X( PFNGLGETFRAGDATALOCATIONPROC, GetFragDataLocation, 3, 0 ) \
+    X( PFNGLUNIFORM1UIPROC, Uniform1ui, 3, 0 ) \
+    X( PFNGLUNIFORM2UIPROC, Uniform2ui, 3, 0 ) \
+    X( PFNGLUNIFORM3UIPROC, Uniform3ui, 3, 0 ) \
+    X( PFNGLUNIFORM4UIPROC, Uniform4ui, 3, 0 ) \
+    X( PFNGLUNIFORM1UIVPROC, Uniform1uiv, 3, 0 ) \
+    X( PFNGLUNIFORM2UIVPROC, Uniform2uiv, 3, 0 ) \
+    X( PFNGLUNIFORM3UIVPROC, Uniform3uiv, 3, 0 ) \
+    X( PFNGLUNIFORM4UIVPROC, Uniform4uiv, 3, 0 ) \
+    X( PFNGLTEXPARAMETERIIVPROC, TexParameterIiv, 3, 0 ) \
+    X( PFNGLTEXPARAMETERIUIVPROC, TexParameterIuiv, 3, 0 ) \
+    X( PFNGLGETTEXPARAMETERIIVPROC, GetTexParameterIiv, 3, 0 ) \
+    X( PFNGLGETTEXPARAMETERIUIVPROC, GetTexParameterIuiv, 3, 0 ) \
+    X( PFNGLCLEARBUFFERIVPROC, ClearBufferiv, 3, 0 ) \
+    X( PFNGLCLEARBUFFERUIVPROC, ClearBufferuiv, 3, 0 ) \
+    X( PFNGLCLEARBUFFERFVPROC, ClearBufferfv, 3, 0 ) \
+    X( PFNGLCLEARBUFFERFIPROC, ClearBufferfi, 3, 0 ) \
+    X( PFNGLGETSTRINGIPROC, GetStringi, 3, 0 ) \
+    X( PFNGLISRENDERBUFFERPROC, IsRenderbuffer, 3, 0 ) \
+    X( PFNGLBINDRENDERBUFFERPROC, BindRenderbuffer, 3, 0 ) \
+    X( PFNGLDELETERENDERBUFFERSPROC, DeleteRenderbuffers, 3, 0 ) \
+    X( PFNGLGENRENDERBUFFERSPROC, GenRenderbuffers, 3, 0 ) \
+    X( PFNGLRENDERBUFFERSTORAGEPROC, RenderbufferStorage, 3, 0 ) \
+    X( PFNGLGETRENDERBUFFERPARAMETERIVPROC, GetRenderbufferParameteriv, 3, 0 ) \
+    X( PFNGLISFRAMEBUFFERPROC, IsFramebuffer, 3, 0 ) \
+    X( PFNGLBINDFRAMEBUFFERPROC, BindFramebuffer, 3, 0 ) \
+    X( PFNGLDELETEFRAMEBUFFERSPROC, DeleteFramebuffers, 3, 0 ) \
+    X( PFNGLGENFRAMEBUFFERSPROC, GenFramebuffers, 3, 0 ) \
+    X( PFNGLCHECKFRAMEBUFFERSTATUSPROC, CheckFramebufferStatus, 3, 0 ) \
+    X( PFNGLFRAMEBUFFERTEXTURE1DPROC, FramebufferTexture1D, 3, 0 ) \
+    X( PFNGLFRAMEBUFFERTEXTURE2DPROC, FramebufferTexture2D, 3, 0 ) \
+    X( PFNGLFRAMEBUFFERTEXTURE3DPROC, FramebufferTexture3D, 3, 0 ) \
+    X( PFNGLFRAMEBUFFERRENDERBUFFERPROC, FramebufferRenderbuffer, 3, 0 ) \
+    X( PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, GetFramebufferAttachmentParameteriv, 3, 0 ) \
+    X( PFNGLGENERATEMIPMAPPROC, GenerateMipmap, 3, 0 ) \
+    X( PFNGLBLITFRAMEBUFFERPROC, BlitFramebuffer, 3, 0 ) \
+    X( PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, RenderbufferStorageMultisample, 3, 0 ) \
+    X( PFNGLFRAMEBUFFERTEXTURELAYERPROC, FramebufferTextureLayer, 3, 0 ) \
+    X( PFNGLMAPBUFFERRANGEPROC, MapBufferRange, 3, 0 ) \
+    X( PFNGLFLUSHMAPPEDBUFFERRANGEPROC, FlushMappedBufferRange, 3, 0 ) \
+    X( PFNGLBINDVERTEXARRAYPROC, BindVertexArray, 3, 0 ) \
+    X( PFNGLDELETEVERTEXARRAYSPROC, DeleteVertexArrays, 3, 0 ) \
+    X( PFNGLGENVERTEXARRAYSPROC, GenVertexArrays, 3, 0 ) \
+    X( PFNGLISVERTEXARRAYPROC, IsVertexArray, 3, 0 ) \
+    X( PFNGLDRAWARRAYSINSTANCEDPROC, DrawArraysInstanced, 3, 1 ) \
+    X( PFNGLDRAWELEMENTSINSTANCEDPROC, DrawElementsInstanced, 3, 1 ) \
+    X( PFNGLTEXBUFFERPROC, TexBuffer, 3, 1 ) \
+    X( PFNGLPRIMITIVERESTARTINDEXPROC, PrimitiveRestartIndex, 3, 1 ) \
+    X( PFNGLCOPYBUFFERSUBDATAPROC, CopyBufferSubData, 3, 1 ) \
+    X( PFNGLGETUNIFORMINDICESPROC, GetUniformIndices, 3, 1 ) \
+    X( PFNGLGETACTIVEUNIFORMSIVPROC, GetActiveUniformsiv, 3, 1 ) \
+    X( PFNGLGETACTIVEUNIFORMNAMEPROC, GetActiveUniformName, 3, 1 ) \
+    X( PFNGLGETUNIFORMBLOCKINDEXPROC, GetUniformBlockIndex, 3, 1 ) \
+    X( PFNGLGETACTIVEUNIFORMBLOCKIVPROC, GetActiveUniformBlockiv, 3, 1 ) \
+    X( PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, GetActiveUniformBlockName, 3, 1 ) \
+    X( PFNGLUNIFORMBLOCKBINDINGPROC, UniformBlockBinding, 3, 1 ) \
+    X( PFNGLDRAWELEMENTSBASEVERTEXPROC, DrawElementsBaseVertex, 3, 2 ) \
+    X( PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, DrawRangeElementsBaseVertex, 3, 2 ) \
+    X( PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, DrawElementsInstancedBaseVertex, 3, 2 ) \
+    X( PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, MultiDrawElementsBaseVertex, 3, 2 ) \
+    X( PFNGLPROVOKINGVERTEXPROC, ProvokingVertex, 3, 2 ) \
+    X( PFNGLFENCESYNCPROC, FenceSync, 3, 2 ) \
+    X( PFNGLISSYNCPROC, IsSync, 3, 2 ) \
+    X( PFNGLDELETESYNCPROC, DeleteSync, 3, 2 ) \
+    X( PFNGLCLIENTWAITSYNCPROC, ClientWaitSync, 3, 2 ) \
+    X( PFNGLWAITSYNCPROC, WaitSync, 3, 2 ) \
+    X( PFNGLGETINTEGER64VPROC, GetInteger64v, 3, 2 ) \
+    X( PFNGLGETSYNCIVPROC, GetSynciv, 3, 2 ) \
+    X( PFNGLGETINTEGER64I_VPROC, GetInteger64i_v, 3, 2 ) \
+    X( PFNGLGETBUFFERPARAMETERI64VPROC, GetBufferParameteri64v, 3, 2 ) \
+    X( PFNGLFRAMEBUFFERTEXTUREPROC, FramebufferTexture, 3, 2 ) \
+    X( PFNGLTEXIMAGE2DMULTISAMPLEPROC, TexImage2DMultisample, 3, 2 ) \
+    X( PFNGLTEXIMAGE3DMULTISAMPLEPROC, TexImage3DMultisample, 3, 2 ) \
+    X( PFNGLGETMULTISAMPLEFVPROC, GetMultisamplefv, 3, 2 ) \
+    X( PFNGLSAMPLEMASKIPROC, SampleMaski, 3, 2 ) \
+    X( PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, BindFragDataLocationIndexed, 3, 3 ) \
+    X( PFNGLGETFRAGDATAINDEXPROC, GetFragDataIndex, 3, 3 ) \
+    X( PFNGLGENSAMPLERSPROC, GenSamplers, 3, 3 ) \
+    X( PFNGLDELETESAMPLERSPROC, DeleteSamplers, 3, 3 ) \
+    X( PFNGLISSAMPLERPROC, IsSampler, 3, 3 ) \
+    X( PFNGLBINDSAMPLERPROC, BindSampler, 3, 3 ) \
+    X( PFNGLSAMPLERPARAMETERIPROC, SamplerParameteri, 3, 3 ) \
+    X( PFNGLSAMPLERPARAMETERIVPROC, SamplerParameteriv, 3, 3 ) \
+    X( PFNGLSAMPLERPARAMETERFPROC, SamplerParameterf, 3, 3 ) \
+    X( PFNGLSAMPLERPARAMETERFVPROC, SamplerParameterfv, 3, 3 ) \
+    X( PFNGLSAMPLERPARAMETERIIVPROC, SamplerParameterIiv, 3, 3 ) \
+    X( PFNGLSAMPLERPARAMETERIUIVPROC, SamplerParameterIuiv, 3, 3 ) \
+    X( PFNGLGETSAMPLERPARAMETERIVPROC, GetSamplerParameteriv, 3, 3 ) \
+    X( PFNGLGETSAMPLERPARAMETERIIVPROC, GetSamplerParameterIiv, 3, 3 ) \
+    X( PFNGLGETSAMPLERPARAMETERFVPROC, GetSamplerParameterfv, 3, 3 ) \
+    X( PFNGLGETSAMPLERPARAMETERIUIVPROC, GetSamplerParameterIuiv, 3, 3 ) \
+    X( PFNGLQUERYCOUNTERPROC, QueryCounter, 3, 3 ) \
+    X( PFNGLGETQUERYOBJECTI64VPROC, GetQueryObjecti64v, 3, 3 ) \
+    X( PFNGLGETQUERYOBJECTUI64VPROC, GetQueryObjectui64v, 3, 3 ) \
+    X( PFNGLVERTEXATTRIBDIVISORPROC, VertexAttribDivisor, 3, 3 ) \
+    X( PFNGLVERTEXATTRIBP1UIPROC, VertexAttribP1ui, 3, 3 ) \
+    X( PFNGLVERTEXATTRIBP1UIVPROC, VertexAttribP1uiv, 3, 3 ) \
+    X( PFNGLVERTEXATTRIBP2UIPROC, VertexAttribP2ui, 3, 3 ) \
+    X( PFNGLVERTEXATTRIBP2UIVPROC, VertexAttribP2uiv, 3, 3 ) \
+    X( PFNGLVERTEXATTRIBP3UIPROC, VertexAttribP3ui, 3, 3 ) \
+    X( PFNGLVERTEXATTRIBP3UIVPROC, VertexAttribP3uiv, 3, 3 ) \
+    X( PFNGLVERTEXATTRIBP4UIPROC, VertexAttribP4ui, 3, 3 ) \
+    X( PFNGLVERTEXATTRIBP4UIVPROC, VertexAttribP4uiv, 3, 3 ) \
+    X( PFNGLVERTEXP2UIPROC, VertexP2ui, 3, 3 ) \
+    X( PFNGLVERTEXP2UIVPROC, VertexP2uiv, 3, 3 ) \
+    X( PFNGLVERTEXP3UIPROC, VertexP3ui, 3, 3 ) \
+    X( PFNGLVERTEXP3UIVPROC, VertexP3uiv, 3, 3 ) \
+    X( PFNGLVERTEXP4UIPROC, VertexP4ui, 3, 3 ) \
+    X( PFNGLVERTEXP4UIVPROC, VertexP4uiv, 3, 3 ) \
+    X( PFNGLTEXCOORDP1UIPROC, TexCoordP1ui, 3, 3 ) \
+    X( PFNGLTEXCOORDP1UIVPROC, TexCoordP1uiv, 3, 3 ) \
+    X( PFNGLTEXCOORDP2UIPROC, TexCoordP2ui, 3, 3 ) \
+    X( PFNGLTEXCOORDP2UIVPROC, TexCoordP2uiv, 3, 3 ) \
+    X( PFNGLTEXCOORDP3UIPROC, TexCoordP3ui, 3, 3 ) \
+    X( PFNGLTEXCOORDP3UIVPROC, TexCoordP3uiv, 3, 3 ) \
+    X( PFNGLTEXCOORDP4UIPROC, TexCoordP4ui, 3, 3 ) \
+    X( PFNGLTEXCOORDP4UIVPROC, TexCoordP4uiv, 3, 3 ) \
+    X( PFNGLMULTITEXCOORDP1UIPROC, MultiTexCoordP1ui, 3, 3 ) \
+    X( PFNGLMULTITEXCOORDP1UIVPROC, MultiTexCoordP1uiv, 3, 3 ) \
+    X( PFNGLMULTITEXCOORDP2UIPROC, MultiTexCoordP2ui, 3, 3 ) \
+    X( PFNGLMULTITEXCOORDP2UIVPROC, MultiTexCoordP2uiv, 3, 3 ) \
+    X( PFNGLMULTITEXCOORDP3UIPROC, MultiTexCoordP3ui, 3, 3 ) \
+    X( PFNGLMULTITEXCOORDP3UIVPROC, MultiTexCoordP3uiv, 3, 3 ) \
+    X( PFNGLMULTITEXCOORDP4UIPROC, MultiTexCoordP4ui, 3, 3 ) \
+    X( PFNGLMULTITEXCOORDP4UIVPROC, MultiTexCoordP4uiv, 3, 3 ) \
+    X( PFNGLNORMALP3UIPROC, NormalP3ui, 3, 3 ) \
+    X( PFNGLNORMALP3UIVPROC, NormalP3uiv, 3, 3 ) \
+    X( PFNGLCOLORP3UIPROC, ColorP3ui, 3, 3 ) \
+    X( PFNGLCOLORP3UIVPROC, ColorP3uiv, 3, 3 ) \
+    X( PFNGLCOLORP4UIPROC, ColorP4ui, 3, 3 ) \
+    X( PFNGLCOLORP4UIVPROC, ColorP4uiv, 3, 3 ) \
+    X( PFNGLSECONDARYCOLORP3UIPROC, SecondaryColorP3ui, 3, 3 ) \
+    X( PFNGLSECONDARYCOLORP3UIVPROC, SecondaryColorP3uiv, 3, 3 ) \
+    X( PFNGLMINSAMPLESHADINGPROC, MinSampleShading, 4, 0 ) \
+    X( PFNGLBLENDEQUATIONIPROC, BlendEquationi, 4, 0 ) \
+    X( PFNGLBLENDEQUATIONSEPARATEIPROC, BlendEquationSeparatei, 4, 0 ) \
+    X( PFNGLBLENDFUNCIPROC, BlendFunci, 4, 0 ) \
+    X( PFNGLBLENDFUNCSEPARATEIPROC, BlendFuncSeparatei, 4, 0 ) \
+    X( PFNGLDRAWARRAYSINDIRECTPROC, DrawArraysIndirect, 4, 0 ) \
+    X( PFNGLDRAWELEMENTSINDIRECTPROC, DrawElementsIndirect, 4, 0 ) \
+    X( PFNGLUNIFORM1DPROC, Uniform1d, 4, 0 ) \
+    X( PFNGLUNIFORM2DPROC, Uniform2d, 4, 0 ) \
+    X( PFNGLUNIFORM3DPROC, Uniform3d, 4, 0 ) \
+    X( PFNGLUNIFORM4DPROC, Uniform4d, 4, 0 ) \
+    X( PFNGLUNIFORM1DVPROC, Uniform1dv, 4, 0 ) \
+    X( PFNGLUNIFORM2DVPROC, Uniform2dv, 4, 0 ) \
+    X( PFNGLUNIFORM3DVPROC, Uniform3dv, 4, 0 ) \
+    X( PFNGLUNIFORM4DVPROC, Uniform4dv, 4, 0 ) \
+    X( PFNGLUNIFORMMATRIX2DVPROC, UniformMatrix2dv, 4, 0 ) \
+    X( PFNGLUNIFORMMATRIX3DVPROC, UniformMatrix3dv, 4, 0 ) \
+    X( PFNGLUNIFORMMATRIX4DVPROC, UniformMatrix4dv, 4, 0 ) \
+    X( PFNGLUNIFORMMATRIX2X3DVPROC, UniformMatrix2x3dv, 4, 0 ) \
+    X( PFNGLUNIFORMMATRIX2X4DVPROC, UniformMatrix2x4dv, 4, 0 ) \
+    X( PFNGLUNIFORMMATRIX3X2DVPROC, UniformMatrix3x2dv, 4, 0 ) \
+    X( PFNGLUNIFORMMATRIX3X4DVPROC, UniformMatrix3x4dv, 4, 0 ) \
+    X( PFNGLUNIFORMMATRIX4X2DVPROC, UniformMatrix4x2dv, 4, 0 ) \
+    X( PFNGLUNIFORMMATRIX4X3DVPROC, UniformMatrix4x3dv, 4, 0 ) \
+    X( PFNGLGETUNIFORMDVPROC, GetUniformdv, 4, 0 ) \
+    X( PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, GetSubroutineUniformLocation, 4, 0 ) \
+    X( PFNGLGETSUBROUTINEINDEXPROC, GetSubroutineIndex, 4, 0 ) \
+    X( PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, GetActiveSubroutineUniformiv, 4, 0 ) \
+    X( PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, GetActiveSubroutineUniformName, 4, 0 ) \
+    X( PFNGLGETACTIVESUBROUTINENAMEPROC, GetActiveSubroutineName, 4, 0 ) \
+    X( PFNGLUNIFORMSUBROUTINESUIVPROC, UniformSubroutinesuiv, 4, 0 ) \
+    X( PFNGLGETUNIFORMSUBROUTINEUIVPROC, GetUniformSubroutineuiv, 4, 0 ) \
+    X( PFNGLGETPROGRAMSTAGEIVPROC, GetProgramStageiv, 4, 0 ) \
+    X( PFNGLPATCHPARAMETERIPROC, PatchParameteri, 4, 0 ) \
+    X( PFNGLPATCHPARAMETERFVPROC, PatchParameterfv, 4, 0 ) \
+    X( PFNGLBINDTRANSFORMFEEDBACKPROC, BindTransformFeedback, 4, 0 ) \
+    X( PFNGLDELETETRANSFORMFEEDBACKSPROC, DeleteTransformFeedbacks, 4, 0 ) \
+    X( PFNGLGENTRANSFORMFEEDBACKSPROC, GenTransformFeedbacks, 4, 0 ) \
+    X( PFNGLISTRANSFORMFEEDBACKPROC, IsTransformFeedback, 4, 0 ) \
+    X( PFNGLPAUSETRANSFORMFEEDBACKPROC, PauseTransformFeedback, 4, 0 ) \
+    X( PFNGLRESUMETRANSFORMFEEDBACKPROC, ResumeTransformFeedback, 4, 0 ) \
+    X( PFNGLDRAWTRANSFORMFEEDBACKPROC, DrawTransformFeedback, 4, 0 ) \
+    X( PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, DrawTransformFeedbackStream, 4, 0 ) \
+    X( PFNGLBEGINQUERYINDEXEDPROC, BeginQueryIndexed, 4, 0 ) \
+    X( PFNGLENDQUERYINDEXEDPROC, EndQueryIndexed, 4, 0 ) \
+    X( PFNGLGETQUERYINDEXEDIVPROC, GetQueryIndexediv, 4, 0 ) \
+    X( PFNGLRELEASESHADERCOMPILERPROC, ReleaseShaderCompiler, 4, 1 ) \
+    X( PFNGLSHADERBINARYPROC, ShaderBinary, 4, 1 ) \
+    X( PFNGLGETSHADERPRECISIONFORMATPROC, GetShaderPrecisionFormat, 4, 1 ) \
+    X( PFNGLDEPTHRANGEFPROC, DepthRangef, 4, 1 ) \
+    X( PFNGLCLEARDEPTHFPROC, ClearDepthf, 4, 1 ) \
+    X( PFNGLGETPROGRAMBINARYPROC, GetProgramBinary, 4, 1 ) \
+    X( PFNGLPROGRAMBINARYPROC, ProgramBinary, 4, 1 ) \
+    X( PFNGLPROGRAMPARAMETERIPROC, ProgramParameteri, 4, 1 ) \
+    X( PFNGLUSEPROGRAMSTAGESPROC, UseProgramStages, 4, 1 ) \
+    X( PFNGLACTIVESHADERPROGRAMPROC, ActiveShaderProgram, 4, 1 ) \
+    X( PFNGLCREATESHADERPROGRAMVPROC, CreateShaderProgramv, 4, 1 ) \
+    X( PFNGLBINDPROGRAMPIPELINEPROC, BindProgramPipeline, 4, 1 ) \
+    X( PFNGLDELETEPROGRAMPIPELINESPROC, DeleteProgramPipelines, 4, 1 ) \
+    X( PFNGLGENPROGRAMPIPELINESPROC, GenProgramPipelines, 4, 1 ) \
+    X( PFNGLISPROGRAMPIPELINEPROC, IsProgramPipeline, 4, 1 ) \
+    X( PFNGLGETPROGRAMPIPELINEIVPROC, GetProgramPipelineiv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM1IPROC, ProgramUniform1i, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM1IVPROC, ProgramUniform1iv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM1FPROC, ProgramUniform1f, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM1FVPROC, ProgramUniform1fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM1DPROC, ProgramUniform1d, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM1DVPROC, ProgramUniform1dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM1UIPROC, ProgramUniform1ui, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM1UIVPROC, ProgramUniform1uiv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM2IPROC, ProgramUniform2i, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM2IVPROC, ProgramUniform2iv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM2FPROC, ProgramUniform2f, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM2FVPROC, ProgramUniform2fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM2DPROC, ProgramUniform2d, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM2DVPROC, ProgramUniform2dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM2UIPROC, ProgramUniform2ui, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM2UIVPROC, ProgramUniform2uiv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM3IPROC, ProgramUniform3i, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM3IVPROC, ProgramUniform3iv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM3FPROC, ProgramUniform3f, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM3FVPROC, ProgramUniform3fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM3DPROC, ProgramUniform3d, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM3DVPROC, ProgramUniform3dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM3UIPROC, ProgramUniform3ui, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM3UIVPROC, ProgramUniform3uiv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM4IPROC, ProgramUniform4i, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM4IVPROC, ProgramUniform4iv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM4FPROC, ProgramUniform4f, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM4FVPROC, ProgramUniform4fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM4DPROC, ProgramUniform4d, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM4DVPROC, ProgramUniform4dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM4UIPROC, ProgramUniform4ui, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORM4UIVPROC, ProgramUniform4uiv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX2FVPROC, ProgramUniformMatrix2fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX3FVPROC, ProgramUniformMatrix3fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX4FVPROC, ProgramUniformMatrix4fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX2DVPROC, ProgramUniformMatrix2dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX3DVPROC, ProgramUniformMatrix3dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX4DVPROC, ProgramUniformMatrix4dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, ProgramUniformMatrix2x3fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, ProgramUniformMatrix3x2fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, ProgramUniformMatrix2x4fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, ProgramUniformMatrix4x2fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, ProgramUniformMatrix3x4fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, ProgramUniformMatrix4x3fv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, ProgramUniformMatrix2x3dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, ProgramUniformMatrix3x2dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, ProgramUniformMatrix2x4dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, ProgramUniformMatrix4x2dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, ProgramUniformMatrix3x4dv, 4, 1 ) \
+    X( PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, ProgramUniformMatrix4x3dv, 4, 1 ) \
+    X( PFNGLVALIDATEPROGRAMPIPELINEPROC, ValidateProgramPipeline, 4, 1 ) \
+    X( PFNGLGETPROGRAMPIPELINEINFOLOGPROC, GetProgramPipelineInfoLog, 4, 1 ) \
+    X( PFNGLVERTEXATTRIBL1DPROC, VertexAttribL1d, 4, 1 ) \
+    X( PFNGLVERTEXATTRIBL2DPROC, VertexAttribL2d, 4, 1 ) \
+    X( PFNGLVERTEXATTRIBL3DPROC, VertexAttribL3d, 4, 1 ) \
+    X( PFNGLVERTEXATTRIBL4DPROC, VertexAttribL4d, 4, 1 ) \
+    X( PFNGLVERTEXATTRIBL1DVPROC, VertexAttribL1dv, 4, 1 ) \
+    X( PFNGLVERTEXATTRIBL2DVPROC, VertexAttribL2dv, 4, 1 ) \
+    X( PFNGLVERTEXATTRIBL3DVPROC, VertexAttribL3dv, 4, 1 ) \
+    X( PFNGLVERTEXATTRIBL4DVPROC, VertexAttribL4dv, 4, 1 ) \
+    X( PFNGLVERTEXATTRIBLPOINTERPROC, VertexAttribLPointer, 4, 1 ) \
+    X( PFNGLGETVERTEXATTRIBLDVPROC, GetVertexAttribLdv, 4, 1 ) \
+    X( PFNGLVIEWPORTARRAYVPROC, ViewportArrayv, 4, 1 ) \
+    X( PFNGLVIEWPORTINDEXEDFPROC, ViewportIndexedf, 4, 1 ) \
+    X( PFNGLVIEWPORTINDEXEDFVPROC, ViewportIndexedfv, 4, 1 ) \
+    X( PFNGLSCISSORARRAYVPROC, ScissorArrayv, 4, 1 ) \
+    X( PFNGLSCISSORINDEXEDPROC, ScissorIndexed, 4, 1 ) \
+    X( PFNGLSCISSORINDEXEDVPROC, ScissorIndexedv, 4, 1 ) \
+    X( PFNGLDEPTHRANGEARRAYVPROC, DepthRangeArrayv, 4, 1 ) \
+    X( PFNGLDEPTHRANGEINDEXEDPROC, DepthRangeIndexed, 4, 1 ) \
+    X( PFNGLGETFLOATI_VPROC, GetFloati_v, 4, 1 ) \
+    X( PFNGLGETDOUBLEI_VPROC, GetDoublei_v, 4, 1 ) \
+    X( PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, DrawArraysInstancedBaseInstance, 4, 2 ) \
+    X( PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, DrawElementsInstancedBaseInstance, 4, 2 ) \
+    X( PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, DrawElementsInstancedBaseVertexBaseInstance, 4, 2 ) \
+    X( PFNGLGETINTERNALFORMATIVPROC, GetInternalformativ, 4, 2 ) \
+    X( PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, GetActiveAtomicCounterBufferiv, 4, 2 ) \
+    X( PFNGLBINDIMAGETEXTUREPROC, BindImageTexture, 4, 2 ) \
+    X( PFNGLMEMORYBARRIERPROC, MemoryBarrier, 4, 2 ) \
+    X( PFNGLTEXSTORAGE1DPROC, TexStorage1D, 4, 2 ) \
+    X( PFNGLTEXSTORAGE2DPROC, TexStorage2D, 4, 2 ) \
+    X( PFNGLTEXSTORAGE3DPROC, TexStorage3D, 4, 2 ) \
+    X( PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, DrawTransformFeedbackInstanced, 4, 2 ) \
+    X( PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, DrawTransformFeedbackStreamInstanced, 4, 2 ) \
+    X( PFNGLCLEARBUFFERDATAPROC, ClearBufferData, 4, 3 ) \
+    X( PFNGLCLEARBUFFERSUBDATAPROC, ClearBufferSubData, 4, 3 ) \
+    X( PFNGLDISPATCHCOMPUTEPROC, DispatchCompute, 4, 3 ) \
+    X( PFNGLDISPATCHCOMPUTEINDIRECTPROC, DispatchComputeIndirect, 4, 3 ) \
+    X( PFNGLCOPYIMAGESUBDATAPROC, CopyImageSubData, 4, 3 ) \
+    X( PFNGLFRAMEBUFFERPARAMETERIPROC, FramebufferParameteri, 4, 3 ) \
+    X( PFNGLGETFRAMEBUFFERPARAMETERIVPROC, GetFramebufferParameteriv, 4, 3 ) \
+    X( PFNGLGETINTERNALFORMATI64VPROC, GetInternalformati64v, 4, 3 ) \
+    X( PFNGLINVALIDATETEXSUBIMAGEPROC, InvalidateTexSubImage, 4, 3 ) \
+    X( PFNGLINVALIDATETEXIMAGEPROC, InvalidateTexImage, 4, 3 ) \
+    X( PFNGLINVALIDATEBUFFERSUBDATAPROC, InvalidateBufferSubData, 4, 3 ) \
+    X( PFNGLINVALIDATEBUFFERDATAPROC, InvalidateBufferData, 4, 3 ) \
+    X( PFNGLINVALIDATEFRAMEBUFFERPROC, InvalidateFramebuffer, 4, 3 ) \
+    X( PFNGLINVALIDATESUBFRAMEBUFFERPROC, InvalidateSubFramebuffer, 4, 3 ) \
+    X( PFNGLMULTIDRAWARRAYSINDIRECTPROC, MultiDrawArraysIndirect, 4, 3 ) \
+    X( PFNGLMULTIDRAWELEMENTSINDIRECTPROC, MultiDrawElementsIndirect, 4, 3 ) \
+    X( PFNGLGETPROGRAMINTERFACEIVPROC, GetProgramInterfaceiv, 4, 3 ) \
+    X( PFNGLGETPROGRAMRESOURCEINDEXPROC, GetProgramResourceIndex, 4, 3 ) \
+    X( PFNGLGETPROGRAMRESOURCENAMEPROC, GetProgramResourceName, 4, 3 ) \
+    X( PFNGLGETPROGRAMRESOURCEIVPROC, GetProgramResourceiv, 4, 3 ) \
+    X( PFNGLGETPROGRAMRESOURCELOCATIONPROC, GetProgramResourceLocation, 4, 3 ) \
+    X( PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, GetProgramResourceLocationIndex, 4, 3 ) \
+    X( PFNGLSHADERSTORAGEBLOCKBINDINGPROC, ShaderStorageBlockBinding, 4, 3 ) \
+    X( PFNGLTEXBUFFERRANGEPROC, TexBufferRange, 4, 3 ) \
+    X( PFNGLTEXSTORAGE2DMULTISAMPLEPROC, TexStorage2DMultisample, 4, 3 ) \
+    X( PFNGLTEXSTORAGE3DMULTISAMPLEPROC, TexStorage3DMultisample, 4, 3 ) \
+    X( PFNGLTEXTUREVIEWPROC, TextureView, 4, 3 ) \
+    X( PFNGLBINDVERTEXBUFFERPROC, BindVertexBuffer, 4, 3 ) \
+    X( PFNGLVERTEXATTRIBFORMATPROC, VertexAttribFormat, 4, 3 ) \
+    X( PFNGLVERTEXATTRIBIFORMATPROC, VertexAttribIFormat, 4, 3 ) \
+    X( PFNGLVERTEXATTRIBLFORMATPROC, VertexAttribLFormat, 4, 3 ) \
+    X( PFNGLVERTEXATTRIBBINDINGPROC, VertexAttribBinding, 4, 3 ) \
+    X( PFNGLVERTEXBINDINGDIVISORPROC, VertexBindingDivisor, 4, 3 ) \
+    X( PFNGLDEBUGMESSAGECONTROLPROC, DebugMessageControl, 4, 3 ) \
+    X( PFNGLDEBUGMESSAGEINSERTPROC, DebugMessageInsert, 4, 3 ) \
+    X( PFNGLDEBUGMESSAGECALLBACKPROC, DebugMessageCallback, 4, 3 ) \
+    X( PFNGLGETDEBUGMESSAGELOGPROC, GetDebugMessageLog, 4, 3 ) \
+    X( PFNGLPUSHDEBUGGROUPPROC, PushDebugGroup, 4, 3 ) \
+    X( PFNGLPOPDEBUGGROUPPROC, PopDebugGroup, 4, 3 ) \
+    X( PFNGLOBJECTLABELPROC, ObjectLabel, 4, 3 ) \
+    X( PFNGLGETOBJECTLABELPROC, GetObjectLabel, 4, 3 ) \
+    X( PFNGLOBJECTPTRLABELPROC, ObjectPtrLabel, 4, 3 ) \
+    X( PFNGLGETOBJECTPTRLABELPROC, GetObjectPtrLabel, 4, 3 ) \
+    X( PFNGLGETPOINTERVPROC, GetPointerv, 4, 3 ) \
+    X( PFNGLBUFFERSTORAGEPROC, BufferStorage, 4, 4 ) \
+    X( PFNGLCLEARTEXIMAGEPROC, ClearTexImage, 4, 4 ) \
+    X( PFNGLCLEARTEXSUBIMAGEPROC, ClearTexSubImage, 4, 4 ) \
+    X( PFNGLBINDBUFFERSBASEPROC, BindBuffersBase, 4, 4 ) \
+    X( PFNGLBINDBUFFERSRANGEPROC, BindBuffersRange, 4, 4 ) \
+    X( PFNGLBINDTEXTURESPROC, BindTextures, 4, 4 ) \
+    X( PFNGLBINDSAMPLERSPROC, BindSamplers, 4, 4 ) \
+    X( PFNGLBINDIMAGETEXTURESPROC, BindImageTextures, 4, 4 ) \
+    X( PFNGLBINDVERTEXBUFFERSPROC, BindVertexBuffers, 4, 4 ) \
+    X( PFNGLCLIPCONTROLPROC, ClipControl, 4, 5 ) \
+    X( PFNGLCREATETRANSFORMFEEDBACKSPROC, CreateTransformFeedbacks, 4, 5 ) \
+    X( PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, TransformFeedbackBufferBase, 4, 5 ) \
+    X( PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, TransformFeedbackBufferRange, 4, 5 ) \
+    X( PFNGLGETTRANSFORMFEEDBACKIVPROC, GetTransformFeedbackiv, 4, 5 ) \
+    X( PFNGLGETTRANSFORMFEEDBACKI_VPROC, GetTransformFeedbacki_v, 4, 5 ) \
+    X( PFNGLGETTRANSFORMFEEDBACKI64_VPROC, GetTransformFeedbacki64_v, 4, 5 ) \
+    X( PFNGLCREATEBUFFERSPROC, CreateBuffers, 4, 5 ) \
+    X( PFNGLNAMEDBUFFERSTORAGEPROC, NamedBufferStorage, 4, 5 ) \
+    X( PFNGLNAMEDBUFFERDATAPROC, NamedBufferData, 4, 5 ) \
+    X( PFNGLNAMEDBUFFERSUBDATAPROC, NamedBufferSubData, 4, 5 ) \
+    X( PFNGLCOPYNAMEDBUFFERSUBDATAPROC, CopyNamedBufferSubData, 4, 5 ) \
+    X( PFNGLCLEARNAMEDBUFFERDATAPROC, ClearNamedBufferData, 4, 5 ) \
+    X( PFNGLCLEARNAMEDBUFFERSUBDATAPROC, ClearNamedBufferSubData, 4, 5 ) \
+    X( PFNGLMAPNAMEDBUFFERPROC, MapNamedBuffer, 4, 5 ) \
+    X( PFNGLMAPNAMEDBUFFERRANGEPROC, MapNamedBufferRange, 4, 5 ) \
+    X( PFNGLUNMAPNAMEDBUFFERPROC, UnmapNamedBuffer, 4, 5 ) \
+    X( PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, FlushMappedNamedBufferRange, 4, 5 ) \
+    X( PFNGLGETNAMEDBUFFERPARAMETERIVPROC, GetNamedBufferParameteriv, 4, 5 ) \
+    X( PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, GetNamedBufferParameteri64v, 4, 5 ) \
+    X( PFNGLGETNAMEDBUFFERPOINTERVPROC, GetNamedBufferPointerv, 4, 5 ) \
+    X( PFNGLGETNAMEDBUFFERSUBDATAPROC, GetNamedBufferSubData, 4, 5 ) \
+    X( PFNGLCREATEFRAMEBUFFERSPROC, CreateFramebuffers, 4, 5 ) \
+    X( PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, NamedFramebufferRenderbuffer, 4, 5 ) \
+    X( PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, NamedFramebufferParameteri, 4, 5 ) \
+    X( PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, NamedFramebufferTexture, 4, 5 ) \
+    X( PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, NamedFramebufferTextureLayer, 4, 5 ) \
+    X( PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, NamedFramebufferDrawBuffer, 4, 5 ) \
+    X( PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, NamedFramebufferDrawBuffers, 4, 5 ) \
+    X( PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, NamedFramebufferReadBuffer, 4, 5 ) \
+    X( PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, InvalidateNamedFramebufferData, 4, 5 ) \
+    X( PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, InvalidateNamedFramebufferSubData, 4, 5 ) \
+    X( PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, ClearNamedFramebufferiv, 4, 5 ) \
+    X( PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, ClearNamedFramebufferuiv, 4, 5 ) \
+    X( PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, ClearNamedFramebufferfv, 4, 5 ) \
+    X( PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, ClearNamedFramebufferfi, 4, 5 ) \
+    X( PFNGLBLITNAMEDFRAMEBUFFERPROC, BlitNamedFramebuffer, 4, 5 ) \
+    X( PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, CheckNamedFramebufferStatus, 4, 5 ) \
+    X( PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, GetNamedFramebufferParameteriv, 4, 5 ) \
+    X( PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, GetNamedFramebufferAttachmentParameteriv, 4, 5 ) \
+    X( PFNGLCREATERENDERBUFFERSPROC, CreateRenderbuffers, 4, 5 ) \
+    X( PFNGLNAMEDRENDERBUFFERSTORAGEPROC, NamedRenderbufferStorage, 4, 5 ) \
+    X( PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, NamedRenderbufferStorageMultisample, 4, 5 ) \
+    X( PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, GetNamedRenderbufferParameteriv, 4, 5 ) \
+    X( PFNGLCREATETEXTURESPROC, CreateTextures, 4, 5 ) \
+    X( PFNGLTEXTUREBUFFERPROC, TextureBuffer, 4, 5 ) \
+    X( PFNGLTEXTUREBUFFERRANGEPROC, TextureBufferRange, 4, 5 ) \
+    X( PFNGLTEXTURESTORAGE1DPROC, TextureStorage1D, 4, 5 ) \
+    X( PFNGLTEXTURESTORAGE2DPROC, TextureStorage2D, 4, 5 ) \
+    X( PFNGLTEXTURESTORAGE3DPROC, TextureStorage3D, 4, 5 ) \
+    X( PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, TextureStorage2DMultisample, 4, 5 ) \
+    X( PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, TextureStorage3DMultisample, 4, 5 ) \
+    X( PFNGLTEXTURESUBIMAGE1DPROC, TextureSubImage1D, 4, 5 ) \
+    X( PFNGLTEXTURESUBIMAGE2DPROC, TextureSubImage2D, 4, 5 ) \
+    X( PFNGLTEXTURESUBIMAGE3DPROC, TextureSubImage3D, 4, 5 ) \
+    X( PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, CompressedTextureSubImage1D, 4, 5 ) \
+    X( PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, CompressedTextureSubImage2D, 4, 5 ) \
+    X( PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, CompressedTextureSubImage3D, 4, 5 ) \
+    X( PFNGLCOPYTEXTURESUBIMAGE1DPROC, CopyTextureSubImage1D, 4, 5 ) \
+    X( PFNGLCOPYTEXTURESUBIMAGE2DPROC, CopyTextureSubImage2D, 4, 5 ) \
+    X( PFNGLCOPYTEXTURESUBIMAGE3DPROC, CopyTextureSubImage3D, 4, 5 ) \
+    X( PFNGLTEXTUREPARAMETERFPROC, TextureParameterf, 4, 5 ) \
+    X( PFNGLTEXTUREPARAMETERFVPROC, TextureParameterfv, 4, 5 ) \
+    X( PFNGLTEXTUREPARAMETERIPROC, TextureParameteri, 4, 5 ) \
+    X( PFNGLTEXTUREPARAMETERIIVPROC, TextureParameterIiv, 4, 5 ) \
+    X( PFNGLTEXTUREPARAMETERIUIVPROC, TextureParameterIuiv, 4, 5 ) \
+    X( PFNGLTEXTUREPARAMETERIVPROC, TextureParameteriv, 4, 5 ) \
+    X( PFNGLGENERATETEXTUREMIPMAPPROC, GenerateTextureMipmap, 4, 5 ) \
+    X( PFNGLBINDTEXTUREUNITPROC, BindTextureUnit, 4, 5 ) \
+    X( PFNGLGETTEXTUREIMAGEPROC, GetTextureImage, 4, 5 ) \
+    X( PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, GetCompressedTextureImage, 4, 5 ) \
+    X( PFNGLGETTEXTURELEVELPARAMETERFVPROC, GetTextureLevelParameterfv, 4, 5 ) \
+    X( PFNGLGETTEXTURELEVELPARAMETERIVPROC, GetTextureLevelParameteriv, 4, 5 ) \
+    X( PFNGLGETTEXTUREPARAMETERFVPROC, GetTextureParameterfv, 4, 5 ) \
+    X( PFNGLGETTEXTUREPARAMETERIIVPROC, GetTextureParameterIiv, 4, 5 ) \
+    X( PFNGLGETTEXTUREPARAMETERIUIVPROC, GetTextureParameterIuiv, 4, 5 ) \
+    X( PFNGLGETTEXTUREPARAMETERIVPROC, GetTextureParameteriv, 4, 5 ) \
+    X( PFNGLCREATEVERTEXARRAYSPROC, CreateVertexArrays, 4, 5 ) \
+    X( PFNGLDISABLEVERTEXARRAYATTRIBPROC, DisableVertexArrayAttrib, 4, 5 ) \
+    X( PFNGLENABLEVERTEXARRAYATTRIBPROC, EnableVertexArrayAttrib, 4, 5 ) \
+    X( PFNGLVERTEXARRAYELEMENTBUFFERPROC, VertexArrayElementBuffer, 4, 5 ) \
+    X( PFNGLVERTEXARRAYVERTEXBUFFERPROC, VertexArrayVertexBuffer, 4, 5 ) \
+    X( PFNGLVERTEXARRAYVERTEXBUFFERSPROC, VertexArrayVertexBuffers, 4, 5 ) \
+    X( PFNGLVERTEXARRAYATTRIBBINDINGPROC, VertexArrayAttribBinding, 4, 5 ) \
+    X( PFNGLVERTEXARRAYATTRIBFORMATPROC, VertexArrayAttribFormat, 4, 5 ) \
+    X( PFNGLVERTEXARRAYATTRIBIFORMATPROC, VertexArrayAttribIFormat, 4, 5 ) \
+    X( PFNGLVERTEXARRAYATTRIBLFORMATPROC, VertexArrayAttribLFormat, 4, 5 ) \
+    X( PFNGLVERTEXARRAYBINDINGDIVISORPROC, VertexArrayBindingDivisor, 4, 5 ) \
+    X( PFNGLGETVERTEXARRAYIVPROC, GetVertexArrayiv, 4, 5 ) \
+    X( PFNGLGETVERTEXARRAYINDEXEDIVPROC, GetVertexArrayIndexediv, 4, 5 ) \
+    X( PFNGLGETVERTEXARRAYINDEXED64IVPROC, GetVertexArrayIndexed64iv, 4, 5 ) \
+    X( PFNGLCREATESAMPLERSPROC, CreateSamplers, 4, 5 ) \
+    X( PFNGLCREATEPROGRAMPIPELINESPROC, CreateProgramPipelines, 4, 5 ) \
+    X( PFNGLCREATEQUERIESPROC, CreateQueries, 4, 5 ) \
+    X( PFNGLGETQUERYBUFFEROBJECTI64VPROC, GetQueryBufferObjecti64v, 4, 5 ) \
+    X( PFNGLGETQUERYBUFFEROBJECTIVPROC, GetQueryBufferObjectiv, 4, 5 ) \
+    X( PFNGLGETQUERYBUFFEROBJECTUI64VPROC, GetQueryBufferObjectui64v, 4, 5 ) \
+    X( PFNGLGETQUERYBUFFEROBJECTUIVPROC, GetQueryBufferObjectuiv, 4, 5 ) \
+    X( PFNGLMEMORYBARRIERBYREGIONPROC, MemoryBarrierByRegion, 4, 5 ) \
+    X( PFNGLGETTEXTURESUBIMAGEPROC, GetTextureSubImage, 4, 5 ) \
+    X( PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, GetCompressedTextureSubImage, 4, 5 ) \
+    X( PFNGLGETGRAPHICSRESETSTATUSPROC, GetGraphicsResetStatus, 4, 5 ) \
+    X( PFNGLGETNCOMPRESSEDTEXIMAGEPROC, GetnCompressedTexImage, 4, 5 ) \
+    X( PFNGLGETNTEXIMAGEPROC, GetnTexImage, 4, 5 ) \
+    X( PFNGLGETNUNIFORMDVPROC, GetnUniformdv, 4, 5 ) \
+    X( PFNGLGETNUNIFORMFVPROC, GetnUniformfv, 4, 5 ) \
+    X( PFNGLGETNUNIFORMIVPROC, GetnUniformiv, 4, 5 ) \
+    X( PFNGLGETNUNIFORMUIVPROC, GetnUniformuiv, 4, 5 ) \
+    X( PFNGLREADNPIXELSPROC, ReadnPixels, 4, 5 ) \
+    X( PFNGLGETNMAPDVPROC, GetnMapdv, 4, 5 ) \
+    X( PFNGLGETNMAPFVPROC, GetnMapfv, 4, 5 ) \
+    X( PFNGLGETNMAPIVPROC, GetnMapiv, 4, 5 ) \
+    X( PFNGLGETNPIXELMAPFVPROC, GetnPixelMapfv, 4, 5 ) \
+    X( PFNGLGETNPIXELMAPUIVPROC, GetnPixelMapuiv, 4, 5 ) \
+    X( PFNGLGETNPIXELMAPUSVPROC, GetnPixelMapusv, 4, 5 ) \
+    X( PFNGLGETNPOLYGONSTIPPLEPROC, GetnPolygonStipple, 4, 5 ) \
+    X( PFNGLGETNCOLORTABLEPROC, GetnColorTable, 4, 5 ) \
+    X( PFNGLGETNCONVOLUTIONFILTERPROC, GetnConvolutionFilter, 4, 5 ) \
+    X( PFNGLGETNSEPARABLEFILTERPROC, GetnSeparableFilter, 4, 5 ) \
+    X( PFNGLGETNHISTOGRAMPROC, GetnHistogram, 4, 5 ) \
+    X( PFNGLGETNMINMAXPROC, GetnMinmax, 4, 5 ) \
+    X( PFNGLTEXTUREBARRIERPROC, TextureBarrier, 4, 5 ) \
+    X( PFNGLSPECIALIZESHADERPROC, SpecializeShader, 4, 6 ) \
+    X( PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, MultiDrawArraysIndirectCount, 4, 6 ) \
+    X( PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, MultiDrawElementsIndirectCount, 4, 6 ) \
+    X( PFNGLPOLYGONOFFSETCLAMPPROC, PolygonOffsetClamp, 4, 6 )
+// clang-format on
+
+#endif
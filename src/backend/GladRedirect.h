@@ -0,0 +1,703 @@
+//* Routes glad's `glad_gl*` names (and with them all `gl*` calls) through the calling thread's GladGLContext
+//* Generated from lib/glad/glad.h, included by GladContext.h only
+// clang-format off
+#define glad_glCullFace ( GladContext::currentTable->CullFace )
+#define glad_glFrontFace ( GladContext::currentTable->FrontFace )
+#define glad_glHint ( GladContext::currentTable->Hint )
+#define glad_glLineWidth ( GladContext::currentTable->LineWidth )
+#define glad_glPointSize ( GladContext::currentTable->PointSize )
+#define glad_glPolygonMode ( GladContext::currentTable->PolygonMode )
+#define glad_glScissor ( GladContext::currentTable->Scissor )
+#define glad_glTexParameterf ( GladContext::currentTable->TexParameterf )
+#define glad_glTexParameterfv ( GladContext::currentTable->TexParameterfv )
+#define glad_glTexParameteri ( GladContext::currentTable->TexParameteri )
+#define glad_glTexParameteriv ( GladContext::currentTable->TexParameteriv )
+#define glad_glTexImage1D ( GladContext::currentTable->TexImage1D )
+#define glad_glTexImage2D ( GladContext::currentTable->TexImage2D )
+#define glad_glDrawBuffer ( GladContext::currentTable->DrawBuffer )
+#define glad_glClear ( GladContext::currentTable->Clear )
+#define glad_glClearColor ( GladContext::currentTable->ClearColor )
+#define glad_glClearStencil ( GladContext::currentTable->ClearStencil )
+#define glad_glClearDepth ( GladContext::currentTable->ClearDepth )
+#define glad_glStencilMask ( GladContext::currentTable->StencilMask )
+#define glad_glColorMask ( GladContext::currentTable->ColorMask )
+#define glad_glDepthMask ( GladContext::currentTable->DepthMask )
+#define glad_glDisable ( GladContext::currentTable->Disable )
+#define glad_glEnable ( GladContext::currentTable->Enable )
+#define glad_glFinish ( GladContext::currentTable->Finish )
+#define glad_glFlush ( GladContext::currentTable->Flush )
+#define glad_glBlendFunc ( GladContext::currentTable->BlendFunc )
+#define glad_glLogicOp ( GladContext::currentTable->LogicOp )
+#define glad_glStencilFunc ( GladContext::currentTable->StencilFunc )
+#define glad_glStencilOp ( GladContext::currentTable->StencilOp )
+#define glad_glDepthFunc ( GladContext::currentTable->DepthFunc )
+#define glad_glPixelStoref ( GladContext::currentTable->PixelStoref )
+#define glad_glPixelStorei ( GladContext::currentTable->PixelStorei )
+#define glad_glReadBuffer ( GladContext::currentTable->ReadBuffer )
+#define glad_glReadPixels ( GladContext::currentTable->ReadPixels )
+#define glad_glGetBooleanv ( GladContext::currentTable->GetBooleanv )
+#define glad_glGetDoublev ( GladContext::currentTable->GetDoublev )
+#define glad_glGetError ( GladContext::currentTable->GetError )
+#define glad_glGetFloatv ( GladContext::currentTable->GetFloatv )
+#define glad_glGetIntegerv ( GladContext::currentTable->GetIntegerv )
+#define glad_glGetString ( GladContext::currentTable->GetString )
+#define glad_glGetTexImage ( GladContext::currentTable->GetTexImage )
+#define glad_glGetTexParameterfv ( GladContext::currentTable->GetTexParameterfv )
+#define glad_glGetTexParameteriv ( GladContext::currentTable->GetTexParameteriv )
+#define glad_glGetTexLevelParameterfv ( GladContext::currentTable->GetTexLevelParameterfv )
+#define glad_glGetTexLevelParameteriv ( GladContext::currentTable->GetTexLevelParameteriv )
+#define glad_glIsEnabled ( GladContext::currentTable->IsEnabled )
+#define glad_glDepthRange ( GladContext::currentTable->DepthRange )
+#define glad_glViewport ( GladContext::currentTable->Viewport )
+#define glad_glDrawArrays ( GladContext::currentTable->DrawArrays )
+#define glad_glDrawElements ( GladContext::currentTable->DrawElements )
+#define glad_glPolygonOffset ( GladContext::currentTable->PolygonOffset )
+#define glad_glCopyTexImage1D ( GladContext::currentTable->CopyTexImage1D )
+#define glad_glCopyTexImage2D ( GladContext::currentTable->CopyTexImage2D )
+#define glad_glCopyTexSubImage1D ( GladContext::currentTable->CopyTexSubImage1D )
+#define glad_glCopyTexSubImage2D ( GladContext::currentTable->CopyTexSubImage2D )
+#define glad_glTexSubImage1D ( GladContext::currentTable->TexSubImage1D )
+#define glad_glTexSubImage2D ( GladContext::currentTable->TexSubImage2D )
+#define glad_glBindTexture ( GladContext::currentTable->BindTexture )
+#define glad_glDeleteTextures ( GladContext::currentTable->DeleteTextures )
+#define glad_glGenTextures ( GladContext::currentTable->GenTextures )
+#define glad_glIsTexture ( GladContext::currentTable->IsTexture )
+#define glad_glDrawRangeElements ( GladContext::currentTable->DrawRangeElements )
+#define glad_glTexImage3D ( GladContext::currentTable->TexImage3D )
+#define glad_glTexSubImage3D ( GladContext::currentTable->TexSubImage3D )
+#define glad_glCopyTexSubImage3D ( GladContext::currentTable->CopyTexSubImage3D )
+#define glad_glActiveTexture ( GladContext::currentTable->ActiveTexture )
+#define glad_glSampleCoverage ( GladContext::currentTable->SampleCoverage )
+#define glad_glCompressedTexImage3D ( GladContext::currentTable->CompressedTexImage3D )
+#define glad_glCompressedTexImage2D ( GladContext::currentTable->CompressedTexImage2D )
+#define glad_glCompressedTexImage1D ( GladContext::currentTable->CompressedTexImage1D )
+#define glad_glCompressedTexSubImage3D ( GladContext::currentTable->CompressedTexSubImage3D )
+#define glad_glCompressedTexSubImage2D ( GladContext::currentTable->CompressedTexSubImage2D )
+#define glad_glCompressedTexSubImage1D ( GladContext::currentTable->CompressedTexSubImage1D )
+#define glad_glGetCompressedTexImage ( GladContext::currentTable->GetCompressedTexImage )
+#define glad_glBlendFuncSeparate ( GladContext::currentTable->BlendFuncSeparate )
+#define glad_glMultiDrawArrays ( GladContext::currentTable->MultiDrawArrays )
+#define glad_glMultiDrawElements ( GladContext::currentTable->MultiDrawElements )
+#define glad_glPointParameterf ( GladContext::currentTable->PointParameterf )
+#define glad_glPointParameterfv ( GladContext::currentTable->PointParameterfv )
+#define glad_glPointParameteri ( GladContext::currentTable->PointParameteri )
+#define glad_glPointParameteriv ( GladContext::currentTable->PointParameteriv )
+#define glad_glBlendColor ( GladContext::currentTable->BlendColor )
+#define glad_glBlendEquation ( GladContext::currentTable->BlendEquation )
+#define glad_glGenQueries ( GladContext::currentTable->GenQueries )
+#define glad_glDeleteQueries ( GladContext::currentTable->DeleteQueries )
+#define glad_glIsQuery ( GladContext::currentTable->IsQuery )
+#define glad_glBeginQuery ( GladContext::currentTable->BeginQuery )
+#define glad_glEndQuery ( GladContext::currentTable->EndQuery )
+#define glad_glGetQueryiv ( GladContext::currentTable->GetQueryiv )
+#define glad_glGetQueryObjectiv ( GladContext::currentTable->GetQueryObjectiv )
+#define glad_glGetQueryObjectuiv ( GladContext::currentTable->GetQueryObjectuiv )
+#define glad_glBindBuffer ( GladContext::currentTable->BindBuffer )
+#define glad_glDeleteBuffers ( GladContext::currentTable->DeleteBuffers )
+#define glad_glGenBuffers ( GladContext::currentTable->GenBuffers )
+#define glad_glIsBuffer ( GladContext::currentTable->IsBuffer )
+#define glad_glBufferData ( GladContext::currentTable->BufferData )
+#define glad_glBufferSubData ( GladContext::currentTable->BufferSubData )
+#define glad_glGetBufferSubData ( GladContext::currentTable->GetBufferSubData )
+#define glad_glMapBuffer ( GladContext::currentTable->MapBuffer )
+#define glad_glUnmapBuffer ( GladContext::currentTable->UnmapBuffer )
+#define glad_glGetBufferParameteriv ( GladContext::currentTable->GetBufferParameteriv )
+#define glad_glGetBufferPointerv ( GladContext::currentTable->GetBufferPointerv )
+#define glad_glBlendEquationSeparate ( GladContext::currentTable->BlendEquationSeparate )
+#define glad_glDrawBuffers ( GladContext::currentTable->DrawBuffers )
+#define glad_glStencilOpSeparate ( GladContext::currentTable->StencilOpSeparate )
+#define glad_glStencilFuncSeparate ( GladContext::currentTable->StencilFuncSeparate )
+#define glad_glStencilMaskSeparate ( GladContext::currentTable->StencilMaskSeparate )
+#define glad_glAttachShader ( GladContext::currentTable->AttachShader )
+#define glad_glBindAttribLocation ( GladContext::currentTable->BindAttribLocation )
+#define glad_glCompileShader ( GladContext::currentTable->CompileShader )
+#define glad_glCreateProgram ( GladContext::currentTable->CreateProgram )
+#define glad_glCreateShader ( GladContext::currentTable->CreateShader )
+#define glad_glDeleteProgram ( GladContext::currentTable->DeleteProgram )
+#define glad_glDeleteShader ( GladContext::currentTable->DeleteShader )
+#define glad_glDetachShader ( GladContext::currentTable->DetachShader )
+#define glad_glDisableVertexAttribArray ( GladContext::currentTable->DisableVertexAttribArray )
+#define glad_glEnableVertexAttribArray ( GladContext::currentTable->EnableVertexAttribArray )
+#define glad_glGetActiveAttrib ( GladContext::currentTable->GetActiveAttrib )
+#define glad_glGetActiveUniform ( GladContext::currentTable->GetActiveUniform )
+#define glad_glGetAttachedShaders ( GladContext::currentTable->GetAttachedShaders )
+#define glad_glGetAttribLocation ( GladContext::currentTable->GetAttribLocation )
+#define glad_glGetProgramiv ( GladContext::currentTable->GetProgramiv )
+#define glad_glGetProgramInfoLog ( GladContext::currentTable->GetProgramInfoLog )
+#define glad_glGetShaderiv ( GladContext::currentTable->GetShaderiv )
+#define glad_glGetShaderInfoLog ( GladContext::currentTable->GetShaderInfoLog )
+#define glad_glGetShaderSource ( GladContext::currentTable->GetShaderSource )
+#define glad_glGetUniformLocation ( GladContext::currentTable->GetUniformLocation )
+#define glad_glGetUniformfv ( GladContext::currentTable->GetUniformfv )
+#define glad_glGetUniformiv ( GladContext::currentTable->GetUniformiv )
+#define glad_glGetVertexAttribdv ( GladContext::currentTable->GetVertexAttribdv )
+#define glad_glGetVertexAttribfv ( GladContext::currentTable->GetVertexAttribfv )
+#define glad_glGetVertexAttribiv ( GladContext::currentTable->GetVertexAttribiv )
+#define glad_glGetVertexAttribPointerv ( GladContext::currentTable->GetVertexAttribPointerv )
+#define glad_glIsProgram ( GladContext::currentTable->IsProgram )
+#define glad_glIsShader ( GladContext::currentTable->IsShader )
+#define glad_glLinkProgram ( GladContext::currentTable->LinkProgram )
+#define glad_glShaderSource ( GladContext::currentTable->ShaderSource )
+#define glad_glUseProgram ( GladContext::currentTable->UseProgram )
+#define glad_glUniform1f ( GladContext::currentTable->Uniform1f )
+#define glad_glUniform2f ( GladContext::currentTable->Uniform2f )
+#define glad_glUniform3f ( GladContext::currentTable->Uniform3f )
+#define glad_glUniform4f ( GladContext::currentTable->Uniform4f )
+#define glad_glUniform1i ( GladContext::currentTable->Uniform1i )
+#define glad_glUniform2i ( GladContext::currentTable->Uniform2i )
+#define glad_glUniform3i ( GladContext::currentTable->Uniform3i )
+#define glad_glUniform4i ( GladContext::currentTable->Uniform4i )
+#define glad_glUniform1fv ( GladContext::currentTable->Uniform1fv )
+#define glad_glUniform2fv ( GladContext::currentTable->Uniform2fv )
+#define glad_glUniform3fv ( GladContext::currentTable->Uniform3fv )
+#define glad_glUniform4fv ( GladContext::currentTable->Uniform4fv )
+#define glad_glUniform1iv ( GladContext::currentTable->Uniform1iv )
+#define glad_glUniform2iv ( GladContext::currentTable->Uniform2iv )
+#define glad_glUniform3iv ( GladContext::currentTable->Uniform3iv )
+#define glad_glUniform4iv ( GladContext::currentTable->Uniform4iv )
+#define glad_glUniformMatrix2fv ( GladContext::currentTable->UniformMatrix2fv )
+#define glad_glUniformMatrix3fv ( GladContext::currentTable->UniformMatrix3fv )
+#define glad_glUniformMatrix4fv ( GladContext::currentTable->UniformMatrix4fv )
+#define glad_glValidateProgram ( GladContext::currentTable->ValidateProgram )
+#define glad_glVertexAttrib1d ( GladContext::currentTable->VertexAttrib1d )
+#define glad_glVertexAttrib1dv ( GladContext::currentTable->VertexAttrib1dv )
+#define glad_glVertexAttrib1f ( GladContext::currentTable->VertexAttrib1f )
+#define glad_glVertexAttrib1fv ( GladContext::currentTable->VertexAttrib1fv )
+#define glad_glVertexAttrib1s ( GladContext::currentTable->VertexAttrib1s )
+#define glad_glVertexAttrib1sv ( GladContext::currentTable->VertexAttrib1sv )
+#define glad_glVertexAttrib2d ( GladContext::currentTable->VertexAttrib2d )
+#define glad_glVertexAttrib2dv ( GladContext::currentTable->VertexAttrib2dv )
+#define glad_glVertexAttrib2f ( GladContext::currentTable->VertexAttrib2f )
+#define glad_glVertexAttrib2fv ( GladContext::currentTable->VertexAttrib2fv )
+#define glad_glVertexAttrib2s ( GladContext::currentTable->VertexAttrib2s )
+#define glad_glVertexAttrib2sv ( GladContext::currentTable->VertexAttrib2sv )
+#define glad_glVertexAttrib3d ( GladContext::currentTable->VertexAttrib3d )
+#define glad_glVertexAttrib3dv ( GladContext::currentTable->VertexAttrib3dv )
+#define glad_glVertexAttrib3f ( GladContext::currentTable->VertexAttrib3f )
+#define glad_glVertexAttrib3fv ( GladContext::currentTable->VertexAttrib3fv )
+#define glad_glVertexAttrib3s ( GladContext::currentTable->VertexAttrib3s )
+#define glad_glVertexAttrib3sv ( GladContext::currentTable->VertexAttrib3sv )
+#define glad_glVertexAttrib4Nbv ( GladContext::currentTable->VertexAttrib4Nbv )
+#define glad_glVertexAttrib4Niv ( GladContext::currentTable->VertexAttrib4Niv )
+#define glad_glVertexAttrib4Nsv ( GladContext::currentTable->VertexAttrib4Nsv )
+#define glad_glVertexAttrib4Nub ( GladContext::currentTable->VertexAttrib4Nub )
+#define glad_glVertexAttrib4Nubv ( GladContext::currentTable->VertexAttrib4Nubv )
+#define glad_glVertexAttrib4Nuiv ( GladContext::currentTable->VertexAttrib4Nuiv )
+#define glad_glVertexAttrib4Nusv ( GladContext::currentTable->VertexAttrib4Nusv )
+#define glad_glVertexAttrib4bv ( GladContext::currentTable->VertexAttrib4bv )
+#define glad_glVertexAttrib4d ( GladContext::currentTable->VertexAttrib4d )
+#define glad_glVertexAttrib4dv ( GladContext::currentTable->VertexAttrib4dv )
+#define glad_glVertexAttrib4f ( GladContext::currentTable->VertexAttrib4f )
+#define glad_glVertexAttrib4fv ( GladContext::currentTable->VertexAttrib4fv )
+#define glad_glVertexAttrib4iv ( GladContext::currentTable->VertexAttrib4iv )
+#define glad_glVertexAttrib4s ( GladContext::currentTable->VertexAttrib4s )
+#define glad_glVertexAttrib4sv ( GladContext::currentTable->VertexAttrib4sv )
+#define glad_glVertexAttrib4ubv ( GladContext::currentTable->VertexAttrib4ubv )
+#define glad_glVertexAttrib4uiv ( GladContext::currentTable->VertexAttrib4uiv )
+#define glad_glVertexAttrib4usv ( GladContext::currentTable->VertexAttrib4usv )
+#define glad_glVertexAttribPointer ( GladContext::currentTable->VertexAttribPointer )
+#define glad_glUniformMatrix2x3fv ( GladContext::currentTable->UniformMatrix2x3fv )
+#define glad_glUniformMatrix3x2fv ( GladContext::currentTable->UniformMatrix3x2fv )
+#define glad_glUniformMatrix2x4fv ( GladContext::currentTable->UniformMatrix2x4fv )
+#define glad_glUniformMatrix4x2fv ( GladContext::currentTable->UniformMatrix4x2fv )
+#define glad_glUniformMatrix3x4fv ( GladContext::currentTable->UniformMatrix3x4fv )
+#define glad_glUniformMatrix4x3fv ( GladContext::currentTable->UniformMatrix4x3fv )
+#define glad_glColorMaski ( GladContext::currentTable->ColorMaski )
+#define glad_glGetBooleani_v ( GladContext::currentTable->GetBooleani_v )
+#define glad_glGetIntegeri_v ( GladContext::currentTable->GetIntegeri_v )
+#define glad_glEnablei ( GladContext::currentTable->Enablei )
+#define glad_glDisablei ( GladContext::currentTable->Disablei )
+#define glad_glIsEnabledi ( GladContext::currentTable->IsEnabledi )
+#define glad_glBeginTransformFeedback ( GladContext::currentTable->BeginTransformFeedback )
+#define glad_glEndTransformFeedback ( GladContext::currentTable->EndTransformFeedback )
+#define glad_glBindBufferRange ( GladContext::currentTable->BindBufferRange )
+#define glad_glBindBufferBase ( GladContext::currentTable->BindBufferBase )
+#define glad_glTransformFeedbackVaryings ( GladContext::currentTable->TransformFeedbackVaryings )
+#define glad_glGetTransformFeedbackVarying ( GladContext::currentTable->GetTransformFeedbackVarying )
+#define glad_glClampColor ( GladContext::currentTable->ClampColor )
+#define glad_glBeginConditionalRender ( GladContext::currentTable->BeginConditionalRender )
+#define glad_glEndConditionalRender ( GladContext::currentTable->EndConditionalRender )
+#define glad_glVertexAttribIPointer ( GladContext::currentTable->VertexAttribIPointer )
+#define glad_glGetVertexAttribIiv ( GladContext::currentTable->GetVertexAttribIiv )
+#define glad_glGetVertexAttribIuiv ( GladContext::currentTable->GetVertexAttribIuiv )
+#define glad_glVertexAttribI1i ( GladContext::currentTable->VertexAttribI1i )
+#define glad_glVertexAttribI2i ( GladContext::currentTable->VertexAttribI2i )
+#define glad_glVertexAttribI3i ( GladContext::currentTable->VertexAttribI3i )
+#define glad_glVertexAttribI4i ( GladContext::currentTable->VertexAttribI4i )
+#define glad_glVertexAttribI1ui ( GladContext::currentTable->VertexAttribI1ui )
+#define glad_glVertexAttribI2ui ( GladContext::currentTable->VertexAttribI2ui )
+#define glad_glVertexAttribI3ui ( GladContext::currentTable->VertexAttribI3ui )
+#define glad_glVertexAttribI4ui ( GladContext::currentTable->VertexAttribI4ui )
+#define glad_glVertexAttribI1iv ( GladContext::currentTable->VertexAttribI1iv )
+#define glad_glVertexAttribI2iv ( GladContext::currentTable->VertexAttribI2iv )
+#define glad_glVertexAttribI3iv ( GladContext::currentTable->VertexAttribI3iv )
+#define glad_glVertexAttribI4iv ( GladContext::currentTable->VertexAttribI4iv )
+#define glad_glVertexAttribI1uiv ( GladContext::currentTable->VertexAttribI1uiv )
+#define glad_glVertexAttribI2uiv ( GladContext::currentTable->VertexAttribI2uiv )
+#define glad_glVertexAttribI3uiv ( GladContext::currentTable->VertexAttribI3uiv )
+#define glad_glVertexAttribI4uiv ( GladContext::currentTable->VertexAttribI4uiv )
+#define glad_glVertexAttribI4bv ( GladContext::currentTable->VertexAttribI4bv )
+#define glad_glVertexAttribI4sv ( GladContext::currentTable->VertexAttribI4sv )
+#define glad_glVertexAttribI4ubv ( GladContext::currentTable->VertexAttribI4ubv )
+#define glad_glVertexAttribI4usv ( GladContext::currentTable->VertexAttribI4usv )
+#define glad_glGetUniformuiv ( GladContext::currentTable->GetUniformuiv )
+#define glad_glBindFragDataLocation ( GladContext::currentTable->BindFragDataLocation )
+#define glad_glGetFragDataLocation ( GladContext::currentTable->GetFragDataLocation )
+#define glad_glUniform1ui ( GladContext::currentTable->Uniform1ui )
+#define glad_glUniform2ui ( GladContext::currentTable->Uniform2ui )
+#define glad_glUniform3ui ( GladContext::currentTable->Uniform3ui )
+#define glad_glUniform4ui ( GladContext::currentTable->Uniform4ui )
+#define glad_glUniform1uiv ( GladContext::currentTable->Uniform1uiv )
+#define glad_glUniform2uiv ( GladContext::currentTable->Uniform2uiv )
+#define glad_glUniform3uiv ( GladContext::currentTable->Uniform3uiv )
+#define glad_glUniform4uiv ( GladContext::currentTable->Uniform4uiv )
+#define glad_glTexParameterIiv ( GladContext::currentTable->TexParameterIiv )
+#define glad_glTexParameterIuiv ( GladContext::currentTable->TexParameterIuiv )
+#define glad_glGetTexParameterIiv ( GladContext::currentTable->GetTexParameterIiv )
+#define glad_glGetTexParameterIuiv ( GladContext::currentTable->GetTexParameterIuiv )
+#define glad_glClearBufferiv ( GladContext::currentTable->ClearBufferiv )
+#define glad_glClearBufferuiv ( GladContext::currentTable->ClearBufferuiv )
+#define glad_glClearBufferfv ( GladContext::currentTable->ClearBufferfv )
+#define glad_glClearBufferfi ( GladContext::currentTable->ClearBufferfi )
+#define glad_glGetStringi ( GladContext::currentTable->GetStringi )
+#define glad_glIsRenderbuffer ( GladContext::currentTable->IsRenderbuffer )
+#define glad_glBindRenderbuffer ( GladContext::currentTable->BindRenderbuffer )
+#define glad_glDeleteRenderbuffers ( GladContext::currentTable->DeleteRenderbuffers )
+#define glad_glGenRenderbuffers ( GladContext::currentTable->GenRenderbuffers )
+#define glad_glRenderbufferStorage ( GladContext::currentTable->RenderbufferStorage )
+#define glad_glGetRenderbufferParameteriv ( GladContext::currentTable->GetRenderbufferParameteriv )
+#define glad_glIsFramebuffer ( GladContext::currentTable->IsFramebuffer )
+#define glad_glBindFramebuffer ( GladContext::currentTable->BindFramebuffer )
+#define glad_glDeleteFramebuffers ( GladContext::currentTable->DeleteFramebuffers )
+#define glad_glGenFramebuffers ( GladContext::currentTable->GenFramebuffers )
+#define glad_glCheckFramebufferStatus ( GladContext::currentTable->CheckFramebufferStatus )
+#define glad_glFramebufferTexture1D ( GladContext::currentTable->FramebufferTexture1D )
+#define glad_glFramebufferTexture2D ( GladContext::currentTable->FramebufferTexture2D )
+#define glad_glFramebufferTexture3D ( GladContext::currentTable->FramebufferTexture3D )
+#define glad_glFramebufferRenderbuffer ( GladContext::currentTable->FramebufferRenderbuffer )
+#define glad_glGetFramebufferAttachmentParameteriv ( GladContext::currentTable->GetFramebufferAttachmentParameteriv )
+#define glad_glGenerateMipmap ( GladContext::currentTable->GenerateMipmap )
+#define glad_glBlitFramebuffer ( GladContext::currentTable->BlitFramebuffer )
+#define glad_glRenderbufferStorageMultisample ( GladContext::currentTable->RenderbufferStorageMultisample )
+#define glad_glFramebufferTextureLayer ( GladContext::currentTable->FramebufferTextureLayer )
+#define glad_glMapBufferRange ( GladContext::currentTable->MapBufferRange )
+#define glad_glFlushMappedBufferRange ( GladContext::currentTable->FlushMappedBufferRange )
+#define glad_glBindVertexArray ( GladContext::currentTable->BindVertexArray )
+#define glad_glDeleteVertexArrays ( GladContext::currentTable->DeleteVertexArrays )
+#define glad_glGenVertexArrays ( GladContext::currentTable->GenVertexArrays )
+#define glad_glIsVertexArray ( GladContext::currentTable->IsVertexArray )
+#define glad_glDrawArraysInstanced ( GladContext::currentTable->DrawArraysInstanced )
+#define glad_glDrawElementsInstanced ( GladContext::currentTable->DrawElementsInstanced )
+#define glad_glTexBuffer ( GladContext::currentTable->TexBuffer )
+#define glad_glPrimitiveRestartIndex ( GladContext::currentTable->PrimitiveRestartIndex )
+#define glad_glCopyBufferSubData ( GladContext::currentTable->CopyBufferSubData )
+#define glad_glGetUniformIndices ( GladContext::currentTable->GetUniformIndices )
+#define glad_glGetActiveUniformsiv ( GladContext::currentTable->GetActiveUniformsiv )
+#define glad_glGetActiveUniformName ( GladContext::currentTable->GetActiveUniformName )
+#define glad_glGetUniformBlockIndex ( GladContext::currentTable->GetUniformBlockIndex )
+#define glad_glGetActiveUniformBlockiv ( GladContext::currentTable->GetActiveUniformBlockiv )
+#define glad_glGetActiveUniformBlockName ( GladContext::currentTable->GetActiveUniformBlockName )
+#define glad_glUniformBlockBinding ( GladContext::currentTable->UniformBlockBinding )
+#define glad_glDrawElementsBaseVertex ( GladContext::currentTable->DrawElementsBaseVertex )
+#define glad_glDrawRangeElementsBaseVertex ( GladContext::currentTable->DrawRangeElementsBaseVertex )
+#define glad_glDrawElementsInstancedBaseVertex ( GladContext::currentTable->DrawElementsInstancedBaseVertex )
+#define glad_glMultiDrawElementsBaseVertex ( GladContext::currentTable->MultiDrawElementsBaseVertex )
+#define glad_glProvokingVertex ( GladContext::currentTable->ProvokingVertex )
+#define glad_glFenceSync ( GladContext::currentTable->FenceSync )
+#define glad_glIsSync ( GladContext::currentTable->IsSync )
+#define glad_glDeleteSync ( GladContext::currentTable->DeleteSync )
+#define glad_glClientWaitSync ( GladContext::currentTable->ClientWaitSync )
+#define glad_glWaitSync ( GladContext::currentTable->WaitSync )
+#define glad_glGetInteger64v ( GladContext::currentTable->GetInteger64v )
+#define glad_glGetSynciv ( GladContext::currentTable->GetSynciv )
+#define glad_glGetInteger64i_v ( GladContext::currentTable->GetInteger64i_v )
+#define glad_glGetBufferParameteri64v ( GladContext::currentTable->GetBufferParameteri64v )
+#define glad_glFramebufferTexture ( GladContext::currentTable->FramebufferTexture )
+#define glad_glTexImage2DMultisample ( GladContext::currentTable->TexImage2DMultisample )
+#define glad_glTexImage3DMultisample ( GladContext::currentTable->TexImage3DMultisample )
+#define glad_glGetMultisamplefv ( GladContext::currentTable->GetMultisamplefv )
+#define glad_glSampleMaski ( GladContext::currentTable->SampleMaski )
+#define glad_glBindFragDataLocationIndexed ( GladContext::currentTable->BindFragDataLocationIndexed )
+#define glad_glGetFragDataIndex ( GladContext::currentTable->GetFragDataIndex )
+#define glad_glGenSamplers ( GladContext::currentTable->GenSamplers )
+#define glad_glDeleteSamplers ( GladContext::currentTable->DeleteSamplers )
+#define glad_glIsSampler ( GladContext::currentTable->IsSampler )
+#define glad_glBindSampler ( GladContext::currentTable->BindSampler )
+#define glad_glSamplerParameteri ( GladContext::currentTable->SamplerParameteri )
+#define glad_glSamplerParameteriv ( GladContext::currentTable->SamplerParameteriv )
+#define glad_glSamplerParameterf ( GladContext::currentTable->SamplerParameterf )
+#define glad_glSamplerParameterfv ( GladContext::currentTable->SamplerParameterfv )
+#define glad_glSamplerParameterIiv ( GladContext::currentTable->SamplerParameterIiv )
+#define glad_glSamplerParameterIuiv ( GladContext::currentTable->SamplerParameterIuiv )
+#define glad_glGetSamplerParameteriv ( GladContext::currentTable->GetSamplerParameteriv )
+#define glad_glGetSamplerParameterIiv ( GladContext::currentTable->GetSamplerParameterIiv )
+#define glad_glGetSamplerParameterfv ( GladContext::currentTable->GetSamplerParameterfv )
+#define glad_glGetSamplerParameterIuiv ( GladContext::currentTable->GetSamplerParameterIuiv )
+#define glad_glQueryCounter ( GladContext::currentTable->QueryCounter )
+#define glad_glGetQueryObjecti64v ( GladContext::currentTable->GetQueryObjecti64v )
+#define glad_glGetQueryObjectui64v ( GladContext::currentTable->GetQueryObjectui64v )
+#define glad_glVertexAttribDivisor ( GladContext::currentTable->VertexAttribDivisor )
+#define glad_glVertexAttribP1ui ( GladContext::currentTable->VertexAttribP1ui )
+#define glad_glVertexAttribP1uiv ( GladContext::currentTable->VertexAttribP1uiv )
+#define glad_glVertexAttribP2ui ( GladContext::currentTable->VertexAttribP2ui )
+#define glad_glVertexAttribP2uiv ( GladContext::currentTable->VertexAttribP2uiv )
+#define glad_glVertexAttribP3ui ( GladContext::currentTable->VertexAttribP3ui )
+#define glad_glVertexAttribP3uiv ( GladContext::currentTable->VertexAttribP3uiv )
+#define glad_glVertexAttribP4ui ( GladContext::currentTable->VertexAttribP4ui )
+#define glad_glVertexAttribP4uiv ( GladContext::currentTable->VertexAttribP4uiv )
+#define glad_glVertexP2ui ( GladContext::currentTable->VertexP2ui )
+#define glad_glVertexP2uiv ( GladContext::currentTable->VertexP2uiv )
+#define glad_glVertexP3ui ( GladContext::currentTable->VertexP3ui )
+#define glad_glVertexP3uiv ( GladContext::currentTable->VertexP3uiv )
+#define glad_glVertexP4ui ( GladContext::currentTable->VertexP4ui )
+#define glad_glVertexP4uiv ( GladContext::currentTable->VertexP4uiv )
+#define glad_glTexCoordP1ui ( GladContext::currentTable->TexCoordP1ui )
+#define glad_glTexCoordP1uiv ( GladContext::currentTable->TexCoordP1uiv )
+#define glad_glTexCoordP2ui ( GladContext::currentTable->TexCoordP2ui )
+#define glad_glTexCoordP2uiv ( GladContext::currentTable->TexCoordP2uiv )
+#define glad_glTexCoordP3ui ( GladContext::currentTable->TexCoordP3ui )
+#define glad_glTexCoordP3uiv ( GladContext::currentTable->TexCoordP3uiv )
+#define glad_glTexCoordP4ui ( GladContext::currentTable->TexCoordP4ui )
+#define glad_glTexCoordP4uiv ( GladContext::currentTable->TexCoordP4uiv )
+#define glad_glMultiTexCoordP1ui ( GladContext::currentTable->MultiTexCoordP1ui )
+#define glad_glMultiTexCoordP1uiv ( GladContext::currentTable->MultiTexCoordP1uiv )
+#define glad_glMultiTexCoordP2ui ( GladContext::currentTable->MultiTexCoordP2ui )
+#define glad_glMultiTexCoordP2uiv ( GladContext::currentTable->MultiTexCoordP2uiv )
+#define glad_glMultiTexCoordP3ui ( GladContext::currentTable->MultiTexCoordP3ui )
+#define glad_glMultiTexCoordP3uiv ( GladContext::currentTable->MultiTexCoordP3uiv )
+#define glad_glMultiTexCoordP4ui ( GladContext::currentTable->MultiTexCoordP4ui )
+#define glad_glMultiTexCoordP4uiv ( GladContext::currentTable->MultiTexCoordP4uiv )
+#define glad_glNormalP3ui ( GladContext::currentTable->NormalP3ui )
+#define glad_glNormalP3uiv ( GladContext::currentTable->NormalP3uiv )
+#define glad_glColorP3ui ( GladContext::currentTable->ColorP3ui )
+#define glad_glColorP3uiv ( GladContext::currentTable->ColorP3uiv )
+#define glad_glColorP4ui ( GladContext::currentTable->ColorP4ui )
+#define glad_glColorP4uiv ( GladContext::currentTable->ColorP4uiv )
+#define glad_glSecondaryColorP3ui ( GladContext::currentTable->SecondaryColorP3ui )
+#define glad_glSecondaryColorP3uiv ( GladContext::currentTable->SecondaryColorP3uiv )
+#define glad_glMinSampleShading ( GladContext::currentTable->MinSampleShading )
+#define glad_glBlendEquationi ( GladContext::currentTable->BlendEquationi )
+#define glad_glBlendEquationSeparatei ( GladContext::currentTable->BlendEquationSeparatei )
+#define glad_glBlendFunci ( GladContext::currentTable->BlendFunci )
+#define glad_glBlendFuncSeparatei ( GladContext::currentTable->BlendFuncSeparatei )
+#define glad_glDrawArraysIndirect ( GladContext::currentTable->DrawArraysIndirect )
+#define glad_glDrawElementsIndirect ( GladContext::currentTable->DrawElementsIndirect )
+#define glad_glUniform1d ( GladContext::currentTable->Uniform1d )
+#define glad_glUniform2d ( GladContext::currentTable->Uniform2d )
+#define glad_glUniform3d ( GladContext::currentTable->Uniform3d )
+#define glad_glUniform4d ( GladContext::currentTable->Uniform4d )
+#define glad_glUniform1dv ( GladContext::currentTable->Uniform1dv )
+#define glad_glUniform2dv ( GladContext::currentTable->Uniform2dv )
+#define glad_glUniform3dv ( GladContext::currentTable->Uniform3dv )
+#define glad_glUniform4dv ( GladContext::currentTable->Uniform4dv )
+#define glad_glUniformMatrix2dv ( GladContext::currentTable->UniformMatrix2dv )
+#define glad_glUniformMatrix3dv ( GladContext::currentTable->UniformMatrix3dv )
+#define glad_glUniformMatrix4dv ( GladContext::currentTable->UniformMatrix4dv )
+#define glad_glUniformMatrix2x3dv ( GladContext::currentTable->UniformMatrix2x3dv )
+#define glad_glUniformMatrix2x4dv ( GladContext::currentTable->UniformMatrix2x4dv )
+#define glad_glUniformMatrix3x2dv ( GladContext::currentTable->UniformMatrix3x2dv )
+#define glad_glUniformMatrix3x4dv ( GladContext::currentTable->UniformMatrix3x4dv )
+#define glad_glUniformMatrix4x2dv ( GladContext::currentTable->UniformMatrix4x2dv )
+#define glad_glUniformMatrix4x3dv ( GladContext::currentTable->UniformMatrix4x3dv )
+#define glad_glGetUniformdv ( GladContext::currentTable->GetUniformdv )
+#define glad_glGetSubroutineUniformLocation ( GladContext::currentTable->GetSubroutineUniformLocation )
+#define glad_glGetSubroutineIndex ( GladContext::currentTable->GetSubroutineIndex )
+#define glad_glGetActiveSubroutineUniformiv ( GladContext::currentTable->GetActiveSubroutineUniformiv )
+#define glad_glGetActiveSubroutineUniformName ( GladContext::currentTable->GetActiveSubroutineUniformName )
+#define glad_glGetActiveSubroutineName ( GladContext::currentTable->GetActiveSubroutineName )
+#define glad_glUniformSubroutinesuiv ( GladContext::currentTable->UniformSubroutinesuiv )
+#define glad_glGetUniformSubroutineuiv ( GladContext::currentTable->GetUniformSubroutineuiv )
+#define glad_glGetProgramStageiv ( GladContext::currentTable->GetProgramStageiv )
+#define glad_glPatchParameteri ( GladContext::currentTable->PatchParameteri )
+#define glad_glPatchParameterfv ( GladContext::currentTable->PatchParameterfv )
+#define glad_glBindTransformFeedback ( GladContext::currentTable->BindTransformFeedback )
+#define glad_glDeleteTransformFeedbacks ( GladContext::currentTable->DeleteTransformFeedbacks )
+#define glad_glGenTransformFeedbacks ( GladContext::currentTable->GenTransformFeedbacks )
+#define glad_glIsTransformFeedback ( GladContext::currentTable->IsTransformFeedback )
+#define glad_glPauseTransformFeedback ( GladContext::currentTable->PauseTransformFeedback )
+#define glad_glResumeTransformFeedback ( GladContext::currentTable->ResumeTransformFeedback )
+#define glad_glDrawTransformFeedback ( GladContext::currentTable->DrawTransformFeedback )
+#define glad_glDrawTransformFeedbackStream ( GladContext::currentTable->DrawTransformFeedbackStream )
+#define glad_glBeginQueryIndexed ( GladContext::currentTable->BeginQueryIndexed )
+#define glad_glEndQueryIndexed ( GladContext::currentTable->EndQueryIndexed )
+#define glad_glGetQueryIndexediv ( GladContext::currentTable->GetQueryIndexediv )
+#define glad_glReleaseShaderCompiler ( GladContext::currentTable->ReleaseShaderCompiler )
+#define glad_glShaderBinary ( GladContext::currentTable->ShaderBinary )
+#define glad_glGetShaderPrecisionFormat ( GladContext::currentTable->GetShaderPrecisionFormat )
+#define glad_glDepthRangef ( GladContext::currentTable->DepthRangef )
+#define glad_glClearDepthf ( GladContext::currentTable->ClearDepthf )
+#define glad_glGetProgramBinary ( GladContext::currentTable->GetProgramBinary )
+#define glad_glProgramBinary ( GladContext::currentTable->ProgramBinary )
+#define glad_glProgramParameteri ( GladContext::currentTable->ProgramParameteri )
+#define glad_glUseProgramStages ( GladContext::currentTable->UseProgramStages )
+#define glad_glActiveShaderProgram ( GladContext::currentTable->ActiveShaderProgram )
+#define glad_glCreateShaderProgramv ( GladContext::currentTable->CreateShaderProgramv )
+#define glad_glBindProgramPipeline ( GladContext::currentTable->BindProgramPipeline )
+#define glad_glDeleteProgramPipelines ( GladContext::currentTable->DeleteProgramPipelines )
+#define glad_glGenProgramPipelines ( GladContext::currentTable->GenProgramPipelines )
+#define glad_glIsProgramPipeline ( GladContext::currentTable->IsProgramPipeline )
+#define glad_glGetProgramPipelineiv ( GladContext::currentTable->GetProgramPipelineiv )
+#define glad_glProgramUniform1i ( GladContext::currentTable->ProgramUniform1i )
+#define glad_glProgramUniform1iv ( GladContext::currentTable->ProgramUniform1iv )
+#define glad_glProgramUniform1f ( GladContext::currentTable->ProgramUniform1f )
+#define glad_glProgramUniform1fv ( GladContext::currentTable->ProgramUniform1fv )
+#define glad_glProgramUniform1d ( GladContext::currentTable->ProgramUniform1d )
+#define glad_glProgramUniform1dv ( GladContext::currentTable->ProgramUniform1dv )
+#define glad_glProgramUniform1ui ( GladContext::currentTable->ProgramUniform1ui )
+#define glad_glProgramUniform1uiv ( GladContext::currentTable->ProgramUniform1uiv )
+#define glad_glProgramUniform2i ( GladContext::currentTable->ProgramUniform2i )
+#define glad_glProgramUniform2iv ( GladContext::currentTable->ProgramUniform2iv )
+#define glad_glProgramUniform2f ( GladContext::currentTable->ProgramUniform2f )
+#define glad_glProgramUniform2fv ( GladContext::currentTable->ProgramUniform2fv )
+#define glad_glProgramUniform2d ( GladContext::currentTable->ProgramUniform2d )
+#define glad_glProgramUniform2dv ( GladContext::currentTable->ProgramUniform2dv )
+#define glad_glProgramUniform2ui ( GladContext::currentTable->ProgramUniform2ui )
+#define glad_glProgramUniform2uiv ( GladContext::currentTable->ProgramUniform2uiv )
+#define glad_glProgramUniform3i ( GladContext::currentTable->ProgramUniform3i )
+#define glad_glProgramUniform3iv ( GladContext::currentTable->ProgramUniform3iv )
+#define glad_glProgramUniform3f ( GladContext::currentTable->ProgramUniform3f )
+#define glad_glProgramUniform3fv ( GladContext::currentTable->ProgramUniform3fv )
+#define glad_glProgramUniform3d ( GladContext::currentTable->ProgramUniform3d )
+#define glad_glProgramUniform3dv ( GladContext::currentTable->ProgramUniform3dv )
+#define glad_glProgramUniform3ui ( GladContext::currentTable->ProgramUniform3ui )
+#define glad_glProgramUniform3uiv ( GladContext::currentTable->ProgramUniform3uiv )
+#define glad_glProgramUniform4i ( GladContext::currentTable->ProgramUniform4i )
+#define glad_glProgramUniform4iv ( GladContext::currentTable->ProgramUniform4iv )
+#define glad_glProgramUniform4f ( GladContext::currentTable->ProgramUniform4f )
+#define glad_glProgramUniform4fv ( GladContext::currentTable->ProgramUniform4fv )
+#define glad_glProgramUniform4d ( GladContext::currentTable->ProgramUniform4d )
+#define glad_glProgramUniform4dv ( GladContext::currentTable->ProgramUniform4dv )
+#define glad_glProgramUniform4ui ( GladContext::currentTable->ProgramUniform4ui )
+#define glad_glProgramUniform4uiv ( GladContext::currentTable->ProgramUniform4uiv )
+#define glad_glProgramUniformMatrix2fv ( GladContext::currentTable->ProgramUniformMatrix2fv )
+#define glad_glProgramUniformMatrix3fv ( GladContext::currentTable->ProgramUniformMatrix3fv )
+#define glad_glProgramUniformMatrix4fv ( GladContext::currentTable->ProgramUniformMatrix4fv )
+#define glad_glProgramUniformMatrix2dv ( GladContext::currentTable->ProgramUniformMatrix2dv )
+#define glad_glProgramUniformMatrix3dv ( GladContext::currentTable->ProgramUniformMatrix3dv )
+#define glad_glProgramUniformMatrix4dv ( GladContext::currentTable->ProgramUniformMatrix4dv )
+#define glad_glProgramUniformMatrix2x3fv ( GladContext::currentTable->ProgramUniformMatrix2x3fv )
+#define glad_glProgramUniformMatrix3x2fv ( GladContext::currentTable->ProgramUniformMatrix3x2fv )
+#define glad_glProgramUniformMatrix2x4fv ( GladContext::currentTable->ProgramUniformMatrix2x4fv )
+#define glad_glProgramUniformMatrix4x2fv ( GladContext::currentTable->ProgramUniformMatrix4x2fv )
+#define glad_glProgramUniformMatrix3x4fv ( GladContext::currentTable->ProgramUniformMatrix3x4fv )
+#define glad_glProgramUniformMatrix4x3fv ( GladContext::currentTable->ProgramUniformMatrix4x3fv )
+#define glad_glProgramUniformMatrix2x3dv ( GladContext::currentTable->ProgramUniformMatrix2x3dv )
+#define glad_glProgramUniformMatrix3x2dv ( GladContext::currentTable->ProgramUniformMatrix3x2dv )
+#define glad_glProgramUniformMatrix2x4dv ( GladContext::currentTable->ProgramUniformMatrix2x4dv )
+#define glad_glProgramUniformMatrix4x2dv ( GladContext::currentTable->ProgramUniformMatrix4x2dv )
+#define glad_glProgramUniformMatrix3x4dv ( GladContext::currentTable->ProgramUniformMatrix3x4dv )
+#define glad_glProgramUniformMatrix4x3dv ( GladContext::currentTable->ProgramUniformMatrix4x3dv )
+#define glad_glValidateProgramPipeline ( GladContext::currentTable->ValidateProgramPipeline )
+#define glad_glGetProgramPipelineInfoLog ( GladContext::currentTable->GetProgramPipelineInfoLog )
+#define glad_glVertexAttribL1d ( GladContext::currentTable->VertexAttribL1d )
+#define glad_glVertexAttribL2d ( GladContext::currentTable->VertexAttribL2d )
+#define glad_glVertexAttribL3d ( GladContext::currentTable->VertexAttribL3d )
+#define glad_glVertexAttribL4d ( GladContext::currentTable->VertexAttribL4d )
+#define glad_glVertexAttribL1dv ( GladContext::currentTable->VertexAttribL1dv )
+#define glad_glVertexAttribL2dv ( GladContext::currentTable->VertexAttribL2dv )
+#define glad_glVertexAttribL3dv ( GladContext::currentTable->VertexAttribL3dv )
+#define glad_glVertexAttribL4dv ( GladContext::currentTable->VertexAttribL4dv )
+#define glad_glVertexAttribLPointer ( GladContext::currentTable->VertexAttribLPointer )
+#define glad_glGetVertexAttribLdv ( GladContext::currentTable->GetVertexAttribLdv )
+#define glad_glViewportArrayv ( GladContext::currentTable->ViewportArrayv )
+#define glad_glViewportIndexedf ( GladContext::currentTable->ViewportIndexedf )
+#define glad_glViewportIndexedfv ( GladContext::currentTable->ViewportIndexedfv )
+#define glad_glScissorArrayv ( GladContext::currentTable->ScissorArrayv )
+#define glad_glScissorIndexed ( GladContext::currentTable->ScissorIndexed )
+#define glad_glScissorIndexedv ( GladContext::currentTable->ScissorIndexedv )
+#define glad_glDepthRangeArrayv ( GladContext::currentTable->DepthRangeArrayv )
+#define glad_glDepthRangeIndexed ( GladContext::currentTable->DepthRangeIndexed )
+#define glad_glGetFloati_v ( GladContext::currentTable->GetFloati_v )
+#define glad_glGetDoublei_v ( GladContext::currentTable->GetDoublei_v )
+#define glad_glDrawArraysInstancedBaseInstance ( GladContext::currentTable->DrawArraysInstancedBaseInstance )
+#define glad_glDrawElementsInstancedBaseInstance ( GladContext::currentTable->DrawElementsInstancedBaseInstance )
+#define glad_glDrawElementsInstancedBaseVertexBaseInstance ( GladContext::currentTable->DrawElementsInstancedBaseVertexBaseInstance )
+#define glad_glGetInternalformativ ( GladContext::currentTable->GetInternalformativ )
+#define glad_glGetActiveAtomicCounterBufferiv ( GladContext::currentTable->GetActiveAtomicCounterBufferiv )
+#define glad_glBindImageTexture ( GladContext::currentTable->BindImageTexture )
+#define glad_glMemoryBarrier ( GladContext::currentTable->MemoryBarrier )
+#define glad_glTexStorage1D ( GladContext::currentTable->TexStorage1D )
+#define glad_glTexStorage2D ( GladContext::currentTable->TexStorage2D )
+#define glad_glTexStorage3D ( GladContext::currentTable->TexStorage3D )
+#define glad_glDrawTransformFeedbackInstanced ( GladContext::currentTable->DrawTransformFeedbackInstanced )
+#define glad_glDrawTransformFeedbackStreamInstanced ( GladContext::currentTable->DrawTransformFeedbackStreamInstanced )
+#define glad_glClearBufferData ( GladContext::currentTable->ClearBufferData )
+#define glad_glClearBufferSubData ( GladContext::currentTable->ClearBufferSubData )
+#define glad_glDispatchCompute ( GladContext::currentTable->DispatchCompute )
+#define glad_glDispatchComputeIndirect ( GladContext::currentTable->DispatchComputeIndirect )
+#define glad_glCopyImageSubData ( GladContext::currentTable->CopyImageSubData )
+#define glad_glFramebufferParameteri ( GladContext::currentTable->FramebufferParameteri )
+#define glad_glGetFramebufferParameteriv ( GladContext::currentTable->GetFramebufferParameteriv )
+#define glad_glGetInternalformati64v ( GladContext::currentTable->GetInternalformati64v )
+#define glad_glInvalidateTexSubImage ( GladContext::currentTable->InvalidateTexSubImage )
+#define glad_glInvalidateTexImage ( GladContext::currentTable->InvalidateTexImage )
+#define glad_glInvalidateBufferSubData ( GladContext::currentTable->InvalidateBufferSubData )
+#define glad_glInvalidateBufferData ( GladContext::currentTable->InvalidateBufferData )
+#define glad_glInvalidateFramebuffer ( GladContext::currentTable->InvalidateFramebuffer )
+#define glad_glInvalidateSubFramebuffer ( GladContext::currentTable->InvalidateSubFramebuffer )
+#define glad_glMultiDrawArraysIndirect ( GladContext::currentTable->MultiDrawArraysIndirect )
+#define glad_glMultiDrawElementsIndirect ( GladContext::currentTable->MultiDrawElementsIndirect )
+#define glad_glGetProgramInterfaceiv ( GladContext::currentTable->GetProgramInterfaceiv )
+#define glad_glGetProgramResourceIndex ( GladContext::currentTable->GetProgramResourceIndex )
+#define glad_glGetProgramResourceName ( GladContext::currentTable->GetProgramResourceName )
+#define glad_glGetProgramResourceiv ( GladContext::currentTable->GetProgramResourceiv )
+#define glad_glGetProgramResourceLocation ( GladContext::currentTable->GetProgramResourceLocation )
+#define glad_glGetProgramResourceLocationIndex ( GladContext::currentTable->GetProgramResourceLocationIndex )
+#define glad_glShaderStorageBlockBinding ( GladContext::currentTable->ShaderStorageBlockBinding )
+#define glad_glTexBufferRange ( GladContext::currentTable->TexBufferRange )
+#define glad_glTexStorage2DMultisample ( GladContext::currentTable->TexStorage2DMultisample )
+#define glad_glTexStorage3DMultisample ( GladContext::currentTable->TexStorage3DMultisample )
+#define glad_glTextureView ( GladContext::currentTable->TextureView )
+#define glad_glBindVertexBuffer ( GladContext::currentTable->BindVertexBuffer )
+#define glad_glVertexAttribFormat ( GladContext::currentTable->VertexAttribFormat )
+#define glad_glVertexAttribIFormat ( GladContext::currentTable->VertexAttribIFormat )
+#define glad_glVertexAttribLFormat ( GladContext::currentTable->VertexAttribLFormat )
+#define glad_glVertexAttribBinding ( GladContext::currentTable->VertexAttribBinding )
+#define glad_glVertexBindingDivisor ( GladContext::currentTable->VertexBindingDivisor )
+#define glad_glDebugMessageControl ( GladContext::currentTable->DebugMessageControl )
+#define glad_glDebugMessageInsert ( GladContext::currentTable->DebugMessageInsert )
+#define glad_glDebugMessageCallback ( GladContext::currentTable->DebugMessageCallback )
+#define glad_glGetDebugMessageLog ( GladContext::currentTable->GetDebugMessageLog )
+#define glad_glPushDebugGroup ( GladContext::currentTable->PushDebugGroup )
+#define glad_glPopDebugGroup ( GladContext::currentTable->PopDebugGroup )
+#define glad_glObjectLabel ( GladContext::currentTable->ObjectLabel )
+#define glad_glGetObjectLabel ( GladContext::currentTable->GetObjectLabel )
+#define glad_glObjectPtrLabel ( GladContext::currentTable->ObjectPtrLabel )
+#define glad_glGetObjectPtrLabel ( GladContext::currentTable->GetObjectPtrLabel )
+#define glad_glGetPointerv ( GladContext::currentTable->GetPointerv )
+#define glad_glBufferStorage ( GladContext::currentTable->BufferStorage )
+#define glad_glClearTexImage ( GladContext::currentTable->ClearTexImage )
+#define glad_glClearTexSubImage ( GladContext::currentTable->ClearTexSubImage )
+#define glad_glBindBuffersBase ( GladContext::currentTable->BindBuffersBase )
+#define glad_glBindBuffersRange ( GladContext::currentTable->BindBuffersRange )
+#define glad_glBindTextures ( GladContext::currentTable->BindTextures )
+#define glad_glBindSamplers ( GladContext::currentTable->BindSamplers )
+#define glad_glBindImageTextures ( GladContext::currentTable->BindImageTextures )
+#define glad_glBindVertexBuffers ( GladContext::currentTable->BindVertexBuffers )
+#define glad_glClipControl ( GladContext::currentTable->ClipControl )
+#define glad_glCreateTransformFeedbacks ( GladContext::currentTable->CreateTransformFeedbacks )
+#define glad_glTransformFeedbackBufferBase ( GladContext::currentTable->TransformFeedbackBufferBase )
+#define glad_glTransformFeedbackBufferRange ( GladContext::currentTable->TransformFeedbackBufferRange )
+#define glad_glGetTransformFeedbackiv ( GladContext::currentTable->GetTransformFeedbackiv )
+#define glad_glGetTransformFeedbacki_v ( GladContext::currentTable->GetTransformFeedbacki_v )
+#define glad_glGetTransformFeedbacki64_v ( GladContext::currentTable->GetTransformFeedbacki64_v )
+#define glad_glCreateBuffers ( GladContext::currentTable->CreateBuffers )
+#define glad_glNamedBufferStorage ( GladContext::currentTable->NamedBufferStorage )
+#define glad_glNamedBufferData ( GladContext::currentTable->NamedBufferData )
+#define glad_glNamedBufferSubData ( GladContext::currentTable->NamedBufferSubData )
+#define glad_glCopyNamedBufferSubData ( GladContext::currentTable->CopyNamedBufferSubData )
+#define glad_glClearNamedBufferData ( GladContext::currentTable->ClearNamedBufferData )
+#define glad_glClearNamedBufferSubData ( GladContext::currentTable->ClearNamedBufferSubData )
+#define glad_glMapNamedBuffer ( GladContext::currentTable->MapNamedBuffer )
+#define glad_glMapNamedBufferRange ( GladContext::currentTable->MapNamedBufferRange )
+#define glad_glUnmapNamedBuffer ( GladContext::currentTable->UnmapNamedBuffer )
+#define glad_glFlushMappedNamedBufferRange ( GladContext::currentTable->FlushMappedNamedBufferRange )
+#define glad_glGetNamedBufferParameteriv ( GladContext::currentTable->GetNamedBufferParameteriv )
+#define glad_glGetNamedBufferParameteri64v ( GladContext::currentTable->GetNamedBufferParameteri64v )
+#define glad_glGetNamedBufferPointerv ( GladContext::currentTable->GetNamedBufferPointerv )
+#define glad_glGetNamedBufferSubData ( GladContext::currentTable->GetNamedBufferSubData )
+#define glad_glCreateFramebuffers ( GladContext::currentTable->CreateFramebuffers )
+#define glad_glNamedFramebufferRenderbuffer ( GladContext::currentTable->NamedFramebufferRenderbuffer )
+#define glad_glNamedFramebufferParameteri ( GladContext::currentTable->NamedFramebufferParameteri )
+#define glad_glNamedFramebufferTexture ( GladContext::currentTable->NamedFramebufferTexture )
+#define glad_glNamedFramebufferTextureLayer ( GladContext::currentTable->NamedFramebufferTextureLayer )
+#define glad_glNamedFramebufferDrawBuffer ( GladContext::currentTable->NamedFramebufferDrawBuffer )
+#define glad_glNamedFramebufferDrawBuffers ( GladContext::currentTable->NamedFramebufferDrawBuffers )
+#define glad_glNamedFramebufferReadBuffer ( GladContext::currentTable->NamedFramebufferReadBuffer )
+#define glad_glInvalidateNamedFramebufferData ( GladContext::currentTable->InvalidateNamedFramebufferData )
+#define glad_glInvalidateNamedFramebufferSubData ( GladContext::currentTable->InvalidateNamedFramebufferSubData )
+#define glad_glClearNamedFramebufferiv ( GladContext::currentTable->ClearNamedFramebufferiv )
+#define glad_glClearNamedFramebufferuiv ( GladContext::currentTable->ClearNamedFramebufferuiv )
+#define glad_glClearNamedFramebufferfv ( GladContext::currentTable->ClearNamedFramebufferfv )
+#define glad_glClearNamedFramebufferfi ( GladContext::currentTable->ClearNamedFramebufferfi )
+#define glad_glBlitNamedFramebuffer ( GladContext::currentTable->BlitNamedFramebuffer )
+#define glad_glCheckNamedFramebufferStatus ( GladContext::currentTable->CheckNamedFramebufferStatus )
+#define glad_glGetNamedFramebufferParameteriv ( GladContext::currentTable->GetNamedFramebufferParameteriv )
+#define glad_glGetNamedFramebufferAttachmentParameteriv ( GladContext::currentTable->GetNamedFramebufferAttachmentParameteriv )
+#define glad_glCreateRenderbuffers ( GladContext::currentTable->CreateRenderbuffers )
+#define glad_glNamedRenderbufferStorage ( GladContext::currentTable->NamedRenderbufferStorage )
+#define glad_glNamedRenderbufferStorageMultisample ( GladContext::currentTable->NamedRenderbufferStorageMultisample )
+#define glad_glGetNamedRenderbufferParameteriv ( GladContext::currentTable->GetNamedRenderbufferParameteriv )
+#define glad_glCreateTextures ( GladContext::currentTable->CreateTextures )
+#define glad_glTextureBuffer ( GladContext::currentTable->TextureBuffer )
+#define glad_glTextureBufferRange ( GladContext::currentTable->TextureBufferRange )
+#define glad_glTextureStorage1D ( GladContext::currentTable->TextureStorage1D )
+#define glad_glTextureStorage2D ( GladContext::currentTable->TextureStorage2D )
+#define glad_glTextureStorage3D ( GladContext::currentTable->TextureStorage3D )
+#define glad_glTextureStorage2DMultisample ( GladContext::currentTable->TextureStorage2DMultisample )
+#define glad_glTextureStorage3DMultisample ( GladContext::currentTable->TextureStorage3DMultisample )
+#define glad_glTextureSubImage1D ( GladContext::currentTable->TextureSubImage1D )
+#define glad_glTextureSubImage2D ( GladContext::currentTable->TextureSubImage2D )
+#define glad_glTextureSubImage3D ( GladContext::currentTable->TextureSubImage3D )
+#define glad_glCompressedTextureSubImage1D ( GladContext::currentTable->CompressedTextureSubImage1D )
+#define glad_glCompressedTextureSubImage2D ( GladContext::currentTable->CompressedTextureSubImage2D )
+#define glad_glCompressedTextureSubImage3D ( GladContext::currentTable->CompressedTextureSubImage3D )
+#define glad_glCopyTextureSubImage1D ( GladContext::currentTable->CopyTextureSubImage1D )
+#define glad_glCopyTextureSubImage2D ( GladContext::currentTable->CopyTextureSubImage2D )
+#define glad_glCopyTextureSubImage3D ( GladContext::currentTable->CopyTextureSubImage3D )
+#define glad_glTextureParameterf ( GladContext::currentTable->TextureParameterf )
+#define glad_glTextureParameterfv ( GladContext::currentTable->TextureParameterfv )
+#define glad_glTextureParameteri ( GladContext::currentTable->TextureParameteri )
+#define glad_glTextureParameterIiv ( GladContext::currentTable->TextureParameterIiv )
+#define glad_glTextureParameterIuiv ( GladContext::currentTable->TextureParameterIuiv )
+#define glad_glTextureParameteriv ( GladContext::currentTable->TextureParameteriv )
+#define glad_glGenerateTextureMipmap ( GladContext::currentTable->GenerateTextureMipmap )
+#define glad_glBindTextureUnit ( GladContext::currentTable->BindTextureUnit )
+#define glad_glGetTextureImage ( GladContext::currentTable->GetTextureImage )
+#define glad_glGetCompressedTextureImage ( GladContext::currentTable->GetCompressedTextureImage )
+#define glad_glGetTextureLevelParameterfv ( GladContext::currentTable->GetTextureLevelParameterfv )
+#define glad_glGetTextureLevelParameteriv ( GladContext::currentTable->GetTextureLevelParameteriv )
+#define glad_glGetTextureParameterfv ( GladContext::currentTable->GetTextureParameterfv )
+#define glad_glGetTextureParameterIiv ( GladContext::currentTable->GetTextureParameterIiv )
+#define glad_glGetTextureParameterIuiv ( GladContext::currentTable->GetTextureParameterIuiv )
+#define glad_glGetTextureParameteriv ( GladContext::currentTable->GetTextureParameteriv )
+#define glad_glCreateVertexArrays ( GladContext::currentTable->CreateVertexArrays )
+#define glad_glDisableVertexArrayAttrib ( GladContext::currentTable->DisableVertexArrayAttrib )
+#define glad_glEnableVertexArrayAttrib ( GladContext::currentTable->EnableVertexArrayAttrib )
+#define glad_glVertexArrayElementBuffer ( GladContext::currentTable->VertexArrayElementBuffer )
+#define glad_glVertexArrayVertexBuffer ( GladContext::currentTable->VertexArrayVertexBuffer )
+#define glad_glVertexArrayVertexBuffers ( GladContext::currentTable->VertexArrayVertexBuffers )
+#define glad_glVertexArrayAttribBinding ( GladContext::currentTable->VertexArrayAttribBinding )
+#define glad_glVertexArrayAttribFormat ( GladContext::currentTable->VertexArrayAttribFormat )
+#define glad_glVertexArrayAttribIFormat ( GladContext::currentTable->VertexArrayAttribIFormat )
+#define glad_glVertexArrayAttribLFormat ( GladContext::currentTable->VertexArrayAttribLFormat )
+#define glad_glVertexArrayBindingDivisor ( GladContext::currentTable->VertexArrayBindingDivisor )
+#define glad_glGetVertexArrayiv ( GladContext::currentTable->GetVertexArrayiv )
+#define glad_glGetVertexArrayIndexediv ( GladContext::currentTable->GetVertexArrayIndexediv )
+#define glad_glGetVertexArrayIndexed64iv ( GladContext::currentTable->GetVertexArrayIndexed64iv )
+#define glad_glCreateSamplers ( GladContext::currentTable->CreateSamplers )
+#define glad_glCreateProgramPipelines ( GladContext::currentTable->CreateProgramPipelines )
+#define glad_glCreateQueries ( GladContext::currentTable->CreateQueries )
+#define glad_glGetQueryBufferObjecti64v ( GladContext::currentTable->GetQueryBufferObjecti64v )
+#define glad_glGetQueryBufferObjectiv ( GladContext::currentTable->GetQueryBufferObjectiv )
+#define glad_glGetQueryBufferObjectui64v ( GladContext::currentTable->GetQueryBufferObjectui64v )
+#define glad_glGetQueryBufferObjectuiv ( GladContext::currentTable->GetQueryBufferObjectuiv )
+#define glad_glMemoryBarrierByRegion ( GladContext::currentTable->MemoryBarrierByRegion )
+#define glad_glGetTextureSubImage ( GladContext::currentTable->GetTextureSubImage )
+#define glad_glGetCompressedTextureSubImage ( GladContext::currentTable->GetCompressedTextureSubImage )
+#define glad_glGetGraphicsResetStatus ( GladContext::currentTable->GetGraphicsResetStatus )
+#define glad_glGetnCompressedTexImage ( GladContext::currentTable->GetnCompressedTexImage )
+#define glad_glGetnTexImage ( GladContext::currentTable->GetnTexImage )
+#define glad_glGetnUniformdv ( GladContext::currentTable->GetnUniformdv )
+#define glad_glGetnUniformfv ( GladContext::currentTable->GetnUniformfv )
+#define glad_glGetnUniformiv ( GladContext::currentTable->GetnUniformiv )
+#define glad_glGetnUniformuiv ( GladContext::currentTable->GetnUniformuiv )
+#define glad_glReadnPixels ( GladContext::currentTable->ReadnPixels )
+#define glad_glGetnMapdv ( GladContext::currentTable->GetnMapdv )
+#define glad_glGetnMapfv ( GladContext::currentTable->GetnMapfv )
+#define glad_glGetnMapiv ( GladContext::currentTable->GetnMapiv )
+#define glad_glGetnPixelMapfv ( GladContext::currentTable->GetnPixelMapfv )
+#define glad_glGetnPixelMapuiv ( GladContext::currentTable->GetnPixelMapuiv )
+#define glad_glGetnPixelMapusv ( GladContext::currentTable->GetnPixelMapusv )
+#define glad_glGetnPolygonStipple ( GladContext::currentTable->GetnPolygonStipple )
+#define glad_glGetnColorTable ( GladContext::currentTable->GetnColorTable )
+#define glad_glGetnConvolutionFilter ( GladContext::currentTable->GetnConvolutionFilter )
+#define glad_glGetnSeparableFilter ( GladContext::currentTable->GetnSeparableFilter )
+#define glad_glGetnHistogram ( GladContext::currentTable->GetnHistogram )
+#define glad_glGetnMinmax ( GladContext::currentTable->GetnMinmax )
+#define glad_glTextureBarrier ( GladContext::currentTable->TextureBarrier )
+#define glad_glSpecializeShader ( GladContext::currentTable->SpecializeShader )
+#define glad_glMultiDrawArraysIndirectCount ( GladContext::currentTable->MultiDrawArraysIndirectCount )
+#define glad_glMultiDrawElementsIndirectCount ( GladContext::currentTable->MultiDrawElementsIndirectCount )
+#define glad_glPolygonOffsetClamp ( GladContext::currentTable->PolygonOffsetClamp )
+// clang-format on
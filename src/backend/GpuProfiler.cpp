@@ -0,0 +1,194 @@
+#include "GpuProfiler.h"
+
+#include "Profiler.h"
+#include <cstdint>
+
+#include "GladContext.h"
+
+void GpuProfiler::init()
+{
+    isActive_ = Profiler::isEnabled() && glad_glQueryCounter;
+
+    if ( !isActive_ )
+    {
+        return;
+    }
+
+    for ( Frame& frame : frames_ )
+    {
+        glGenQueries( static_cast<GLsizei>( frame.timestampQueries.size() ), frame.timestampQueries.data() );
+        glGenQueries( 1, &frame.elapsedQuery );
+        frame.zones.reserve( MAX_ZONES );
+    }
+
+    calibrate();
+}
+
+void GpuProfiler::deinit()
+{
+    if ( !isActive_ )
+    {
+        return;
+    }
+
+    for ( Frame& frame : frames_ )
+    {
+        glDeleteQueries( static_cast<GLsizei>( frame.timestampQueries.size() ), frame.timestampQueries.data() );
+        glDeleteQueries( 1, &frame.elapsedQuery );
+        frame = {};
+    }
+
+    isActive_ = false;
+}
+
+void GpuProfiler::beginFrame()
+{
+    if ( !isActive_ )
+    {
+        return;
+    }
+
+    Frame& frame{ frames_[frameIndex_] };
+
+    //* Queries of FRAMES_IN_FLIGHT frames ago, before they are reused
+    if ( frame.isPending )
+    {
+        readBack( frame );
+    }
+
+    frame.zones.clear();
+    frame.openZones.clear();
+    frame.isPending = true;
+    isInFrame_ = true;
+
+    glBeginQuery( GL_TIME_ELAPSED, frame.elapsedQuery );
+}
+
+void GpuProfiler::endFrame()
+{
+    if ( !isInFrame_ )
+    {
+        return;
+    }
+
+    Frame& frame{ frames_[frameIndex_] };
+
+    while ( !frame.openZones.empty() )
+    {
+        endZone();
+    }
+
+    glEndQuery( GL_TIME_ELAPSED );
+
+    isInFrame_ = false;
+    frameIndex_ = ( frameIndex_ + 1 ) % FRAMES_IN_FLIGHT;
+
+    //* Keep GPU and CPU clocks from drifting apart
+    if ( frameIndex_ == 0 )
+    {
+        calibrate();
+    }
+}
+
+void GpuProfiler::beginZone( char const* name )
+{
+    if ( !isInFrame_ )
+    {
+        return;
+    }
+
+    Frame& frame{ frames_[frameIndex_] };
+
+    if ( frame.zones.size() == MAX_ZONES )
+    {
+        frame.openZones.push_back( -1 );
+        return;
+    }
+
+    int const index{ static_cast<int>( frame.zones.size() ) };
+    frame.zones.push_back( { name, 2 * index, 2 * index + 1 } );
+    frame.openZones.push_back( index );
+
+    glQueryCounter( frame.timestampQueries[2 * index], GL_TIMESTAMP );
+}
+
+void GpuProfiler::endZone()
+{
+    if ( !isInFrame_ )
+    {
+        return;
+    }
+
+    Frame& frame{ frames_[frameIndex_] };
+
+    if ( frame.openZones.empty() )
+    {
+        return;
+    }
+
+    int const index{ frame.openZones.back() };
+    frame.openZones.pop_back();
+
+    if ( index < 0 )
+    {
+        return;
+    }
+
+    glQueryCounter( frame.timestampQueries[frame.zones[index].endQuery], GL_TIMESTAMP );
+}
+
+void GpuProfiler::readBack( Frame& frame )
+{
+    frame.isPending = false;
+
+    //* The elapsed query ends last, so all timestamps are done once it is
+    GLint isAvailable{};
+    glGetQueryObjectiv( frame.elapsedQuery, GL_QUERY_RESULT_AVAILABLE, &isAvailable );
+
+    if ( !isAvailable )
+    {
+        return;
+    }
+
+    GLuint64 elapsed{};
+    glGetQueryObjectui64v( frame.elapsedQuery, GL_QUERY_RESULT, &elapsed );
+
+    if ( elapsed > static_cast<GLuint64>( MAX_FRAME_NS ) )
+    {
+        return;
+    }
+
+    for ( Zone const& zone : frame.zones )
+    {
+        GLuint64 begin{};
+        GLuint64 end{};
+        glGetQueryObjectui64v( frame.timestampQueries[zone.beginQuery], GL_QUERY_RESULT, &begin );
+        glGetQueryObjectui64v( frame.timestampQueries[zone.endQuery], GL_QUERY_RESULT, &end );
+
+        Profiler::recordGpuZone(
+            zone.name,
+            static_cast<int64_t>( begin ) + clockOffsetNs_,
+            static_cast<int64_t>( end ) + clockOffsetNs_
+        );
+    }
+
+    //* Only the duration is known, place it at the start of the first zone
+    int64_t start{ frame.zones.empty() ? Profiler::now() : 0 };
+
+    if ( !frame.zones.empty() )
+    {
+        GLuint64 first{};
+        glGetQueryObjectui64v( frame.timestampQueries[frame.zones.front().beginQuery], GL_QUERY_RESULT, &first );
+        start = static_cast<int64_t>( first ) + clockOffsetNs_;
+    }
+
+    Profiler::recordGpuZone( "gpu frame", start, start + static_cast<int64_t>( elapsed ) );
+}
+
+void GpuProfiler::calibrate()
+{
+    GLint64 gpuNow{};
+    glGetInteger64v( GL_TIMESTAMP, &gpuNow );
+
+    clockOffsetNs_ = Profiler::now() - gpuNow;
+}
@@ -0,0 +1,92 @@
+#ifndef IG20261019105200
+#define IG20261019105200
+
+#include "Profiler.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+//* GPU timing for the OpenGL based backends
+//* - zones are bracketed by GL_TIMESTAMP queries (they may nest), the whole frame by GL_TIME_ELAPSED
+//* - every frame has its own query pool, results are read FRAMES_IN_FLIGHT frames later
+//*   so the CPU never waits on the GPU; unfinished results are dropped
+//* - GPU timestamps are mapped to `Profiler::now()` and reported to the profiler's GPU lane
+//* Does nothing unless the profiler is enabled at `init()`.
+class GpuProfiler
+{
+public:
+    static int const FRAMES_IN_FLIGHT{ 3 };
+    static int const MAX_ZONES{ 64 };
+
+    //* Some drivers (eg. llvmpipe) report garbage for the very first queries, longer frames are dropped
+    static int64_t const MAX_FRAME_NS{ 1'000'000'000 };
+
+    void init();
+    void deinit();
+
+    void beginFrame();
+    void endFrame();
+
+    //* Ignored outside of begin/endFrame
+    void beginZone( char const* name );
+    void endZone();
+
+private:
+    struct Zone
+    {
+        char const* name{};
+        int beginQuery{};
+        int endQuery{};
+    };
+
+    struct Frame
+    {
+        std::array<unsigned int, 2 * MAX_ZONES> timestampQueries{};
+        unsigned int elapsedQuery{};
+        std::vector<Zone> zones{};
+        //* Zone indices, -1 for zones that did not fit
+        std::vector<int> openZones{};
+        bool isPending{};
+    };
+
+    void readBack( Frame& frame );
+    void calibrate();
+
+    bool isActive_{};
+    bool isInFrame_{};
+    int frameIndex_{};
+    std::array<Frame, FRAMES_IN_FLIGHT> frames_{};
+
+    //* `Profiler::now()` minus GL_TIMESTAMP
+    int64_t clockOffsetNs_{};
+};
+
+//* Records the enclosing scope on the GPU
+class GpuProfileZone
+{
+public:
+    GpuProfileZone(
+        GpuProfiler& profiler,
+        char const* name
+    )
+        : profiler_( profiler )
+    {
+        profiler_.beginZone( name );
+    }
+
+    ~GpuProfileZone() { profiler_.endZone(); }
+
+    GpuProfileZone( GpuProfileZone const& ) = delete;
+    GpuProfileZone& operator=( GpuProfileZone const& ) = delete;
+
+private:
+    GpuProfiler& profiler_;
+};
+
+#if defined( PROFILER_ZONES_ENABLED )
+#define PROFILE_GPU_ZONE( profiler, name ) GpuProfileZone const PROFILE_CONCAT( gpuProfileZone, __LINE__ ){ profiler, name }
+#else
+#define PROFILE_GPU_ZONE( profiler, name )
+#endif
+
+#endif
@@ -0,0 +1,97 @@
+#include "PresentTimer.h"
+
+#include "InputLatency.h"
+#include "Profiler.h"
+#include <cstdint>
+
+#include "GladContext.h"
+
+void PresentTimer::init()
+{
+    isActive_ = glad_glQueryCounter;
+
+    if ( !isActive_ )
+    {
+        return;
+    }
+
+    for ( Query& query : queries_ )
+    {
+        glGenQueries( 1, &query.id );
+        query.frame = -1;
+    }
+
+    calibrate();
+}
+
+void PresentTimer::deinit()
+{
+    if ( !isActive_ )
+    {
+        return;
+    }
+
+    for ( Query& query : queries_ )
+    {
+        glDeleteQueries( 1, &query.id );
+        query = {};
+    }
+
+    isActive_ = false;
+}
+
+void PresentTimer::afterSwap(
+    int64_t frame,
+    InputLatency& inputLatency
+)
+{
+    if ( !isActive_ )
+    {
+        return;
+    }
+
+    //* Older frames first, stop at the first one still in flight
+    for ( int i{ 1 }; i < FRAMES_IN_FLIGHT; ++i )
+    {
+        Query& query{ queries_[static_cast<size_t>( ( frame + i ) % FRAMES_IN_FLIGHT )] };
+
+        if ( query.frame < 0 )
+        {
+            continue;
+        }
+
+        GLint isAvailable{};
+        glGetQueryObjectiv( query.id, GL_QUERY_RESULT_AVAILABLE, &isAvailable );
+
+        if ( !isAvailable )
+        {
+            break;
+        }
+
+        GLuint64 timestamp{};
+        glGetQueryObjectui64v( query.id, GL_QUERY_RESULT, &timestamp );
+
+        inputLatency.onPresented( query.frame, static_cast<int64_t>( timestamp ) + clockOffsetNs_ );
+        query.frame = -1;
+    }
+
+    //* Not read in time, drop it
+    Query& query{ queries_[static_cast<size_t>( frame % FRAMES_IN_FLIGHT )] };
+
+    glQueryCounter( query.id, GL_TIMESTAMP );
+    query.frame = frame;
+
+    //* Keep GPU and CPU clocks from drifting apart
+    if ( frame % 256 == 0 )
+    {
+        calibrate();
+    }
+}
+
+void PresentTimer::calibrate()
+{
+    GLint64 gpuNow{};
+    glGetInteger64v( GL_TIMESTAMP, &gpuNow );
+
+    clockOffsetNs_ = Profiler::now() - gpuNow;
+}
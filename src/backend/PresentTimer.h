@@ -0,0 +1,43 @@
+#ifndef IG20261019105600
+#define IG20261019105600
+
+#include "InputLatency.h"
+#include <array>
+#include <cstdint>
+
+//* Time at which the GPU finished a frame's swap
+//* - a GL_TIMESTAMP query is issued right after the swap
+//* - results are read (non blocking) up to FRAMES_IN_FLIGHT frames later,
+//*   mapped to `Profiler::now()` and handed to `InputLatency::onPresented()`
+//* This is the closest a GL application gets to "photons": scan out follows within one refresh interval.
+class PresentTimer
+{
+public:
+    static int const FRAMES_IN_FLIGHT{ 4 };
+
+    //* Needs a current context
+    void init();
+    void deinit();
+
+    void afterSwap(
+        int64_t frame,
+        InputLatency& inputLatency
+    );
+
+private:
+    struct Query
+    {
+        unsigned int id{};
+        int64_t frame{ -1 };
+    };
+
+    void calibrate();
+
+    bool isActive_{};
+    std::array<Query, FRAMES_IN_FLIGHT> queries_{};
+
+    //* `Profiler::now()` minus GL_TIMESTAMP
+    int64_t clockOffsetNs_{};
+};
+
+#endif
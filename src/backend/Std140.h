@@ -0,0 +1,45 @@
+#ifndef IG20261019111400
+#define IG20261019111400
+
+#include <cstddef>
+
+//* C++ mirrors of GLSL `std140` block members
+//* - alignment as std140's base alignment: scalars 4, vec2 8, vec4 and mat4 16
+//* - vec3 is left out: in std140 a following scalar fills its 4th component, which C++ cannot
+//*   lay out the same way; use Vec4 (or a vec3 plus an explicit float) instead
+//* - arrays of scalars/vec2 are padded to 16 bytes per element in std140, use Vec4 elements
+//* Verify every block with STD140_OFFSET/STD140_SIZE against the offsets the shader implies,
+//* a mismatch is a compile error instead of garbage on the GPU.
+namespace Std140
+{
+    struct alignas( 8 ) Vec2
+    {
+        float x{};
+        float y{};
+    };
+
+    struct alignas( 16 ) Vec4
+    {
+        float x{};
+        float y{};
+        float z{};
+        float w{};
+    };
+
+    //* Column major, as `glUniformMatrix4fv( ..., GL_FALSE, ... )`
+    struct alignas( 16 ) Mat4
+    {
+        float values[16]{};
+    };
+
+    //* Block sizes are rounded up to 16 (the block's base alignment)
+    inline constexpr size_t BLOCK_ALIGNMENT{ 16 };
+}
+
+#define STD140_OFFSET( Block, member, offset ) \
+    static_assert( offsetof( Block, member ) == ( offset ), #Block "::" #member " is not at std140 offset " #offset )
+
+#define STD140_SIZE( Block, size ) \
+    static_assert( sizeof( Block ) == ( size ) && ( size ) % Std140::BLOCK_ALIGNMENT == 0, #Block " is not " #size " bytes" )
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef IG20261019111500
+#define IG20261019111500
+
+#include "Std140.h"
+
+//* Uniform blocks of assets/shaders/uniformBlocks.vert, binding points and layouts have to match
+
+//* Once per frame
+struct FrameBlock
+{
+    static unsigned int const BINDING{ 0 };
+
+    Std140::Mat4 viewProjection{};
+    float time{};
+    float deltaTime{};
+    Std140::Vec2 resolution{};
+};
+
+STD140_OFFSET( FrameBlock, viewProjection, 0 );
+STD140_OFFSET( FrameBlock, time, 64 );
+STD140_OFFSET( FrameBlock, deltaTime, 68 );
+STD140_OFFSET( FrameBlock, resolution, 72 );
+STD140_SIZE( FrameBlock, 80 );
+
+//* Once per draw
+struct ObjectBlock
+{
+    static unsigned int const BINDING{ 1 };
+
+    Std140::Mat4 model{};
+    Std140::Vec4 tint{};
+};
+
+STD140_OFFSET( ObjectBlock, model, 0 );
+STD140_OFFSET( ObjectBlock, tint, 64 );
+STD140_SIZE( ObjectBlock, 80 );
+
+//* Binding of the per-instance matrix array (`std430`) in assets/shaders/instanced.vert
+unsigned int const INSTANCE_MATRICES_BINDING{ 2 };
+
+#endif
@@ -0,0 +1,156 @@
+#include "Archetype.h"
+
+#include "Component.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace
+{
+    size_t alignUp(
+        size_t value,
+        size_t alignment
+    )
+    {
+        return ( value + alignment - 1 ) / alignment * alignment;
+    }
+
+    //* Lays out the columns for `capacity` entities, returns the bytes used
+    size_t layoutColumns(
+        ComponentMask mask,
+        int capacity,
+        std::array<uint32_t, MAX_COMPONENTS>& offsets
+    )
+    {
+        size_t offset{ sizeof( Entity ) * capacity };
+
+        for ( ComponentMask rest{ mask }; rest; rest &= rest - 1 )
+        {
+            int const id{ std::countr_zero( rest ) };
+            ComponentInfo const& info{ Components::info( id ) };
+
+            offset = alignUp( offset, std::max( info.alignment, size_t{ Archetype::CHUNK_ALIGNMENT } ) );
+            offsets[id] = static_cast<uint32_t>( offset );
+            offset += info.size * capacity;
+        }
+
+        return offset;
+    }
+}
+
+Archetype::Archetype( ComponentMask mask )
+    : mask_( mask )
+{
+    size_t bytesPerEntity{ sizeof( Entity ) };
+
+    for ( ComponentMask rest{ mask }; rest; rest &= rest - 1 )
+    {
+        int const id{ std::countr_zero( rest ) };
+
+        sizes_[id] = static_cast<uint32_t>( Components::info( id ).size );
+        bytesPerEntity += sizes_[id];
+    }
+
+    //* Largest capacity whose padded columns still fit,
+    //* components larger than a chunk still get one entity per (larger) chunk
+    capacity_ = std::max( static_cast<int>( CHUNK_SIZE / bytesPerEntity ), 1 );
+
+    while (
+        capacity_ > 1
+        && layoutColumns( mask_, capacity_, offsets_ ) > CHUNK_SIZE
+    )
+    {
+        --capacity_;
+    }
+
+    chunkBytes_ = std::max( size_t{ CHUNK_SIZE }, layoutColumns( mask_, capacity_, offsets_ ) );
+}
+
+Archetype::~Archetype()
+{
+    for ( Chunk& chunk : chunks_ )
+    {
+        ::operator delete( chunk.data, std::align_val_t{ CHUNK_ALIGNMENT } );
+    }
+
+    if ( spareChunk_ )
+    {
+        ::operator delete( spareChunk_, std::align_val_t{ CHUNK_ALIGNMENT } );
+    }
+}
+
+Archetype::Location Archetype::allocate( Entity entity )
+{
+    if (
+        chunks_.empty()
+        || chunks_.back().count == capacity_
+    )
+    {
+        std::byte* data{ spareChunk_ };
+        spareChunk_ = nullptr;
+
+        if ( !data )
+        {
+            data = static_cast<std::byte*>( ::operator new( chunkBytes_, std::align_val_t{ CHUNK_ALIGNMENT } ) );
+        }
+
+        chunks_.push_back( { data, 0 } );
+    }
+
+    int const chunk{ chunkCount() - 1 };
+    int const row{ chunks_.back().count++ };
+
+    entities( chunk )[row] = entity;
+    ++entityCount_;
+
+    return { chunk, row };
+}
+
+Entity Archetype::release( Location location )
+{
+    int const lastChunk{ chunkCount() - 1 };
+    int const lastRow{ chunks_.back().count - 1 };
+
+    Entity const moved{ entities( lastChunk )[lastRow] };
+
+    if (
+        location.chunk != lastChunk
+        || location.row != lastRow
+    )
+    {
+        entities( location.chunk )[location.row] = moved;
+
+        for ( ComponentMask rest{ mask_ }; rest; rest &= rest - 1 )
+        {
+            int const id{ std::countr_zero( rest ) };
+
+            std::memcpy(
+                component( location, id ),
+                component( { lastChunk, lastRow }, id ),
+                sizes_[id]
+            );
+        }
+    }
+
+    --entityCount_;
+
+    if ( --chunks_.back().count == 0 )
+    {
+        //* Only one spare: an archetype that shrank a lot still gives its memory back
+        if ( spareChunk_ )
+        {
+            ::operator delete( chunks_.back().data, std::align_val_t{ CHUNK_ALIGNMENT } );
+        }
+        else
+        {
+            spareChunk_ = chunks_.back().data;
+        }
+
+        chunks_.pop_back();
+    }
+
+    return moved;
+}
@@ -0,0 +1,105 @@
+#ifndef IG20261019112100
+#define IG20261019112100
+
+#include "Component.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//* All entities with exactly the same set of components
+//* - stored in chunks of CHUNK_SIZE bytes, one SoA column per component (plus the entity ids),
+//*   so iterating a component touches nothing but that component's memory
+//* - chunks are kept full except the last one: removal swaps the archetype's last entity into the hole
+//* - one emptied chunk is kept as a spare, so add/remove churn at a chunk boundary does not allocate
+//* Column offsets are the same in every chunk.
+class Archetype
+{
+public:
+    static size_t const CHUNK_SIZE{ 16 * 1024 };
+
+    //* Cache line, columns start at least this aligned (or their component's alignment)
+    static size_t const CHUNK_ALIGNMENT{ 64 };
+
+    struct Chunk
+    {
+        std::byte* data{};
+        int count{};
+    };
+
+    //* Slot of an entity
+    struct Location
+    {
+        int chunk{};
+        int row{};
+    };
+
+    explicit Archetype( ComponentMask mask );
+    ~Archetype();
+
+    Archetype( Archetype const& ) = delete;
+    Archetype& operator=( Archetype const& ) = delete;
+
+    ComponentMask mask() const { return mask_; }
+
+    bool has( int componentId ) const { return ( mask_ >> componentId ) & 1; }
+
+    //* Entities per chunk
+    int chunkCapacity() const { return capacity_; }
+
+    int chunkCount() const { return static_cast<int>( chunks_.size() ); }
+
+    Chunk const& chunk( int index ) const { return chunks_[index]; }
+
+    int entityCount() const { return entityCount_; }
+
+    Entity* entities( int chunk ) const { return reinterpret_cast<Entity*>( chunks_[chunk].data ); }
+
+    //* Start of a component's column in a chunk, the component has to be part of the archetype
+    std::byte* column(
+        int chunk,
+        int componentId
+    ) const
+    {
+        return chunks_[chunk].data + offsets_[componentId];
+    }
+
+    template <typename TComponent>
+    TComponent* column( int chunk ) const
+    {
+        return reinterpret_cast<TComponent*>( column( chunk, Components::id<TComponent>() ) );
+    }
+
+    std::byte* component(
+        Location location,
+        int componentId
+    ) const
+    {
+        return column( location.chunk, componentId ) + location.row * sizes_[componentId];
+    }
+
+    //* New slot at the end for `entity`, its components are left uninitialized
+    Location allocate( Entity entity );
+
+    //* Removes a slot by moving the last entity into it, returns the moved entity
+    //* (or `location`'s own entity if it was the last one)
+    Entity release( Location location );
+
+private:
+    ComponentMask mask_{};
+    int capacity_{};
+    //* CHUNK_SIZE unless a single entity is larger
+    size_t chunkBytes_{};
+    int entityCount_{};
+
+    //* Column offsets inside a chunk, by component id (the entity column is at 0)
+    std::array<uint32_t, MAX_COMPONENTS> offsets_{};
+    std::array<uint32_t, MAX_COMPONENTS> sizes_{};
+
+    std::vector<Chunk> chunks_{};
+
+    //* Last chunk that emptied, reused by the next `allocate()` that needs a chunk
+    std::byte* spareChunk_{};
+};
+
+#endif
@@ -0,0 +1,41 @@
+#include "Component.h"
+
+#include "Log.h"
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+
+namespace
+{
+    std::mutex registryMutex{};
+    std::array<ComponentInfo, MAX_COMPONENTS> infos{};
+    int componentCount{};
+}
+
+namespace Components
+{
+    int registerComponent(
+        size_t size,
+        size_t alignment
+    )
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+
+        if ( componentCount == MAX_COMPONENTS )
+        {
+            Log::error( "More than {} component types", MAX_COMPONENTS );
+            Log::flush();
+            std::abort();
+        }
+
+        infos[componentCount] = { size, alignment };
+
+        return componentCount++;
+    }
+
+    ComponentInfo const& info( int id )
+    {
+        return infos[id];
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef IG20261019112000
+#define IG20261019112000
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+//* Components are plain structs (trivially copyable, chunks move them with memcpy),
+//* numbered at first use; an archetype is the set of its components as a bit mask
+int const MAX_COMPONENTS{ 64 };
+
+using ComponentMask = uint64_t;
+
+//* Index into the store's entity records, generation detects stale handles
+struct Entity
+{
+    uint32_t index{};
+    uint32_t generation{};
+
+    bool operator==( Entity const& ) const = default;
+};
+
+struct ComponentInfo
+{
+    size_t size{};
+    size_t alignment{};
+};
+
+namespace Components
+{
+    //* Returns the new component's id, logs and aborts beyond MAX_COMPONENTS (a build time limit)
+    int registerComponent(
+        size_t size,
+        size_t alignment
+    );
+
+    ComponentInfo const& info( int id );
+
+    template <typename TComponent>
+    int id()
+    {
+        //* `T const` shares the id of `T`
+        if constexpr ( !std::is_same_v<TComponent, std::remove_cv_t<TComponent>> )
+        {
+            return id<std::remove_cv_t<TComponent>>();
+        }
+        else
+        {
+            static_assert( std::is_trivially_copyable_v<TComponent>, "Components are moved with memcpy" );
+
+            static int const componentId{ registerComponent( sizeof( TComponent ), alignof( TComponent ) ) };
+
+            return componentId;
+        }
+    }
+
+    template <typename... TComponents>
+    ComponentMask mask()
+    {
+        return ( ComponentMask{ 0 } | ... | ( ComponentMask{ 1 } << id<TComponents>() ) );
+    }
+}
+
+#endif
@@ -0,0 +1,107 @@
+#include "EntityStore.h"
+
+#include "Archetype.h"
+#include "Component.h"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+void EntityStore::destroy( Entity entity )
+{
+    if ( !isAlive( entity ) )
+    {
+        return;
+    }
+
+    release( entity );
+
+    //* Even: dead, the next `allocateEntity()` makes it odd again with a new value
+    ++records_[entity.index].generation;
+    freeIndices_.push_back( entity.index );
+    --entityCount_;
+}
+
+Entity EntityStore::allocateEntity()
+{
+    ++entityCount_;
+
+    if ( freeIndices_.empty() )
+    {
+        records_.push_back( { 1 } );
+
+        return { static_cast<uint32_t>( records_.size() - 1 ), 1 };
+    }
+
+    uint32_t const index{ freeIndices_.back() };
+    freeIndices_.pop_back();
+
+    return { index, ++records_[index].generation };
+}
+
+int EntityStore::findOrCreateArchetype( ComponentMask mask )
+{
+    auto const found{ archetypeIndices_.find( mask ) };
+
+    if ( found != archetypeIndices_.end() )
+    {
+        return found->second;
+    }
+
+    archetypes_.push_back( std::make_unique<Archetype>( mask ) );
+    archetypeIndices_.emplace( mask, archetypeCount() - 1 );
+
+    return archetypeCount() - 1;
+}
+
+void EntityStore::place(
+    Entity entity,
+    int archetype
+)
+{
+    Record& record{ records_[entity.index] };
+
+    record.archetype = archetype;
+    record.location = archetypes_[archetype]->allocate( entity );
+}
+
+void EntityStore::move(
+    Entity entity,
+    int archetype
+)
+{
+    Record const previous{ records_[entity.index] };
+    Archetype const& source{ *archetypes_[previous.archetype] };
+    Archetype& target{ *archetypes_[archetype] };
+
+    Archetype::Location const location{ target.allocate( entity ) };
+
+    for ( ComponentMask rest{ source.mask() & target.mask() }; rest; rest &= rest - 1 )
+    {
+        int const id{ std::countr_zero( rest ) };
+
+        std::memcpy(
+            target.component( location, id ),
+            source.component( previous.location, id ),
+            Components::info( id ).size
+        );
+    }
+
+    release( entity );
+
+    records_[entity.index].archetype = archetype;
+    records_[entity.index].location = location;
+}
+
+void EntityStore::release( Entity entity )
+{
+    Record const& record{ records_[entity.index] };
+    Archetype::Location const location{ record.location };
+
+    Entity const moved{ archetypes_[record.archetype]->release( location ) };
+
+    if ( moved != entity )
+    {
+        records_[moved.index].location = location;
+    }
+}
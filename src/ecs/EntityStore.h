@@ -0,0 +1,140 @@
+#ifndef IG20261019112200
+#define IG20261019112200
+
+#include "Archetype.h"
+#include "Component.h"
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+//* Entities and their components, grouped into archetypes (see Archetype.h)
+//* - handles are index + generation, a destroyed entity's handle is never alive again
+//* - adding or removing a component moves the entity to another archetype (a memcpy per component)
+//* - archetypes are never removed, so their indices are stable for `Query`
+//* Not thread safe; structural changes (create, destroy, add, remove) must not overlap a query's iteration,
+//* component values may be written from the query's jobs.
+class EntityStore
+{
+public:
+    template <typename... TComponents>
+    Entity create( TComponents const&... components )
+    {
+        Entity const entity{ allocateEntity() };
+        int const archetype{ findOrCreateArchetype( Components::mask<TComponents...>() ) };
+
+        place( entity, archetype );
+        ( new ( slot( entity, Components::id<TComponents>() ) ) TComponents( components ), ... );
+
+        return entity;
+    }
+
+    //* Ignores handles that are not alive
+    void destroy( Entity entity );
+
+    bool isAlive( Entity entity ) const
+    {
+        return ( entity.generation & 1 )
+               && entity.index < records_.size()
+               && records_[entity.index].generation == entity.generation;
+    }
+
+    template <typename TComponent>
+    bool has( Entity entity ) const
+    {
+        return isAlive( entity )
+               && archetypes_[records_[entity.index].archetype]->has( Components::id<TComponent>() );
+    }
+
+    //* The entity has to have the component
+    template <typename TComponent>
+    TComponent& get( Entity entity )
+    {
+        return *std::launder( reinterpret_cast<TComponent*>( slot( entity, Components::id<TComponent>() ) ) );
+    }
+
+    //* Sets the component, adding it first if the entity has none
+    template <typename TComponent>
+    void add(
+        Entity entity,
+        TComponent const& component
+    )
+    {
+        if ( !has<TComponent>( entity ) )
+        {
+            int const id{ Components::id<TComponent>() };
+
+            move( entity, findOrCreateArchetype( archetypes_[records_[entity.index].archetype]->mask() | ( ComponentMask{ 1 } << id ) ) );
+            new ( slot( entity, id ) ) TComponent( component );
+
+            return;
+        }
+
+        get<TComponent>( entity ) = component;
+    }
+
+    template <typename TComponent>
+    void remove( Entity entity )
+    {
+        if ( !has<TComponent>( entity ) )
+        {
+            return;
+        }
+
+        move( entity, findOrCreateArchetype( archetypes_[records_[entity.index].archetype]->mask() & ~( ComponentMask{ 1 } << Components::id<TComponent>() ) ) );
+    }
+
+    int entityCount() const { return entityCount_; }
+
+    int archetypeCount() const { return static_cast<int>( archetypes_.size() ); }
+
+    Archetype const& archetype( int index ) const { return *archetypes_[index]; }
+
+private:
+    struct Record
+    {
+        //* Odd while alive
+        uint32_t generation{};
+        int archetype{};
+        Archetype::Location location{};
+    };
+
+    Entity allocateEntity();
+
+    int findOrCreateArchetype( ComponentMask mask );
+
+    //* New slot in `archetype`, components uninitialized
+    void place(
+        Entity entity,
+        int archetype
+    );
+
+    //* To `archetype`, keeping the components both archetypes have
+    void move(
+        Entity entity,
+        int archetype
+    );
+
+    //* Releases the entity's slot and fixes the record of the entity moved into it
+    void release( Entity entity );
+
+    std::byte* slot(
+        Entity entity,
+        int componentId
+    ) const
+    {
+        Record const& record{ records_[entity.index] };
+
+        return archetypes_[record.archetype]->component( record.location, componentId );
+    }
+
+    std::vector<Record> records_{};
+    std::vector<uint32_t> freeIndices_{};
+    int entityCount_{};
+
+    std::vector<std::unique_ptr<Archetype>> archetypes_{};
+    std::unordered_map<ComponentMask, int> archetypeIndices_{};
+};
+
+#endif
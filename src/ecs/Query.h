@@ -0,0 +1,146 @@
+#ifndef IG20261019112300
+#define IG20261019112300
+
+#include "Archetype.h"
+#include "Component.h"
+#include "EntityStore.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <vector>
+
+//* Entities having (at least) all of `TComponents`, iterated chunk by chunk
+//* - the matching archetypes are cached; archetypes created since the last iteration are
+//*   checked at the start of the next one, so a query costs nothing per frame once the scene is built
+//* - `const` components are read only (`Query<Transform const, Bounds>`)
+//* - `forEachChunk( f )` calls `f( count, Entity const*, TComponents*... columns )` per chunk,
+//*   `forEach( f )` calls `f( TComponents&... )` per entity
+//* - `parallelForEachChunk()` splits the chunks over the job system's workers
+template <typename... TComponents>
+class Query
+{
+public:
+    //* Chunks per job
+    static int const GRAIN_SIZE{ 16 };
+
+    explicit Query( EntityStore const& store )
+        : store_( store )
+        , mask_( Components::mask<TComponents...>() )
+    {
+    }
+
+    template <typename TFunction>
+    void forEachChunk( TFunction&& function )
+    {
+        refresh();
+
+        for ( int archetypeIndex : archetypes_ )
+        {
+            Archetype const& archetype{ store_.archetype( archetypeIndex ) };
+
+            for ( int chunk{ 0 }; chunk < archetype.chunkCount(); ++chunk )
+            {
+                function(
+                    archetype.chunk( chunk ).count,
+                    static_cast<Entity const*>( archetype.entities( chunk ) ),
+                    archetype.template column<TComponents>( chunk )...
+                );
+            }
+        }
+    }
+
+    template <typename TFunction>
+    void forEach( TFunction&& function )
+    {
+        forEachChunk(
+            [&function]( int count, Entity const*, TComponents*... columns )
+            {
+                for ( int i{ 0 }; i < count; ++i )
+                {
+                    function( columns[i]... );
+                }
+            }
+        );
+    }
+
+    //* Returns when all chunks are done
+    template <typename TFunction>
+    void parallelForEachChunk(
+        JobSystem& jobs,
+        TFunction const& function
+    )
+    {
+        refresh();
+
+        //* Flattened once per call, so jobs get equal shares of chunks across archetypes
+        chunks_.clear();
+
+        for ( int archetypeIndex : archetypes_ )
+        {
+            for ( int chunk{ 0 }; chunk < store_.archetype( archetypeIndex ).chunkCount(); ++chunk )
+            {
+                chunks_.push_back( { archetypeIndex, chunk } );
+            }
+        }
+
+        jobs.parallelFor(
+            static_cast<int>( chunks_.size() ),
+            GRAIN_SIZE,
+            [this, &function]( int begin, int end )
+            {
+                for ( int i{ begin }; i < end; ++i )
+                {
+                    Archetype const& archetype{ store_.archetype( chunks_[i].archetype ) };
+                    int const chunk{ chunks_[i].chunk };
+
+                    function(
+                        archetype.chunk( chunk ).count,
+                        static_cast<Entity const*>( archetype.entities( chunk ) ),
+                        archetype.template column<TComponents>( chunk )...
+                    );
+                }
+            }
+        );
+    }
+
+    int count()
+    {
+        refresh();
+
+        int entityCount{ 0 };
+
+        for ( int archetypeIndex : archetypes_ )
+        {
+            entityCount += store_.archetype( archetypeIndex ).entityCount();
+        }
+
+        return entityCount;
+    }
+
+private:
+    struct ChunkRef
+    {
+        int archetype{};
+        int chunk{};
+    };
+
+    void refresh()
+    {
+        for ( ; checkedCount_ < store_.archetypeCount(); ++checkedCount_ )
+        {
+            if ( ( store_.archetype( checkedCount_ ).mask() & mask_ ) == mask_ )
+            {
+                archetypes_.push_back( checkedCount_ );
+            }
+        }
+    }
+
+    EntityStore const& store_;
+    ComponentMask mask_{};
+
+    std::vector<int> archetypes_{};
+    int checkedCount_{};
+
+    std::vector<ChunkRef> chunks_{};
+};
+
+#endif
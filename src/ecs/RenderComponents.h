@@ -0,0 +1,36 @@
+#ifndef IG20261019112400
+#define IG20261019112400
+
+#include "Math.h"
+#include <cstdint>
+
+//* Components of renderable entities
+//* Position, rotation and scale are the `Transform` from Math.h (local to world, no hierarchy;
+//* hierarchical scenes keep theirs in the SceneGraph and copy the world matrix out).
+
+//* Index into the renderer's meshes
+struct MeshHandle
+{
+    uint32_t index{};
+};
+
+//* Index into the renderer's materials (shader program, textures, uniform values)
+struct MaterialHandle
+{
+    uint32_t index{};
+};
+
+//* World space bounding sphere, for culling
+struct Bounds
+{
+    Vec3 center{};
+    float radius{};
+};
+
+//* Model matrix as uploaded per instance
+struct WorldMatrix
+{
+    Mat4 value{};
+};
+
+#endif
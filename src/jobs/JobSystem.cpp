@@ -0,0 +1,221 @@
+#include "JobSystem.h"
+
+#include "Profiler.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    //* Worker identity of the calling thread
+    thread_local JobSystem const* currentSystem{ nullptr };
+    thread_local int currentIndex{ -1 };
+
+    //* Failed steal rounds before a worker goes to sleep
+    int const SPIN_ROUNDS{ 64 };
+}
+
+JobSystem::JobSystem( int workerCount )
+{
+    int const count{
+        workerCount > 0
+            ? workerCount
+            : std::max( static_cast<int>( std::thread::hardware_concurrency() ), 1 )
+    };
+
+    for ( int i{ 0 }; i < count; ++i )
+    {
+        workers_.push_back( std::make_unique<Worker>() );
+    }
+
+    currentSystem = this;
+    currentIndex = 0;
+
+    for ( int i{ 1 }; i < count; ++i )
+    {
+        threads_.emplace_back(
+            [this, i]()
+            {
+                workerLoop( i );
+            }
+        );
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        quit_ = true;
+    }
+
+    wakeCondition_.notify_all();
+
+    for ( std::thread& thread : threads_ )
+    {
+        thread.join();
+    }
+
+    if ( currentSystem == this )
+    {
+        currentSystem = nullptr;
+        currentIndex = -1;
+    }
+}
+
+void JobSystem::wait( JobCounter& counter )
+{
+    int const worker{ currentWorker() };
+
+    while ( !counter.isDone() )
+    {
+        if ( !runOne( worker ) )
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+int JobSystem::currentWorker() const
+{
+    return ( currentSystem == this ) ? currentIndex : -1;
+}
+
+JobSystem::Job* JobSystem::allocate()
+{
+    int const worker{ currentWorker() };
+
+    if ( worker < 0 )
+    {
+        return nullptr;
+    }
+
+    Worker& owner{ *workers_[worker] };
+    Job& job{ owner.jobs[owner.nextJob] };
+
+    //* Slots are reused round robin, a slot still queued or running means too many jobs in flight
+    if ( !job.isFree.load( std::memory_order_acquire ) )
+    {
+        return nullptr;
+    }
+
+    owner.nextJob = ( owner.nextJob + 1 ) % JOBS_PER_WORKER;
+    job.isFree.store( false, std::memory_order_relaxed );
+
+    return &job;
+}
+
+void JobSystem::submit( Job* job )
+{
+    if ( !workers_[currentWorker()]->deque.push( job ) )
+    {
+        execute( *job );
+        return;
+    }
+
+    //* Pairs with the sleeper's increment and `hasWork()` check: either the sleeper sees the job
+    //* or this sees the sleeper (and notifies under the mutex, after the sleeper started waiting)
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    if ( sleepingWorkers_.load( std::memory_order_relaxed ) > 0 )
+    {
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+        }
+
+        wakeCondition_.notify_one();
+    }
+}
+
+bool JobSystem::runOne( int worker )
+{
+    Job* job{ worker >= 0 ? workers_[worker]->deque.pop() : nullptr };
+
+    int const count{ workerCount() };
+
+    for ( int i{ 1 }; !job && i <= count; ++i )
+    {
+        int const victim{ ( worker + i + count ) % count };
+
+        if ( victim != worker )
+        {
+            job = workers_[victim]->deque.steal();
+        }
+    }
+
+    if ( !job )
+    {
+        return false;
+    }
+
+    execute( *job );
+
+    return true;
+}
+
+void JobSystem::execute( Job& job )
+{
+    JobCounter* counter{ job.counter };
+
+    job.invoke( job );
+    job.isFree.store( true, std::memory_order_release );
+
+    counter->pending.fetch_sub( 1, std::memory_order_release );
+}
+
+bool JobSystem::hasWork() const
+{
+    for ( auto const& worker : workers_ )
+    {
+        if ( !worker->deque.isEmpty() )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void JobSystem::workerLoop( int worker )
+{
+    currentSystem = this;
+    currentIndex = worker;
+    Profiler::setThreadName( "job worker" );
+
+    int idleRounds{ 0 };
+
+    while ( true )
+    {
+        if ( runOne( worker ) )
+        {
+            idleRounds = 0;
+            continue;
+        }
+
+        if ( ++idleRounds < SPIN_ROUNDS )
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock( mutex_ );
+        sleepingWorkers_.fetch_add( 1, std::memory_order_seq_cst );
+
+        wakeCondition_.wait(
+            lock,
+            [this]()
+            {
+                return quit_ || hasWork();
+            }
+        );
+
+        sleepingWorkers_.fetch_sub( 1, std::memory_order_relaxed );
+        idleRounds = 0;
+
+        if ( quit_ )
+        {
+            return;
+        }
+    }
+}
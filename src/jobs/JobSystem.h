@@ -0,0 +1,159 @@
+#ifndef IG20261019110000
+#define IG20261019110000
+
+#include "WorkStealingDeque.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//* Unfinished jobs of a group, `JobSystem::wait()` returns once it is zero
+//* Dependencies are counters: a job that needs others done waits on their counter
+//* (waiting runs other jobs meanwhile, so nothing blocks a worker).
+struct JobCounter
+{
+    std::atomic<int> pending{ 0 };
+
+    bool isDone() const { return pending.load( std::memory_order_acquire ) == 0; }
+};
+
+//* Work stealing job system
+//* - one worker per core, the thread that creates the system is worker 0 and works while it waits
+//* - every worker has a Chase-Lev deque and a pool of job slots allocated up front,
+//*   idle workers steal from the others and sleep when there is nothing to steal
+//* - jobs are callables up to JOB_STORAGE_SIZE bytes, stored in the slot (no allocation per job)
+//* Threads that are not workers (or run out of free slots) run their jobs inline.
+class JobSystem
+{
+public:
+    static int const JOBS_PER_WORKER{ 4096 };
+    static int const JOB_STORAGE_SIZE{ 64 };
+
+    //* 0 uses all cores
+    explicit JobSystem( int workerCount );
+    ~JobSystem();
+
+    JobSystem( JobSystem const& ) = delete;
+    JobSystem& operator=( JobSystem const& ) = delete;
+
+    int workerCount() const { return static_cast<int>( workers_.size() ); }
+
+    template <typename TFunction>
+    void run(
+        JobCounter& counter,
+        TFunction&& function
+    )
+    {
+        using Function = std::decay_t<TFunction>;
+
+        static_assert( sizeof( Function ) <= JOB_STORAGE_SIZE, "Capture less (eg. a pointer to a struct)" );
+        static_assert( alignof( Function ) <= alignof( std::max_align_t ) );
+
+        Job* job{ allocate() };
+
+        if ( !job )
+        {
+            function();
+            return;
+        }
+
+        new ( job->storage ) Function( std::forward<TFunction>( function ) );
+        job->invoke = []( Job& self )
+        {
+            Function* stored{ std::launder( reinterpret_cast<Function*>( self.storage ) ) };
+            ( *stored )();
+            stored->~Function();
+        };
+        job->counter = &counter;
+
+        counter.pending.fetch_add( 1, std::memory_order_relaxed );
+        submit( job );
+    }
+
+    //* Runs other jobs until `counter` is zero
+    void wait( JobCounter& counter );
+
+    //* `function( begin, end )` on chunks of at most `grainSize` of [0, count), returns when all are done
+    template <typename TFunction>
+    void parallelFor(
+        int count,
+        int grainSize,
+        TFunction const& function
+    )
+    {
+        JobCounter counter{};
+        int const grain{ std::max( grainSize, 1 ) };
+
+        for ( int begin{ 0 }; begin < count; begin += grain )
+        {
+            int const end{ std::min( begin + grain, count ) };
+
+            run(
+                counter,
+                [&function, begin, end]()
+                {
+                    function( begin, end );
+                }
+            );
+        }
+
+        wait( counter );
+    }
+
+private:
+    struct Job
+    {
+        void ( *invoke )( Job& ){};
+        JobCounter* counter{};
+        std::atomic<bool> isFree{ true };
+        alignas( std::max_align_t ) unsigned char storage[JOB_STORAGE_SIZE]{};
+    };
+
+    struct Worker
+    {
+        Worker()
+            : deque( JOBS_PER_WORKER )
+            , jobs( std::make_unique<Job[]>( JOBS_PER_WORKER ) )
+        {
+        }
+
+        WorkStealingDeque<Job> deque;
+        std::unique_ptr<Job[]> jobs;
+        int nextJob{};
+    };
+
+    //* Index of the calling thread, -1 if it is no worker of this system
+    int currentWorker() const;
+
+    //* Free slot of the calling worker, nullptr if there is none
+    Job* allocate();
+
+    void submit( Job* job );
+
+    //* Pop (own deque) or steal one job and run it, false if there was none
+    bool runOne( int worker );
+
+    void execute( Job& job );
+
+    bool hasWork() const;
+
+    void workerLoop( int worker );
+
+    std::vector<std::unique_ptr<Worker>> workers_{};
+    std::vector<std::thread> threads_{};
+
+    //* Sleeping workers
+    std::mutex mutex_{};
+    std::condition_variable wakeCondition_{};
+    std::atomic<int> sleepingWorkers_{};
+    bool quit_{};
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef IG20261019105900
+#define IG20261019105900
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+//* Chase-Lev work stealing deque (fixed capacity, C11 memory model version by Lê et al.)
+//* - the owner thread pushes and pops at the bottom (LIFO, cache warm)
+//* - any other thread steals from the top (FIFO, oldest and usually largest work)
+//* Only the owner's pop and a steal of the last element race, they are decided by a CAS on `top_`.
+template <typename T>
+class WorkStealingDeque
+{
+public:
+    //* Rounded up to a power of two
+    explicit WorkStealingDeque( int capacity )
+    {
+        size_t size{ 1 };
+
+        while ( size < static_cast<size_t>( capacity ) )
+        {
+            size *= 2;
+        }
+
+        buffer_ = std::vector<std::atomic<T*>>( size );
+        mask_ = static_cast<int64_t>( size ) - 1;
+    }
+
+    //* Owner only, false when full
+    bool push( T* item )
+    {
+        int64_t const bottom{ bottom_.load( std::memory_order_relaxed ) };
+        int64_t const top{ top_.load( std::memory_order_acquire ) };
+
+        if ( bottom - top > mask_ )
+        {
+            return false;
+        }
+
+        //* Release: a thief that sees the new bottom also sees the item (and what it points to)
+        buffer_[bottom & mask_].store( item, std::memory_order_relaxed );
+        bottom_.store( bottom + 1, std::memory_order_release );
+
+        return true;
+    }
+
+    //* Owner only, nullptr when empty
+    T* pop()
+    {
+        int64_t const bottom{ bottom_.load( std::memory_order_relaxed ) - 1 };
+        bottom_.store( bottom, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        int64_t top{ top_.load( std::memory_order_relaxed ) };
+
+        if ( top > bottom )
+        {
+            bottom_.store( bottom + 1, std::memory_order_relaxed );
+            return nullptr;
+        }
+
+        T* item{ buffer_[bottom & mask_].load( std::memory_order_relaxed ) };
+
+        //* Last element, thieves may want it too
+        if ( top == bottom )
+        {
+            if ( !top_.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+            {
+                item = nullptr;
+            }
+
+            bottom_.store( bottom + 1, std::memory_order_relaxed );
+        }
+
+        return item;
+    }
+
+    //* Any thread, nullptr when empty or the race was lost
+    T* steal()
+    {
+        int64_t top{ top_.load( std::memory_order_acquire ) };
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        int64_t const bottom{ bottom_.load( std::memory_order_acquire ) };
+
+        if ( top >= bottom )
+        {
+            return nullptr;
+        }
+
+        T* item{ buffer_[top & mask_].load( std::memory_order_relaxed ) };
+
+        if ( !top_.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+        {
+            return nullptr;
+        }
+
+        return item;
+    }
+
+    //* Approximate unless called by the owner
+    bool isEmpty() const
+    {
+        return bottom_.load( std::memory_order_relaxed ) <= top_.load( std::memory_order_relaxed );
+    }
+
+private:
+    //* Separate cache lines, thieves hammer `top_` while the owner works at `bottom_`
+    alignas( 64 ) std::atomic<int64_t> top_{ 0 };
+    alignas( 64 ) std::atomic<int64_t> bottom_{ 0 };
+    std::vector<std::atomic<T*>> buffer_{};
+    int64_t mask_{};
+};
+
+#endif
@@ -0,0 +1,482 @@
+#include "Math.h"
+
+#include "CpuFeatures.h"
+#include <cmath>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#define MATH_SSE
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#define MATH_NEON
+#endif
+
+namespace
+{
+    //* Reference for the SIMD kernels, same summation order as `multiplyMatricesSimd4()`
+    void multiplyScalar(
+        Mat4 const& a,
+        Mat4 const& b,
+        Mat4& out
+    )
+    {
+        Mat4 result;
+
+        for ( int column{ 0 }; column < 4; ++column )
+        {
+            for ( int row{ 0 }; row < 4; ++row )
+            {
+                result( row, column ) = a( row, 0 ) * b( 0, column )
+                                        + a( row, 1 ) * b( 1, column )
+                                        + a( row, 2 ) * b( 2, column )
+                                        + a( row, 3 ) * b( 3, column );
+            }
+        }
+
+        out = result;
+    }
+
+    void multiplyBatch(
+        Mat4 const* left,
+        int leftStride,
+        Mat4 const* right,
+        Mat4* out,
+        int count,
+        SimdLevel level
+    )
+    {
+        int done{ 0 };
+
+        switch ( level )
+        {
+            case SimdLevel::AVX2:
+            {
+                done = Math::multiplyMatricesAvx2( left, leftStride, right, out, count );
+                break;
+            }
+
+            case SimdLevel::SSE:
+            case SimdLevel::NEON:
+            {
+                done = Math::multiplyMatricesSimd4( left, leftStride, right, out, count );
+                break;
+            }
+
+            case SimdLevel::SCALAR:
+            {
+                break;
+            }
+        }
+
+        for ( int i{ done }; i < count; ++i )
+        {
+            multiplyScalar( left[i * leftStride], right[i], out[i] );
+        }
+    }
+}
+
+Quat operator*(
+    Quat a,
+    Quat b
+)
+{
+    return {
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    };
+}
+
+Mat4 operator*(
+    Mat4 const& a,
+    Mat4 const& b
+)
+{
+    Mat4 result;
+    multiplyScalar( a, b, result );
+
+    return result;
+}
+
+Vec4 operator*(
+    Mat4 const& m,
+    Vec4 v
+)
+{
+    return {
+        m( 0, 0 ) * v.x + m( 0, 1 ) * v.y + m( 0, 2 ) * v.z + m( 0, 3 ) * v.w,
+        m( 1, 0 ) * v.x + m( 1, 1 ) * v.y + m( 1, 2 ) * v.z + m( 1, 3 ) * v.w,
+        m( 2, 0 ) * v.x + m( 2, 1 ) * v.y + m( 2, 2 ) * v.z + m( 2, 3 ) * v.w,
+        m( 3, 0 ) * v.x + m( 3, 1 ) * v.y + m( 3, 2 ) * v.z + m( 3, 3 ) * v.w
+    };
+}
+
+namespace Math
+{
+    float length( Vec3 v )
+    {
+        return std::sqrt( dot( v, v ) );
+    }
+
+    Vec3 normalize( Vec3 v )
+    {
+        float const vectorLength{ length( v ) };
+
+        return ( vectorLength > 0.0f ) ? v * ( 1.0f / vectorLength ) : v;
+    }
+
+    Quat normalize( Quat q )
+    {
+        float const quatLength{ std::sqrt( q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w ) };
+
+        if ( quatLength <= 0.0f )
+        {
+            return q;
+        }
+
+        float const scale{ 1.0f / quatLength };
+
+        return { q.x * scale, q.y * scale, q.z * scale, q.w * scale };
+    }
+
+    Quat fromAxisAngle(
+        Vec3 axis,
+        float angle
+    )
+    {
+        Vec3 const unit{ normalize( axis ) };
+        float const halfSin{ std::sin( 0.5f * angle ) };
+
+        return { unit.x * halfSin, unit.y * halfSin, unit.z * halfSin, std::cos( 0.5f * angle ) };
+    }
+
+    Quat conjugate( Quat q )
+    {
+        return { -q.x, -q.y, -q.z, q.w };
+    }
+
+    Quat fromRotation( Mat4 const& m )
+    {
+        //* Largest component first, the others divided by it
+        float const trace{ m( 0, 0 ) + m( 1, 1 ) + m( 2, 2 ) };
+
+        if ( trace > 0.0f )
+        {
+            float const s{ 0.5f / std::sqrt( trace + 1.0f ) };
+
+            return { ( m( 2, 1 ) - m( 1, 2 ) ) * s, ( m( 0, 2 ) - m( 2, 0 ) ) * s, ( m( 1, 0 ) - m( 0, 1 ) ) * s, 0.25f / s };
+        }
+
+        if ( m( 0, 0 ) > m( 1, 1 ) && m( 0, 0 ) > m( 2, 2 ) )
+        {
+            float const s{ 2.0f * std::sqrt( 1.0f + m( 0, 0 ) - m( 1, 1 ) - m( 2, 2 ) ) };
+
+            return { 0.25f * s, ( m( 0, 1 ) + m( 1, 0 ) ) / s, ( m( 0, 2 ) + m( 2, 0 ) ) / s, ( m( 2, 1 ) - m( 1, 2 ) ) / s };
+        }
+
+        if ( m( 1, 1 ) > m( 2, 2 ) )
+        {
+            float const s{ 2.0f * std::sqrt( 1.0f + m( 1, 1 ) - m( 0, 0 ) - m( 2, 2 ) ) };
+
+            return { ( m( 0, 1 ) + m( 1, 0 ) ) / s, 0.25f * s, ( m( 1, 2 ) + m( 2, 1 ) ) / s, ( m( 0, 2 ) - m( 2, 0 ) ) / s };
+        }
+
+        float const s{ 2.0f * std::sqrt( 1.0f + m( 2, 2 ) - m( 0, 0 ) - m( 1, 1 ) ) };
+
+        return { ( m( 0, 2 ) + m( 2, 0 ) ) / s, ( m( 1, 2 ) + m( 2, 1 ) ) / s, 0.25f * s, ( m( 1, 0 ) - m( 0, 1 ) ) / s };
+    }
+
+    Vec3 rotate(
+        Quat q,
+        Vec3 v
+    )
+    {
+        //* v + 2w (u x v) + 2 u x (u x v), u the vector part
+        Vec3 const u{ q.x, q.y, q.z };
+        Vec3 const t{ cross( u, v ) * 2.0f };
+
+        return v + t * q.w + cross( u, t );
+    }
+
+    Mat4 translation( Vec3 offset )
+    {
+        Mat4 result;
+        result( 0, 3 ) = offset.x;
+        result( 1, 3 ) = offset.y;
+        result( 2, 3 ) = offset.z;
+
+        return result;
+    }
+
+    Mat4 scaling( Vec3 factors )
+    {
+        Mat4 result;
+        result( 0, 0 ) = factors.x;
+        result( 1, 1 ) = factors.y;
+        result( 2, 2 ) = factors.z;
+
+        return result;
+    }
+
+    Mat4 rotation( Quat q )
+    {
+        return compose( { {}, q, { 1.0f, 1.0f, 1.0f } } );
+    }
+
+    Mat4 compose( Transform const& transform )
+    {
+        Quat const& q{ transform.rotation };
+        Vec3 const& s{ transform.scale };
+
+        float const xx{ q.x * q.x };
+        float const yy{ q.y * q.y };
+        float const zz{ q.z * q.z };
+        float const xy{ q.x * q.y };
+        float const xz{ q.x * q.z };
+        float const yz{ q.y * q.z };
+        float const wx{ q.w * q.x };
+        float const wy{ q.w * q.y };
+        float const wz{ q.w * q.z };
+
+        //* Rotation columns scaled per axis
+        Mat4 result;
+        result( 0, 0 ) = ( 1.0f - 2.0f * ( yy + zz ) ) * s.x;
+        result( 1, 0 ) = ( 2.0f * ( xy + wz ) ) * s.x;
+        result( 2, 0 ) = ( 2.0f * ( xz - wy ) ) * s.x;
+
+        result( 0, 1 ) = ( 2.0f * ( xy - wz ) ) * s.y;
+        result( 1, 1 ) = ( 1.0f - 2.0f * ( xx + zz ) ) * s.y;
+        result( 2, 1 ) = ( 2.0f * ( yz + wx ) ) * s.y;
+
+        result( 0, 2 ) = ( 2.0f * ( xz + wy ) ) * s.z;
+        result( 1, 2 ) = ( 2.0f * ( yz - wx ) ) * s.z;
+        result( 2, 2 ) = ( 1.0f - 2.0f * ( xx + yy ) ) * s.z;
+
+        result( 0, 3 ) = transform.position.x;
+        result( 1, 3 ) = transform.position.y;
+        result( 2, 3 ) = transform.position.z;
+
+        return result;
+    }
+
+    Mat4 perspective(
+        float fovY,
+        float aspect,
+        float nearPlane,
+        float farPlane
+    )
+    {
+        float const focal{ 1.0f / std::tan( 0.5f * fovY ) };
+        float const depth{ 1.0f / ( nearPlane - farPlane ) };
+
+        Mat4 result;
+        result( 0, 0 ) = focal / aspect;
+        result( 1, 1 ) = focal;
+        result( 2, 2 ) = ( farPlane + nearPlane ) * depth;
+        result( 3, 2 ) = -1.0f;
+        result( 2, 3 ) = 2.0f * farPlane * nearPlane * depth;
+        result( 3, 3 ) = 0.0f;
+
+        return result;
+    }
+
+    Mat4 orthographic(
+        float left,
+        float right,
+        float bottom,
+        float top,
+        float nearPlane,
+        float farPlane
+    )
+    {
+        Mat4 result;
+        result( 0, 0 ) = 2.0f / ( right - left );
+        result( 1, 1 ) = 2.0f / ( top - bottom );
+        result( 2, 2 ) = -2.0f / ( farPlane - nearPlane );
+        result( 0, 3 ) = -( right + left ) / ( right - left );
+        result( 1, 3 ) = -( top + bottom ) / ( top - bottom );
+        result( 2, 3 ) = -( farPlane + nearPlane ) / ( farPlane - nearPlane );
+
+        return result;
+    }
+
+    Mat4 lookAt(
+        Vec3 eye,
+        Vec3 target,
+        Vec3 up
+    )
+    {
+        Vec3 const forward{ normalize( target - eye ) };
+        Vec3 const side{ normalize( cross( forward, up ) ) };
+        Vec3 const cameraUp{ cross( side, forward ) };
+
+        Mat4 result;
+        result( 0, 0 ) = side.x;
+        result( 0, 1 ) = side.y;
+        result( 0, 2 ) = side.z;
+        result( 1, 0 ) = cameraUp.x;
+        result( 1, 1 ) = cameraUp.y;
+        result( 1, 2 ) = cameraUp.z;
+        result( 2, 0 ) = -forward.x;
+        result( 2, 1 ) = -forward.y;
+        result( 2, 2 ) = -forward.z;
+        result( 0, 3 ) = -dot( side, eye );
+        result( 1, 3 ) = -dot( cameraUp, eye );
+        result( 2, 3 ) = dot( forward, eye );
+
+        return result;
+    }
+
+    Mat4 inverseRigid( Mat4 const& m )
+    {
+        //* Transposed rotation, translation rotated back
+        Mat4 result;
+
+        for ( int row{ 0 }; row < 3; ++row )
+        {
+            for ( int column{ 0 }; column < 3; ++column )
+            {
+                result( row, column ) = m( column, row );
+            }
+
+            result( row, 3 ) = -( m( 0, row ) * m( 0, 3 ) + m( 1, row ) * m( 1, 3 ) + m( 2, row ) * m( 2, 3 ) );
+        }
+
+        return result;
+    }
+
+    SimdLevel bestSimdLevel()
+    {
+        if (
+            isAvx2Built()
+            && CpuFeatures::hasAvx2Fma()
+        )
+        {
+            return SimdLevel::AVX2;
+        }
+
+#if defined( MATH_SSE )
+        return SimdLevel::SSE;
+#elif defined( MATH_NEON )
+        return SimdLevel::NEON;
+#else
+        return SimdLevel::SCALAR;
+#endif
+    }
+
+    void multiplyMatrices(
+        Mat4 const& left,
+        Mat4 const* right,
+        Mat4* out,
+        int count,
+        SimdLevel level
+    )
+    {
+        multiplyBatch( &left, 0, right, out, count, level );
+    }
+
+    void multiplyMatrices(
+        Mat4 const* left,
+        Mat4 const* right,
+        Mat4* out,
+        int count,
+        SimdLevel level
+    )
+    {
+        multiplyBatch( left, 1, right, out, count, level );
+    }
+
+    void composeMatrices(
+        Transform const* transforms,
+        Mat4* out,
+        int count
+    )
+    {
+        //* Mostly independent scalar products, the compiler vectorizes what is worth it
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            out[i] = compose( transforms[i] );
+        }
+    }
+
+    int multiplyMatricesSimd4(
+        [[maybe_unused]] Mat4 const* left,
+        [[maybe_unused]] int leftStride,
+        [[maybe_unused]] Mat4 const* right,
+        [[maybe_unused]] Mat4* out,
+        [[maybe_unused]] int count
+    )
+    {
+#if defined( MATH_SSE )
+        //* out column j = sum over k of left column k * right( k, j ), one column per register
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            float const* a{ left[i * leftStride].values };
+            float const* b{ right[i].values };
+
+            __m128 const a0{ _mm_load_ps( a ) };
+            __m128 const a1{ _mm_load_ps( a + 4 ) };
+            __m128 const a2{ _mm_load_ps( a + 8 ) };
+            __m128 const a3{ _mm_load_ps( a + 12 ) };
+
+            //* No FMA in SSE2, same rounding as the scalar reference
+            auto column = [&]( __m128 bj )
+            {
+                __m128 sum{ _mm_mul_ps( a0, _mm_shuffle_ps( bj, bj, _MM_SHUFFLE( 0, 0, 0, 0 ) ) ) };
+                sum = _mm_add_ps( sum, _mm_mul_ps( a1, _mm_shuffle_ps( bj, bj, _MM_SHUFFLE( 1, 1, 1, 1 ) ) ) );
+                sum = _mm_add_ps( sum, _mm_mul_ps( a2, _mm_shuffle_ps( bj, bj, _MM_SHUFFLE( 2, 2, 2, 2 ) ) ) );
+
+                return _mm_add_ps( sum, _mm_mul_ps( a3, _mm_shuffle_ps( bj, bj, _MM_SHUFFLE( 3, 3, 3, 3 ) ) ) );
+            };
+
+            __m128 const c0{ column( _mm_load_ps( b ) ) };
+            __m128 const c1{ column( _mm_load_ps( b + 4 ) ) };
+            __m128 const c2{ column( _mm_load_ps( b + 8 ) ) };
+            __m128 const c3{ column( _mm_load_ps( b + 12 ) ) };
+
+            //* Stored last, `out` may alias the inputs
+            _mm_store_ps( out[i].values, c0 );
+            _mm_store_ps( out[i].values + 4, c1 );
+            _mm_store_ps( out[i].values + 8, c2 );
+            _mm_store_ps( out[i].values + 12, c3 );
+        }
+
+        return count;
+#elif defined( MATH_NEON )
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            float const* a{ left[i * leftStride].values };
+            float const* b{ right[i].values };
+
+            float32x4_t const a0{ vld1q_f32( a ) };
+            float32x4_t const a1{ vld1q_f32( a + 4 ) };
+            float32x4_t const a2{ vld1q_f32( a + 8 ) };
+            float32x4_t const a3{ vld1q_f32( a + 12 ) };
+
+            auto column = [&]( float32x4_t bj )
+            {
+                float32x4_t sum{ vmulq_laneq_f32( a0, bj, 0 ) };
+                sum = vfmaq_laneq_f32( sum, a1, bj, 1 );
+                sum = vfmaq_laneq_f32( sum, a2, bj, 2 );
+
+                return vfmaq_laneq_f32( sum, a3, bj, 3 );
+            };
+
+            float32x4_t const c0{ column( vld1q_f32( b ) ) };
+            float32x4_t const c1{ column( vld1q_f32( b + 4 ) ) };
+            float32x4_t const c2{ column( vld1q_f32( b + 8 ) ) };
+            float32x4_t const c3{ column( vld1q_f32( b + 12 ) ) };
+
+            vst1q_f32( out[i].values, c0 );
+            vst1q_f32( out[i].values + 4, c1 );
+            vst1q_f32( out[i].values + 8, c2 );
+            vst1q_f32( out[i].values + 12, c3 );
+        }
+
+        return count;
+#else
+        return 0;
+#endif
+    }
+}
@@ -0,0 +1,223 @@
+#ifndef IG20261019111700
+#define IG20261019111700
+
+#include "CpuFeatures.h"
+
+//* Vector, quaternion and matrix math for the camera/transform pipeline
+//* - conventions as GLSL: column vectors, column major matrices, right handed,
+//*   clip space z in [-1, 1]; a Mat4 can be uploaded as is (std140/std430 `mat4`)
+//* - single values are plain inline code, batches of matrices go through the SIMD kernels
+//*   (`multiplyMatrices()`), picked at runtime like the software vertex shaders
+
+struct Vec3
+{
+    float x{};
+    float y{};
+    float z{};
+};
+
+struct alignas( 16 ) Vec4
+{
+    float x{};
+    float y{};
+    float z{};
+    float w{};
+};
+
+//* Unit quaternion for rotations, (x, y, z) vector part, w scalar part
+struct alignas( 16 ) Quat
+{
+    float x{};
+    float y{};
+    float z{};
+    float w{ 1.0f };
+};
+
+//* Column major, `values[4 * column + row]`, identity by default
+struct alignas( 16 ) Mat4
+{
+    // clang-format off
+    float values[16]{
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    // clang-format on
+
+    float& operator()(
+        int row,
+        int column
+    )
+    {
+        return values[4 * column + row];
+    }
+
+    float operator()(
+        int row,
+        int column
+    ) const
+    {
+        return values[4 * column + row];
+    }
+};
+
+static_assert( sizeof( Mat4 ) == 64, "Mat4 has to match a GLSL mat4" );
+
+//* Scale, then rotate, then translate
+struct Transform
+{
+    Vec3 position{};
+    Quat rotation{};
+    Vec3 scale{ 1.0f, 1.0f, 1.0f };
+};
+
+inline Vec3 operator+( Vec3 a, Vec3 b ) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+inline Vec3 operator-( Vec3 a, Vec3 b ) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+inline Vec3 operator*( Vec3 a, float b ) { return { a.x * b, a.y * b, a.z * b }; }
+
+//* Rotation `b` followed by `a`
+Quat operator*(
+    Quat a,
+    Quat b
+);
+
+Mat4 operator*(
+    Mat4 const& a,
+    Mat4 const& b
+);
+
+Vec4 operator*(
+    Mat4 const& m,
+    Vec4 v
+);
+
+namespace Math
+{
+    inline float dot(
+        Vec3 a,
+        Vec3 b
+    )
+    {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    inline Vec3 cross(
+        Vec3 a,
+        Vec3 b
+    )
+    {
+        return {
+            a.y * b.z - a.z * b.y,
+            a.z * b.x - a.x * b.z,
+            a.x * b.y - a.y * b.x
+        };
+    }
+
+    float length( Vec3 v );
+
+    //* Zero stays zero
+    Vec3 normalize( Vec3 v );
+    Quat normalize( Quat q );
+
+    //* Angle in radians, counterclockwise looking down the axis
+    Quat fromAxisAngle(
+        Vec3 axis,
+        float angle
+    );
+
+    Quat conjugate( Quat q );
+
+    //* Rotation part of a matrix without scale
+    Quat fromRotation( Mat4 const& m );
+
+    Vec3 rotate(
+        Quat q,
+        Vec3 v
+    );
+
+    Mat4 translation( Vec3 offset );
+    Mat4 scaling( Vec3 factors );
+    Mat4 rotation( Quat q );
+
+    //* translation * rotation * scaling, without the full products
+    Mat4 compose( Transform const& transform );
+
+    //* Vertical field of view in radians, OpenGL clip space
+    Mat4 perspective(
+        float fovY,
+        float aspect,
+        float nearPlane,
+        float farPlane
+    );
+
+    Mat4 orthographic(
+        float left,
+        float right,
+        float bottom,
+        float top,
+        float nearPlane,
+        float farPlane
+    );
+
+    //* View matrix looking from `eye` at `target`
+    Mat4 lookAt(
+        Vec3 eye,
+        Vec3 target,
+        Vec3 up
+    );
+
+    //* Inverse of a rotation + translation matrix (eg. a camera's world transform)
+    Mat4 inverseRigid( Mat4 const& m );
+
+    //* Widest level supported by this CPU (and build)
+    SimdLevel bestSimdLevel();
+
+    //* MathAvx2.cpp is compiled with -mavx2 -mfma (x86 only)
+    bool isAvx2Built();
+
+    //* out[i] = left * right[i] (eg. view projection * model), `out` may alias `right`
+    void multiplyMatrices(
+        Mat4 const& left,
+        Mat4 const* right,
+        Mat4* out,
+        int count,
+        SimdLevel level
+    );
+
+    //* out[i] = left[i] * right[i], `out` may alias either
+    void multiplyMatrices(
+        Mat4 const* left,
+        Mat4 const* right,
+        Mat4* out,
+        int count,
+        SimdLevel level
+    );
+
+    //* out[i] = compose( transforms[i] )
+    void composeMatrices(
+        Transform const* transforms,
+        Mat4* out,
+        int count
+    );
+
+    //* Kernels per SIMD level, each processes whole matrices and returns the number done
+    //* (0 when the level is not built)
+    int multiplyMatricesSimd4(
+        Mat4 const* left,
+        int leftStride,
+        Mat4 const* right,
+        Mat4* out,
+        int count
+    );
+
+    int multiplyMatricesAvx2(
+        Mat4 const* left,
+        int leftStride,
+        Mat4 const* right,
+        Mat4* out,
+        int count
+    );
+}
+
+#endif
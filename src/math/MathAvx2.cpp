@@ -0,0 +1,63 @@
+//* Compiled with -mavx2 -mfma (see Makefile), only call into it after checking `CpuFeatures::hasAvx2Fma()`
+#include "Math.h"
+
+#if defined( __AVX2__ ) && defined( __FMA__ )
+#include <immintrin.h>
+#define MATH_AVX2
+#endif
+
+namespace Math
+{
+    int multiplyMatricesAvx2(
+        [[maybe_unused]] Mat4 const* left,
+        [[maybe_unused]] int leftStride,
+        [[maybe_unused]] Mat4 const* right,
+        [[maybe_unused]] Mat4* out,
+        [[maybe_unused]] int count
+    )
+    {
+#if defined( MATH_AVX2 )
+        //* Two output columns per register: left column k in both halves,
+        //* right( k, j ) and right( k, j + 1 ) splatted into the low and high half
+        for ( int i{ 0 }; i < count; ++i )
+        {
+            float const* a{ left[i * leftStride].values };
+            float const* b{ right[i].values };
+
+            __m256 const a0{ _mm256_broadcast_ps( reinterpret_cast<__m128 const*>( a ) ) };
+            __m256 const a1{ _mm256_broadcast_ps( reinterpret_cast<__m128 const*>( a + 4 ) ) };
+            __m256 const a2{ _mm256_broadcast_ps( reinterpret_cast<__m128 const*>( a + 8 ) ) };
+            __m256 const a3{ _mm256_broadcast_ps( reinterpret_cast<__m128 const*>( a + 12 ) ) };
+
+            __m256 const b01{ _mm256_loadu_ps( b ) };
+            __m256 const b23{ _mm256_loadu_ps( b + 8 ) };
+
+            __m256 c01{ _mm256_mul_ps( a0, _mm256_shuffle_ps( b01, b01, _MM_SHUFFLE( 0, 0, 0, 0 ) ) ) };
+            __m256 c23{ _mm256_mul_ps( a0, _mm256_shuffle_ps( b23, b23, _MM_SHUFFLE( 0, 0, 0, 0 ) ) ) };
+            c01 = _mm256_fmadd_ps( a1, _mm256_shuffle_ps( b01, b01, _MM_SHUFFLE( 1, 1, 1, 1 ) ), c01 );
+            c23 = _mm256_fmadd_ps( a1, _mm256_shuffle_ps( b23, b23, _MM_SHUFFLE( 1, 1, 1, 1 ) ), c23 );
+            c01 = _mm256_fmadd_ps( a2, _mm256_shuffle_ps( b01, b01, _MM_SHUFFLE( 2, 2, 2, 2 ) ), c01 );
+            c23 = _mm256_fmadd_ps( a2, _mm256_shuffle_ps( b23, b23, _MM_SHUFFLE( 2, 2, 2, 2 ) ), c23 );
+            c01 = _mm256_fmadd_ps( a3, _mm256_shuffle_ps( b01, b01, _MM_SHUFFLE( 3, 3, 3, 3 ) ), c01 );
+            c23 = _mm256_fmadd_ps( a3, _mm256_shuffle_ps( b23, b23, _MM_SHUFFLE( 3, 3, 3, 3 ) ), c23 );
+
+            //* Stored last, `out` may alias the inputs
+            _mm256_storeu_ps( out[i].values, c01 );
+            _mm256_storeu_ps( out[i].values + 8, c23 );
+        }
+
+        return count;
+#else
+        return 0;
+#endif
+    }
+
+    bool isAvx2Built()
+    {
+#if defined( MATH_AVX2 )
+        return true;
+#else
+        return false;
+#endif
+    }
+}
@@ -0,0 +1,58 @@
+#include "Camera.h"
+
+#include "CpuFeatures.h"
+#include "Math.h"
+#include <cmath>
+
+void Camera::lookAt(
+    Vec3 target,
+    Vec3 up
+)
+{
+    //* The view matrix's rotation is the inverse (transpose) of the camera's
+    Mat4 const view{ Math::lookAt( position, target, up ) };
+    Mat4 const world{ Math::inverseRigid( view ) };
+
+    orientation = Math::normalize( Math::fromRotation( world ) );
+}
+
+void Camera::orbit(
+    Vec3 target,
+    float distance,
+    float height,
+    float angle
+)
+{
+    position = {
+        target.x + distance * std::sin( angle ),
+        target.y + height,
+        target.z + distance * std::cos( angle )
+    };
+
+    lookAt( target );
+}
+
+Mat4 Camera::view() const
+{
+    return Math::inverseRigid( Math::compose( { position, orientation, { 1.0f, 1.0f, 1.0f } } ) );
+}
+
+Mat4 Camera::projection() const
+{
+    return Math::perspective( fovY, aspect, nearPlane, farPlane );
+}
+
+Mat4 Camera::viewProjection() const
+{
+    return projection() * view();
+}
+
+void Camera::modelViewProjections(
+    Mat4 const* models,
+    Mat4* out,
+    int count,
+    SimdLevel level
+) const
+{
+    Math::multiplyMatrices( viewProjection(), models, out, count, level );
+}
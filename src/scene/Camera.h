@@ -0,0 +1,47 @@
+#ifndef IG20261019111800
+#define IG20261019111800
+
+#include "CpuFeatures.h"
+#include "Math.h"
+
+//* Perspective camera, looking down its local -z (OpenGL convention)
+//* Per frame: model matrices from `Math::composeMatrices()`, then `modelViewProjections()` over the batch.
+struct Camera
+{
+    Vec3 position{ 0.0f, 0.0f, 3.0f };
+    Quat orientation{};
+
+    //* Vertical, in radians
+    float fovY{ 1.0f };
+    float aspect{ 1.0f };
+    float nearPlane{ 0.1f };
+    float farPlane{ 100.0f };
+
+    //* Turn towards `target`, `up` must not be parallel to the view direction
+    void lookAt(
+        Vec3 target,
+        Vec3 up = { 0.0f, 1.0f, 0.0f }
+    );
+
+    //* Circle `target` in the xz-plane at `distance`, `angle` in radians
+    void orbit(
+        Vec3 target,
+        float distance,
+        float height,
+        float angle
+    );
+
+    Mat4 view() const;
+    Mat4 projection() const;
+    Mat4 viewProjection() const;
+
+    //* out[i] = viewProjection * models[i], `out` may alias `models`
+    void modelViewProjections(
+        Mat4 const* models,
+        Mat4* out,
+        int count,
+        SimdLevel level = Math::bestSimdLevel()
+    ) const;
+};
+
+#endif
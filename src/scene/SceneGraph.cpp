@@ -0,0 +1,290 @@
+#include "SceneGraph.h"
+
+#include "CpuFeatures.h"
+#include "JobSystem.h"
+#include "Math.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    //* Reorder `values` so that the element at i moves to newIndices[i]
+    template <typename T>
+    void permute(
+        std::vector<T>& values,
+        std::vector<int> const& newIndices
+    )
+    {
+        std::vector<T> sorted( values.size() );
+
+        for ( size_t i{ 0 }; i < values.size(); ++i )
+        {
+            sorted[newIndices[i]] = values[i];
+        }
+
+        values.swap( sorted );
+    }
+}
+
+int SceneGraph::addNode(
+    int parent,
+    Transform const& local
+)
+{
+    //* Appended at the end, so position and id are the same until the next `rebuild()`
+    int const id{ nodeCount() };
+    int const parentIndex{ ( parent == NO_PARENT ) ? NO_PARENT : indices_[parent] };
+
+    parents_.push_back( parentIndex );
+    depths_.push_back( ( parentIndex == NO_PARENT ) ? 0 : depths_[parentIndex] + 1 );
+    positions_.push_back( local.position );
+    rotations_.push_back( local.rotation );
+    scales_.push_back( local.scale );
+    worlds_.emplace_back();
+    dirty_.push_back( 0 );
+
+    indices_.push_back( id );
+    ids_.push_back( id );
+
+    markDirty( id );
+
+    return id;
+}
+
+void SceneGraph::reserve( int nodeCount )
+{
+    size_t const capacity{ static_cast<size_t>( nodeCount ) };
+
+    parents_.reserve( capacity );
+    depths_.reserve( capacity );
+    positions_.reserve( capacity );
+    rotations_.reserve( capacity );
+    scales_.reserve( capacity );
+    worlds_.reserve( capacity );
+    dirty_.reserve( capacity );
+    indices_.reserve( capacity );
+    ids_.reserve( capacity );
+}
+
+void SceneGraph::setLocal(
+    int node,
+    Transform const& local
+)
+{
+    int const index{ indices_[node] };
+
+    positions_[index] = local.position;
+    rotations_[index] = local.rotation;
+    scales_[index] = local.scale;
+
+    markDirty( index );
+}
+
+void SceneGraph::setPosition(
+    int node,
+    Vec3 position
+)
+{
+    int const index{ indices_[node] };
+
+    positions_[index] = position;
+
+    markDirty( index );
+}
+
+void SceneGraph::setRotation(
+    int node,
+    Quat rotation
+)
+{
+    int const index{ indices_[node] };
+
+    rotations_[index] = rotation;
+
+    markDirty( index );
+}
+
+Transform SceneGraph::local( int node ) const
+{
+    int const index{ indices_[node] };
+
+    return { positions_[index], rotations_[index], scales_[index] };
+}
+
+void SceneGraph::update(
+    JobSystem* jobs,
+    SimdLevel level
+)
+{
+    PROFILE_ZONE( "scene graph" );
+
+    if ( sortedCount_ != nodeCount() )
+    {
+        rebuild();
+    }
+
+    updatedCount_ = 0;
+
+    if ( minDirtyDepth_ == INT32_MAX )
+    {
+        return;
+    }
+
+    std::atomic<int> updatedCount{ 0 };
+
+    //* Levels in order, a level only reads its parents' (finished) level
+    for ( int depth{ minDirtyDepth_ }; depth < depthCount(); ++depth )
+    {
+        int const begin{ levelStarts_[depth] };
+        int const end{ levelStarts_[depth + 1] };
+
+        if (
+            !jobs
+            || end - begin < 2 * GRAIN_SIZE
+        )
+        {
+            updatedCount.fetch_add( updateRange( begin, end, level ), std::memory_order_relaxed );
+            continue;
+        }
+
+        jobs->parallelFor(
+            end - begin,
+            GRAIN_SIZE,
+            [this, begin, level, &updatedCount]( int first, int last )
+            {
+                updatedCount.fetch_add( updateRange( begin + first, begin + last, level ), std::memory_order_relaxed );
+            }
+        );
+    }
+
+    //* Nothing above the shallowest dirty level was set
+    std::fill(
+        dirty_.begin() + levelStarts_[minDirtyDepth_],
+        dirty_.end(),
+        uint8_t{ 0 }
+    );
+
+    minDirtyDepth_ = INT32_MAX;
+    updatedCount_ = updatedCount.load( std::memory_order_relaxed );
+}
+
+void SceneGraph::rebuild()
+{
+    int const count{ nodeCount() };
+    int const levelCount{ count ? *std::max_element( depths_.begin(), depths_.end() ) + 1 : 0 };
+
+    //* Counting sort by depth
+    levelStarts_.assign( levelCount + 1, 0 );
+
+    for ( int depth : depths_ )
+    {
+        ++levelStarts_[depth + 1];
+    }
+
+    for ( int depth{ 0 }; depth < levelCount; ++depth )
+    {
+        levelStarts_[depth + 1] += levelStarts_[depth];
+    }
+
+    std::vector<int> newIndices( count );
+    std::vector<int> nextIndex( levelStarts_.begin(), levelStarts_.end() - 1 );
+
+    for ( int i{ 0 }; i < count; ++i )
+    {
+        newIndices[i] = nextIndex[depths_[i]]++;
+    }
+
+    for ( int& parent : parents_ )
+    {
+        parent = ( parent == NO_PARENT ) ? NO_PARENT : newIndices[parent];
+    }
+
+    permute( parents_, newIndices );
+    permute( depths_, newIndices );
+    permute( positions_, newIndices );
+    permute( rotations_, newIndices );
+    permute( scales_, newIndices );
+    permute( worlds_, newIndices );
+    permute( dirty_, newIndices );
+    permute( ids_, newIndices );
+
+    for ( int i{ 0 }; i < count; ++i )
+    {
+        indices_[ids_[i]] = i;
+    }
+
+    sortedCount_ = count;
+}
+
+void SceneGraph::markDirty( int index )
+{
+    dirty_[index] = 1;
+    minDirtyDepth_ = std::min( minDirtyDepth_, depths_[index] );
+}
+
+int SceneGraph::updateRange(
+    int begin,
+    int end,
+    SimdLevel level
+)
+{
+    //* Parent worlds gathered next to the locals, so one kernel call does a whole batch
+    Mat4 parentWorlds[BATCH_SIZE];
+    Mat4 locals[BATCH_SIZE];
+    int targets[BATCH_SIZE];
+    int batchCount{ 0 };
+    int updatedCount{ 0 };
+
+    auto flush = [&]()
+    {
+        Math::multiplyMatrices( parentWorlds, locals, locals, batchCount, level );
+
+        for ( int i{ 0 }; i < batchCount; ++i )
+        {
+            worlds_[targets[i]] = locals[i];
+        }
+
+        batchCount = 0;
+    };
+
+    for ( int i{ begin }; i < end; ++i )
+    {
+        int const parent{ parents_[i] };
+
+        //* Static subtrees are skipped, a recomputed parent makes its children dirty
+        if (
+            !dirty_[i]
+            && ( parent == NO_PARENT || !dirty_[parent] )
+        )
+        {
+            continue;
+        }
+
+        dirty_[i] = 1;
+        ++updatedCount;
+
+        Transform const local{ positions_[i], rotations_[i], scales_[i] };
+
+        if ( parent == NO_PARENT )
+        {
+            worlds_[i] = Math::compose( local );
+            continue;
+        }
+
+        parentWorlds[batchCount] = worlds_[parent];
+        locals[batchCount] = Math::compose( local );
+        targets[batchCount] = i;
+
+        if ( ++batchCount == BATCH_SIZE )
+        {
+            flush();
+        }
+    }
+
+    flush();
+
+    return updatedCount;
+}
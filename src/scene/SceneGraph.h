@@ -0,0 +1,116 @@
+#ifndef IG20261019111900
+#define IG20261019111900
+
+#include "CpuFeatures.h"
+#include "Math.h"
+#include <cstdint>
+#include <vector>
+
+class JobSystem;
+
+//* Transform hierarchy, node data in SoA arrays sorted by depth
+//* - every level is a contiguous range and every parent comes before its children,
+//*   so `update()` is one linear sweep per level; a level's nodes are independent
+//*   and split over the job system's workers
+//* - setting a local transform marks the node dirty, `update()` recomputes dirty nodes and their
+//*   subtrees only; levels above the shallowest dirty node are not touched at all
+//* - nodes are named by stable ids; adding nodes only appends, the depth order is rebuilt
+//*   (allocating) by the next `update()`, which is otherwise allocation free
+//* World matrices are valid after `update()`.
+class SceneGraph
+{
+public:
+    static int const NO_PARENT{ -1 };
+
+    //* Nodes per job, levels smaller than two grains run on the calling thread
+    static int const GRAIN_SIZE{ 2048 };
+
+    //* Nodes multiplied per kernel call (parents gathered into a contiguous batch)
+    static int const BATCH_SIZE{ 64 };
+
+    //* `parent` has to exist already, returns the new node's id
+    int addNode(
+        int parent,
+        Transform const& local
+    );
+
+    void reserve( int nodeCount );
+
+    int nodeCount() const { return static_cast<int>( parents_.size() ); }
+
+    int depthCount() const { return static_cast<int>( levelStarts_.size() ) - 1; }
+
+    void setLocal(
+        int node,
+        Transform const& local
+    );
+
+    void setPosition(
+        int node,
+        Vec3 position
+    );
+
+    void setRotation(
+        int node,
+        Quat rotation
+    );
+
+    Transform local( int node ) const;
+
+    Mat4 const& world( int node ) const { return worlds_[indices_[node]]; }
+
+    //* World matrices in depth order (eg. to upload as instance data), see `nodeAt()`
+    Mat4 const* worldMatrices() const { return worlds_.data(); }
+
+    //* Id of the node at a position in depth order
+    int nodeAt( int index ) const { return ids_[index]; }
+
+    //* Propagate local to world, `jobs` may be null (single threaded)
+    void update(
+        JobSystem* jobs = nullptr,
+        SimdLevel level = Math::bestSimdLevel()
+    );
+
+    //* Nodes recomputed by the last `update()`
+    int updatedCount() const { return updatedCount_; }
+
+private:
+    //* Sort by depth (stable, so siblings keep their order), remap parents and ids
+    void rebuild();
+
+    void markDirty( int index );
+
+    //* Nodes [begin, end) of one level, returns the number recomputed
+    int updateRange(
+        int begin,
+        int end,
+        SimdLevel level
+    );
+
+    //* SoA, indexed by position in depth order
+    std::vector<int> parents_{};
+    std::vector<int> depths_{};
+    std::vector<Vec3> positions_{};
+    std::vector<Quat> rotations_{};
+    std::vector<Vec3> scales_{};
+    std::vector<Mat4> worlds_{};
+    //* Set by the setters, and during `update()` for every recomputed node (children read it)
+    std::vector<uint8_t> dirty_{};
+
+    //* Stable id <-> position in depth order
+    std::vector<int> indices_{};
+    std::vector<int> ids_{};
+
+    //* First position of every depth, plus the end
+    std::vector<int> levelStarts_{ 0 };
+
+    //* Nodes before this position are sorted
+    int sortedCount_{};
+
+    //* Shallowest depth with a dirty node, `INT32_MAX` if none
+    int minDirtyDepth_{ INT32_MAX };
+
+    int updatedCount_{};
+};
+
+#endif
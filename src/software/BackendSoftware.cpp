@@ -0,0 +1,335 @@
+#include "BackendSoftware.h"
+
+#include "Backend.h"
+#include "CommandBuffer.h"
+#include "Profiler.h"
+#include "Rasterizer.h"
+#include "RgbaImage.h"
+#include "VertexShader.h"
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+//* `gl_PointSize` in example.vert
+float const POINT_SIZE{ 10.0f };
+
+BackendSoftware::BackendSoftware( int threadCount )
+    : threadCount_( threadCount )
+{
+}
+
+bool BackendSoftware::initImpl(
+    int width,
+    int height,
+    char const* title
+)
+{
+    width_ = width;
+    height_ = height;
+    title_ = title;
+    simdLevel_ = bestSimdLevel();
+
+    rasterizer_.init(
+        width,
+        height,
+        threadCount_ ? threadCount_ : static_cast<int>( std::thread::hardware_concurrency() )
+    );
+
+    return true;
+}
+
+void BackendSoftware::deinitImpl()
+{
+    RasterStats const& stats{ rasterizer_.stats() };
+    double const flushes( stats.flushes ? stats.flushes : 1 );
+
+    std::cout << "[INFO] " << title_ << " (" << rasterizer_.threadCount() << " threads, "
+              << ( rasterizer_.usesAvx2() ? "AVX2" : "scalar" ) << " raster, "
+              << simdLevelName( simdLevel_ ) << " vertex) ms per flush:"
+              << " setup " << stats.setupMs / flushes
+              << ", binning " << stats.binningMs / flushes
+              << ", raster " << stats.rasterMs / flushes
+              << ", resolve " << stats.resolveMs / flushes << "\n";
+
+    rasterizer_.deinit();
+}
+
+//* No window to close, use `--frames`
+bool BackendSoftware::shouldCloseImpl()
+{
+    return false;
+}
+
+//* Nothing is presented
+void BackendSoftware::setVsyncImpl( [[maybe_unused]] VsyncMode mode ) {}
+
+//* No context, the backend may run on any (single) thread
+bool BackendSoftware::supportsRenderThreadImpl()
+{
+    return true;
+}
+
+void BackendSoftware::setContextCurrentImpl( [[maybe_unused]] bool isCurrent ) {}
+
+void BackendSoftware::setFramesInFlightImpl( [[maybe_unused]] int count ) {}
+
+int BackendSoftware::refreshRateImpl()
+{
+    return 0;
+}
+
+//* No input without a window
+void BackendSoftware::pollInputImpl() {}
+
+void BackendSoftware::beginFrameImpl()
+{
+    //* Opaque black, RGBA8
+    rasterizer_.clear( 0xff000000u );
+}
+
+void BackendSoftware::endFrameImpl()
+{
+    rasterizer_.flush();
+}
+
+unsigned int BackendSoftware::loadShaderProgramImpl(
+    [[maybe_unused]] char const* vertexShaderPath,
+    [[maybe_unused]] char const* fragmentShaderPath
+)
+{
+    return 1;
+}
+
+void BackendSoftware::unloadShaderProgramImpl( [[maybe_unused]] unsigned int program ) {}
+
+void BackendSoftware::enableShaderProgramImpl( [[maybe_unused]] unsigned int program ) {}
+
+unsigned int BackendSoftware::loadVertexArrayImpl()
+{
+    vertexArrays_.emplace_back();
+
+    return static_cast<unsigned int>( vertexArrays_.size() );
+}
+
+void BackendSoftware::unloadVertexArrayImpl( unsigned int vao )
+{
+    vertexArrays_[vao - 1] = {};
+}
+
+void BackendSoftware::enableVertexArrayImpl( unsigned int vao )
+{
+    boundVertexArray_ = vao;
+}
+
+void BackendSoftware::disableVertexArrayImpl()
+{
+    boundVertexArray_ = 0;
+}
+
+unsigned int BackendSoftware::loadVertexBufferImpl(
+    void const* data,
+    int size,
+    [[maybe_unused]] bool dynamic
+)
+{
+    unsigned char const* bytes{ static_cast<unsigned char const*>( data ) };
+
+    buffers_.emplace_back( bytes, bytes + size );
+
+    //* Like glBindBuffer( GL_ARRAY_BUFFER, vbo )
+    boundBuffer_ = static_cast<unsigned int>( buffers_.size() );
+
+    return boundBuffer_;
+}
+
+//* Nothing to overlap with, copies right away
+void BackendSoftware::loadVertexBufferAsyncImpl(
+    BufferHandle handle,
+    void const* data,
+    int size
+)
+{
+    completeUpload( handle, loadVertexBufferImpl( data, size, false ) );
+}
+
+void BackendSoftware::unloadVertexBufferImpl( unsigned int vbo )
+{
+    buffers_[vbo - 1] = {};
+}
+
+void BackendSoftware::updateVertexBufferImpl(
+    unsigned int vbo,
+    void const* data,
+    int size,
+    int offset
+)
+{
+    std::memcpy( buffers_[vbo - 1].data() + offset, data, size );
+}
+
+void BackendSoftware::setVertexAttributeImpl( VertexAttribute const& attribute )
+{
+    VertexArray& vertexArray{ vertexArrays_[boundVertexArray_ - 1] };
+
+    vertexArray.attributes[attribute.index] = attribute;
+    vertexArray.buffers[attribute.index] = boundBuffer_;
+}
+
+void BackendSoftware::processVertices(
+    int first,
+    int count
+)
+{
+    PROFILE_ZONE( "vertex processing" );
+
+    VertexArray const& vertexArray{ vertexArrays_[boundVertexArray_ - 1] };
+
+    vertexInputs_.resize( ExampleVertexShader::INPUT_COUNT, count );
+    vertexOutputs_.resize( ExampleVertexShader::OUTPUT_COUNT, count );
+
+    VertexStreams const inputs{ vertexInputs_.streams() };
+    VertexStreams const outputs{ vertexOutputs_.streams() };
+
+    //* Fetch "layout (location = 0) in vec2 position" and "layout (location = 1) in vec3 color"
+    //* into streams 0-1 and 2-4
+    int stream{ 0 };
+
+    for ( unsigned int location{ 0 }; location < 2; ++location )
+    {
+        VertexAttribute const& attribute{ vertexArray.attributes[location] };
+        unsigned char const* source{ buffers_[vertexArray.buffers[location] - 1].data() + attribute.offset };
+
+        for ( int component{ 0 }; component < attribute.componentCount; ++component, ++stream )
+        {
+            for ( int i{ 0 }; i < count; ++i )
+            {
+                std::memcpy(
+                    &inputs.streams[stream][i],
+                    source + static_cast<size_t>( first + i ) * attribute.stride + component * sizeof( float ),
+                    sizeof( float )
+                );
+            }
+        }
+    }
+
+    runVertexShader(
+        vertexShader_,
+        inputs,
+        outputs,
+        0,
+        count,
+        simdLevel_
+    );
+
+    //* Viewport transform of gl_Position (w is 1, no perspective divide needed)
+    processedVertices_.resize( count );
+
+    for ( int i{ 0 }; i < count; ++i )
+    {
+        processedVertices_[i] = {
+            ( outputs.streams[0][i] * 0.5f + 0.5f ) * width_,
+            ( outputs.streams[1][i] * 0.5f + 0.5f ) * height_,
+            outputs.streams[4][i],
+            outputs.streams[5][i],
+            outputs.streams[6][i]
+        };
+    }
+}
+
+void BackendSoftware::drawImpl(
+    Primitive primitive,
+    int first,
+    int count
+)
+{
+    processVertices( first, count );
+
+    if ( primitive == Primitive::POINTS )
+    {
+        for ( RasterVertex const& vertex : processedVertices_ )
+        {
+            rasterizer_.submitPoint( vertex, POINT_SIZE );
+        }
+
+        return;
+    }
+
+    for ( int i{ 0 }; i + 2 < count; i += 3 )
+    {
+        rasterizer_.submitTriangle(
+            processedVertices_[i],
+            processedVertices_[i + 1],
+            processedVertices_[i + 2]
+        );
+    }
+}
+
+void BackendSoftware::executeCommandsImpl( CommandBuffer const& commands )
+{
+    //* The fixed pipeline has no uniforms (nor uniform buffers)
+    struct Visitor
+    {
+        BackendSoftware& backend;
+
+        void bindProgram( unsigned int program ) { backend.enableShaderProgramImpl( program ); }
+        void bindVertexArray( unsigned int vao ) { backend.enableVertexArrayImpl( vao ); }
+
+        void setUniform(
+            [[maybe_unused]] int location,
+            [[maybe_unused]] UniformType type,
+            [[maybe_unused]] float const* values
+        )
+        {
+        }
+
+        void bindUniformRange(
+            [[maybe_unused]] unsigned int binding,
+            [[maybe_unused]] unsigned int buffer,
+            [[maybe_unused]] uint32_t offset,
+            [[maybe_unused]] uint32_t size
+        )
+        {
+        }
+
+        void draw(
+            Primitive primitive,
+            int first,
+            int count
+        )
+        {
+            backend.drawImpl( primitive, first, count );
+        }
+    };
+
+    Visitor visitor{ *this };
+    commands.replay( visitor );
+}
+
+void BackendSoftware::readPixelsImpl( RgbaImage& image )
+{
+    //* The flush in `endFrame()` then has nothing left to do
+    rasterizer_.flush();
+
+    std::vector<uint32_t> const& colorBuffer{ rasterizer_.colorBuffer() };
+
+    image.width = width_;
+    image.height = height_;
+    image.pixels.resize( colorBuffer.size() * 4 );
+
+    //* Packed as RGBA bytes in memory order
+    std::memcpy( image.pixels.data(), colorBuffer.data(), image.pixels.size() );
+}
+
+void BackendSoftware::drawOverlayTextImpl( char const* text )
+{
+    if ( overlayText_ == text )
+    {
+        return;
+    }
+
+    overlayText_ = text;
+
+    std::cout << "[INFO] " << title_ << ":\n"
+              << overlayText_;
+}
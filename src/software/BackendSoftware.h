@@ -0,0 +1,132 @@
+#ifndef IG20261019103300
+#define IG20261019103300
+
+#include "Backend.h"
+#include "Rasterizer.h"
+#include "RgbaImage.h"
+#include "VertexShader.h"
+#include <array>
+#include <string>
+#include <vector>
+
+//* CPU backend, no window or GPU needed
+//* GLSL is not executed: draws run the fixed pipeline of `example.vert`/`example.frag`
+//* (vec2 position, vec3 color, gl_PointSize 10, interpolated color)
+class BackendSoftware : public Backend<BackendSoftware>
+{
+    friend class Backend<BackendSoftware>;
+
+    static int const MAX_ATTRIBUTES{ 16 };
+
+    struct VertexArray
+    {
+        std::array<VertexAttribute, MAX_ATTRIBUTES> attributes{};
+        std::array<unsigned int, MAX_ATTRIBUTES> buffers{};
+    };
+
+public:
+    explicit BackendSoftware( int threadCount );
+
+private:
+    bool initImpl(
+        int width,
+        int height,
+        char const* title
+    );
+
+    void deinitImpl();
+
+    bool shouldCloseImpl();
+
+    void setVsyncImpl( VsyncMode mode );
+    int refreshRateImpl();
+
+    bool supportsRenderThreadImpl();
+    void setContextCurrentImpl( bool isCurrent );
+    void setFramesInFlightImpl( int count );
+
+    void pollInputImpl();
+
+    void beginFrameImpl();
+    void endFrameImpl();
+
+    unsigned int loadShaderProgramImpl(
+        char const* vertexShaderPath,
+        char const* fragmentShaderPath
+    );
+
+    void unloadShaderProgramImpl( unsigned int program );
+    void enableShaderProgramImpl( unsigned int program );
+
+    unsigned int loadVertexArrayImpl();
+    void unloadVertexArrayImpl( unsigned int vao );
+    void enableVertexArrayImpl( unsigned int vao );
+    void disableVertexArrayImpl();
+
+    unsigned int loadVertexBufferImpl(
+        void const* data,
+        int size,
+        bool dynamic
+    );
+
+    void loadVertexBufferAsyncImpl(
+        BufferHandle handle,
+        void const* data,
+        int size
+    );
+
+    void unloadVertexBufferImpl( unsigned int vbo );
+
+    void updateVertexBufferImpl(
+        unsigned int vbo,
+        void const* data,
+        int size,
+        int offset
+    );
+
+    void setVertexAttributeImpl( VertexAttribute const& attribute );
+
+    void drawImpl(
+        Primitive primitive,
+        int first,
+        int count
+    );
+
+    void executeCommandsImpl( CommandBuffer const& commands );
+
+    void readPixelsImpl( RgbaImage& image );
+
+    //* Printed to stdout when it changes
+    void drawOverlayTextImpl( char const* text );
+
+    //* Fetch attributes of vertices [first, first + count) into SoA input streams,
+    //* run the vertex shader batch and apply the viewport transform
+    void processVertices(
+        int first,
+        int count
+    );
+
+    int threadCount_{};
+    int width_{};
+    int height_{};
+    char const* title_{};
+    std::string overlayText_{};
+
+    Rasterizer rasterizer_{};
+
+    //* Vertex stage
+    ExampleVertexShader vertexShader_{};
+    SimdLevel simdLevel_{};
+    VertexStreamStorage vertexInputs_{};
+    VertexStreamStorage vertexOutputs_{};
+    std::vector<RasterVertex> processedVertices_{};
+
+    //* Object names are index + 1, 0 stays "none" like in OpenGL
+    std::vector<std::vector<unsigned char>> buffers_{};
+    std::vector<VertexArray> vertexArrays_{};
+
+    unsigned int boundBuffer_{};
+    unsigned int boundVertexArray_{};
+};
+
+#endif
@@ -0,0 +1,701 @@
+#include "Rasterizer.h"
+
+#include "CpuFeatures.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <immintrin.h>
+#define RASTERIZER_X86
+#endif
+
+//* Sub-pixel precision: 4 bits (the minimum OpenGL allows) keeps edge values of
+//* framebuffer sized triangles within 32 bit, so 8 of them fit in one AVX2 register
+int const SUBPIXEL_BITS{ 4 };
+int const SUBPIXEL_STEP{ 1 << SUBPIXEL_BITS };
+int const SUBPIXEL_HALF{ SUBPIXEL_STEP / 2 };
+
+//* No clipper: primitives beyond this (in pixels) are dropped
+float const GUARD_BAND{ 1 << 20 };
+
+using Clock = std::chrono::steady_clock;
+
+static double millisecondsSince( Clock::time_point start )
+{
+    return std::chrono::duration<double, std::milli>( Clock::now() - start ).count();
+}
+
+static int64_t floorDivide(
+    int64_t value,
+    int64_t divisor
+)
+{
+    return ( value >= 0 ) ? value / divisor : -( ( -value + divisor - 1 ) / divisor );
+}
+
+static uint32_t packColor(
+    float r,
+    float g,
+    float b
+)
+{
+    auto toUnorm = []( float c ) -> uint32_t
+    {
+        return static_cast<uint32_t>( std::nearbyint( std::clamp( c, 0.0f, 1.0f ) * 255.0f ) );
+    };
+
+    return toUnorm( r )
+           | ( toUnorm( g ) << 8 )
+           | ( toUnorm( b ) << 16 )
+           | ( 0xffu << 24 );
+}
+
+//* Edge values at the pixel center of the first pixel in a span, and what is needed to step and shade
+struct RasterSpan
+{
+    int32_t edge[3];
+    int32_t step[3];
+    int32_t threshold[3];
+    float inverseArea;
+    float const* red;
+    float const* green;
+    float const* blue;
+};
+
+#if defined( RASTERIZER_X86 )
+//* Same operation order as the scalar path, so both produce identical colors
+__attribute__( ( target( "avx2" ) ) ) static inline __m256i interpolateAvx2(
+    __m256 w0,
+    __m256 w1,
+    __m256 w2,
+    float const* c,
+    __m256 inverseArea
+)
+{
+    __m256 value{ _mm256_add_ps(
+        _mm256_add_ps(
+            _mm256_mul_ps( w0, _mm256_set1_ps( c[0] ) ),
+            _mm256_mul_ps( w1, _mm256_set1_ps( c[1] ) )
+        ),
+        _mm256_mul_ps( w2, _mm256_set1_ps( c[2] ) )
+    ) };
+
+    value = _mm256_mul_ps( value, inverseArea );
+    value = _mm256_min_ps( _mm256_max_ps( value, _mm256_setzero_ps() ), _mm256_set1_ps( 1.0f ) );
+
+    return _mm256_cvtps_epi32( _mm256_mul_ps( value, _mm256_set1_ps( 255.0f ) ) );
+}
+
+//* Shades pixels [begin, end) of a tile row in blocks of 8, `begin` is 8 aligned
+__attribute__( ( target( "avx2" ) ) ) static void rasterSpanAvx2(
+    RasterSpan const& span,
+    int begin,
+    int end,
+    uint32_t* row
+)
+{
+    __m256i const lanes{ _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) };
+
+    __m256i edge[3];
+    __m256i step8[3];
+    __m256i threshold[3];
+
+    for ( int i{ 0 }; i < 3; ++i )
+    {
+        edge[i] = _mm256_add_epi32(
+            _mm256_set1_epi32( span.edge[i] ),
+            _mm256_mullo_epi32( lanes, _mm256_set1_epi32( span.step[i] ) )
+        );
+        step8[i] = _mm256_set1_epi32( span.step[i] * 8 );
+        threshold[i] = _mm256_set1_epi32( span.threshold[i] );
+    }
+
+    __m256 const inverseArea{ _mm256_set1_ps( span.inverseArea ) };
+    __m256i const alpha{ _mm256_set1_epi32( static_cast<int>( 0xff000000u ) ) };
+    __m256i const endX{ _mm256_set1_epi32( end ) };
+
+    for ( int x{ begin }; x < end; x += 8 )
+    {
+        __m256i mask{ _mm256_cmpgt_epi32( endX, _mm256_add_epi32( _mm256_set1_epi32( x ), lanes ) ) };
+
+        for ( int i{ 0 }; i < 3; ++i )
+        {
+            mask = _mm256_and_si256( mask, _mm256_cmpgt_epi32( edge[i], threshold[i] ) );
+        }
+
+        if ( !_mm256_testz_si256( mask, mask ) )
+        {
+            __m256 w0{ _mm256_cvtepi32_ps( edge[0] ) };
+            __m256 w1{ _mm256_cvtepi32_ps( edge[1] ) };
+            __m256 w2{ _mm256_cvtepi32_ps( edge[2] ) };
+
+            __m256i color{ _mm256_or_si256(
+                _mm256_or_si256(
+                    interpolateAvx2( w0, w1, w2, span.red, inverseArea ),
+                    _mm256_slli_epi32( interpolateAvx2( w0, w1, w2, span.green, inverseArea ), 8 )
+                ),
+                _mm256_or_si256(
+                    _mm256_slli_epi32( interpolateAvx2( w0, w1, w2, span.blue, inverseArea ), 16 ),
+                    alpha
+                )
+            ) };
+
+            _mm256_maskstore_epi32( reinterpret_cast<int*>( row + x ), mask, color );
+        }
+
+        for ( int i{ 0 }; i < 3; ++i )
+        {
+            edge[i] = _mm256_add_epi32( edge[i], step8[i] );
+        }
+    }
+}
+#endif
+
+void Rasterizer::init(
+    int width,
+    int height,
+    int threadCount
+)
+{
+    width_ = width;
+    height_ = height;
+    tilesX_ = ( width + TILE_SIZE - 1 ) / TILE_SIZE;
+    tilesY_ = ( height + TILE_SIZE - 1 ) / TILE_SIZE;
+
+    useAvx2_ = CpuFeatures::hasAvx2();
+
+    bins_.resize( static_cast<size_t>( tilesX_ ) * tilesY_ );
+    tileColor_.assign( bins_.size() * TILE_SIZE * TILE_SIZE, 0 );
+    colorBuffer_.assign( static_cast<size_t>( width ) * height, 0 );
+
+    quit_ = false;
+
+    for ( int i{ 1 }; i < std::max( threadCount, 1 ); ++i )
+    {
+        workers_.emplace_back( &Rasterizer::workerLoop, this );
+    }
+}
+
+void Rasterizer::deinit()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        quit_ = true;
+    }
+
+    wakeCondition_.notify_all();
+
+    for ( std::thread& worker : workers_ )
+    {
+        worker.join();
+    }
+
+    workers_.clear();
+}
+
+void Rasterizer::setAvx2( bool isEnabled )
+{
+    useAvx2_ = isEnabled && CpuFeatures::hasAvx2();
+}
+
+void Rasterizer::clear( uint32_t color )
+{
+    //* Nothing submitted before a clear can be visible
+    submissions_.clear();
+
+    clearColor_ = color;
+    clearPending_ = true;
+}
+
+void Rasterizer::submitTriangle(
+    RasterVertex const& v0,
+    RasterVertex const& v1,
+    RasterVertex const& v2
+)
+{
+    submissions_.push_back( { false, 0.0f, { v0, v1, v2 } } );
+}
+
+void Rasterizer::submitPoint(
+    RasterVertex const& v,
+    float size
+)
+{
+    submissions_.push_back( { true, size, { v, {}, {} } } );
+}
+
+void Rasterizer::flush()
+{
+    //* Nothing changed since the last flush, the color buffer is up to date
+    if (
+        submissions_.empty()
+        && !clearPending_
+    )
+    {
+        return;
+    }
+
+    Clock::time_point start{ Clock::now() };
+    setup();
+    stats_.setupMs += millisecondsSince( start );
+
+    start = Clock::now();
+    bin();
+    stats_.binningMs += millisecondsSince( start );
+
+    start = Clock::now();
+    runParallel( Stage::RASTER );
+    stats_.rasterMs += millisecondsSince( start );
+
+    start = Clock::now();
+    runParallel( Stage::RESOLVE );
+    stats_.resolveMs += millisecondsSince( start );
+
+    ++stats_.flushes;
+
+    submissions_.clear();
+    clearPending_ = false;
+}
+
+void Rasterizer::setup()
+{
+    PROFILE_ZONE( "setup" );
+
+    primitives_.clear();
+
+    for ( Submission const& submission : submissions_ )
+    {
+        RasterVertex const* v{ submission.vertices };
+        int const vertexCount{ submission.isPoint ? 1 : 3 };
+
+        bool inGuardBand{ true };
+
+        for ( int i{ 0 }; i < vertexCount; ++i )
+        {
+            inGuardBand = inGuardBand
+                          && std::abs( v[i].x ) < GUARD_BAND
+                          && std::abs( v[i].y ) < GUARD_BAND;
+        }
+
+        if ( !inGuardBand )
+        {
+            continue;
+        }
+
+        Primitive primitive{};
+
+        if ( submission.isPoint )
+        {
+            //* Pixels whose centers lie inside the square
+            float const radius{ submission.pointSize * 0.5f };
+
+            primitive.isPoint = true;
+            primitive.color = packColor( v[0].r, v[0].g, v[0].b );
+            primitive.minX = std::max( 0, static_cast<int>( std::ceil( v[0].x - radius - 0.5f ) ) );
+            primitive.minY = std::max( 0, static_cast<int>( std::ceil( v[0].y - radius - 0.5f ) ) );
+            primitive.maxX = std::min( width_ - 1, static_cast<int>( std::ceil( v[0].x + radius - 0.5f ) ) - 1 );
+            primitive.maxY = std::min( height_ - 1, static_cast<int>( std::ceil( v[0].y + radius - 0.5f ) ) - 1 );
+        }
+        else
+        {
+            int64_t x[3];
+            int64_t y[3];
+            int order[3]{ 0, 1, 2 };
+
+            for ( int i{ 0 }; i < 3; ++i )
+            {
+                x[i] = std::llround( v[i].x * SUBPIXEL_STEP );
+                y[i] = std::llround( v[i].y * SUBPIXEL_STEP );
+            }
+
+            int64_t area2{ ( x[1] - x[0] ) * ( y[2] - y[0] ) - ( y[1] - y[0] ) * ( x[2] - x[0] ) };
+
+            if ( area2 == 0 )
+            {
+                continue;
+            }
+
+            //* No culling: make every triangle counter-clockwise
+            if ( area2 < 0 )
+            {
+                std::swap( x[1], x[2] );
+                std::swap( y[1], y[2] );
+                std::swap( order[1], order[2] );
+                area2 = -area2;
+            }
+
+            for ( int i{ 0 }; i < 3; ++i )
+            {
+                //* Edge opposite to vertex i, from vertex a to b
+                int const a{ ( i + 1 ) % 3 };
+                int const b{ ( i + 2 ) % 3 };
+
+                primitive.a[i] = y[a] - y[b];
+                primitive.b[i] = x[b] - x[a];
+                primitive.c[i] = x[a] * y[b] - x[b] * y[a];
+
+                bool const isLeft{ y[b] < y[a] };
+                bool const isTop{ y[b] == y[a] && x[b] < x[a] };
+                primitive.threshold[i] = ( isLeft || isTop ) ? -1 : 0;
+
+                primitive.red[i] = v[order[i]].r;
+                primitive.green[i] = v[order[i]].g;
+                primitive.blue[i] = v[order[i]].b;
+            }
+
+            primitive.inverseArea = 1.0f / static_cast<float>( area2 );
+
+            //* Pixels whose centers (x * STEP + HALF) lie inside the bounds
+            int64_t const minX{ std::min( { x[0], x[1], x[2] } ) };
+            int64_t const minY{ std::min( { y[0], y[1], y[2] } ) };
+            int64_t const maxX{ std::max( { x[0], x[1], x[2] } ) };
+            int64_t const maxY{ std::max( { y[0], y[1], y[2] } ) };
+
+            primitive.minX = static_cast<int>( std::max<int64_t>( 0, -floorDivide( -( minX - SUBPIXEL_HALF ), SUBPIXEL_STEP ) ) );
+            primitive.minY = static_cast<int>( std::max<int64_t>( 0, -floorDivide( -( minY - SUBPIXEL_HALF ), SUBPIXEL_STEP ) ) );
+            primitive.maxX = static_cast<int>( std::min<int64_t>( width_ - 1, floorDivide( maxX - SUBPIXEL_HALF, SUBPIXEL_STEP ) ) );
+            primitive.maxY = static_cast<int>( std::min<int64_t>( height_ - 1, floorDivide( maxY - SUBPIXEL_HALF, SUBPIXEL_STEP ) ) );
+
+            //* Spans start up to 7 pixels left of the bounds and end up to 7 right of it
+            int64_t const cornersX[2]{
+                ( primitive.minX - 7 ) * SUBPIXEL_STEP + SUBPIXEL_HALF,
+                ( primitive.maxX + 7 ) * SUBPIXEL_STEP + SUBPIXEL_HALF
+            };
+            int64_t const cornersY[2]{
+                primitive.minY * SUBPIXEL_STEP + SUBPIXEL_HALF,
+                primitive.maxY * SUBPIXEL_STEP + SUBPIXEL_HALF
+            };
+
+            primitive.fitsInt32 = true;
+
+            for ( int i{ 0 }; i < 3; ++i )
+            {
+                for ( int64_t cornerX : cornersX )
+                {
+                    for ( int64_t cornerY : cornersY )
+                    {
+                        int64_t const edge{ primitive.a[i] * cornerX + primitive.b[i] * cornerY + primitive.c[i] };
+
+                        primitive.fitsInt32 = primitive.fitsInt32 && std::abs( edge ) < ( int64_t{ 1 } << 30 );
+                    }
+                }
+            }
+        }
+
+        if (
+            primitive.minX > primitive.maxX
+            || primitive.minY > primitive.maxY
+        )
+        {
+            continue;
+        }
+
+        primitives_.push_back( primitive );
+    }
+}
+
+void Rasterizer::bin()
+{
+    PROFILE_ZONE( "binning" );
+
+    for ( std::vector<uint32_t>& bin : bins_ )
+    {
+        bin.clear();
+    }
+
+    for ( size_t index{ 0 }; index < primitives_.size(); ++index )
+    {
+        Primitive const& primitive{ primitives_[index] };
+
+        for ( int tileY{ primitive.minY / TILE_SIZE }; tileY <= primitive.maxY / TILE_SIZE; ++tileY )
+        {
+            for ( int tileX{ primitive.minX / TILE_SIZE }; tileX <= primitive.maxX / TILE_SIZE; ++tileX )
+            {
+                if ( !primitive.isPoint )
+                {
+                    //* Reject tile if the most inside corner of any edge is outside
+                    bool outside{ false };
+
+                    for ( int i{ 0 }; i < 3; ++i )
+                    {
+                        int64_t const cornerX{ ( ( primitive.a[i] > 0 ) ? tileX * TILE_SIZE + TILE_SIZE - 1 : tileX * TILE_SIZE ) * SUBPIXEL_STEP + SUBPIXEL_HALF };
+                        int64_t const cornerY{ ( ( primitive.b[i] > 0 ) ? tileY * TILE_SIZE + TILE_SIZE - 1 : tileY * TILE_SIZE ) * SUBPIXEL_STEP + SUBPIXEL_HALF };
+
+                        outside = outside || ( primitive.a[i] * cornerX + primitive.b[i] * cornerY + primitive.c[i] <= primitive.threshold[i] );
+                    }
+
+                    if ( outside )
+                    {
+                        continue;
+                    }
+                }
+
+                bins_[tileY * tilesX_ + tileX].push_back( static_cast<uint32_t>( index ) );
+            }
+        }
+    }
+}
+
+void Rasterizer::runParallel( Stage stage )
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        stage_ = stage;
+        nextTile_ = 0;
+        busyWorkers_ = static_cast<int>( workers_.size() );
+        ++generation_;
+    }
+
+    wakeCondition_.notify_all();
+
+    work( stage );
+
+    std::unique_lock<std::mutex> lock( mutex_ );
+    doneCondition_.wait(
+        lock,
+        [&]()
+        {
+            return busyWorkers_ == 0;
+        }
+    );
+}
+
+void Rasterizer::work( Stage stage )
+{
+    PROFILE_ZONE( ( stage == Stage::RASTER ) ? "raster tiles" : "resolve tiles" );
+
+    int const tileCount{ tilesX_ * tilesY_ };
+
+    for ( int tile{ nextTile_++ }; tile < tileCount; tile = nextTile_++ )
+    {
+        if ( stage == Stage::RASTER )
+        {
+            rasterTile( tile );
+        }
+        else
+        {
+            resolveTile( tile );
+        }
+    }
+}
+
+void Rasterizer::workerLoop()
+{
+    Profiler::setThreadName( "raster worker" );
+
+    uint64_t seenGeneration{ 0 };
+
+    while ( true )
+    {
+        Stage stage{};
+
+        {
+            std::unique_lock<std::mutex> lock( mutex_ );
+            wakeCondition_.wait(
+                lock,
+                [&]()
+                {
+                    return quit_ || generation_ != seenGeneration;
+                }
+            );
+
+            if ( quit_ )
+            {
+                return;
+            }
+
+            seenGeneration = generation_;
+            stage = stage_;
+        }
+
+        work( stage );
+
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            --busyWorkers_;
+        }
+
+        doneCondition_.notify_one();
+    }
+}
+
+void Rasterizer::rasterTile( int tile )
+{
+    uint32_t* tileColor{ &tileColor_[static_cast<size_t>( tile ) * TILE_SIZE * TILE_SIZE] };
+
+    if ( clearPending_ )
+    {
+        std::fill( tileColor, tileColor + TILE_SIZE * TILE_SIZE, clearColor_ );
+    }
+
+    int const tileX{ tile % tilesX_ };
+    int const tileY{ tile / tilesX_ };
+
+    for ( uint32_t index : bins_[tile] )
+    {
+        Primitive const& primitive{ primitives_[index] };
+
+        if ( primitive.isPoint )
+        {
+            rasterPoint( primitive, tileX, tileY, tileColor );
+        }
+        else if ( useAvx2_ && primitive.fitsInt32 )
+        {
+            rasterTriangleAvx2( primitive, tileX, tileY, tileColor );
+        }
+        else
+        {
+            rasterTriangleScalar( primitive, tileX, tileY, tileColor );
+        }
+    }
+}
+
+void Rasterizer::resolveTile( int tile )
+{
+    uint32_t const* tileColor{ &tileColor_[static_cast<size_t>( tile ) * TILE_SIZE * TILE_SIZE] };
+
+    int const originX{ ( tile % tilesX_ ) * TILE_SIZE };
+    int const originY{ ( tile / tilesX_ ) * TILE_SIZE };
+    int const columns{ std::min( int{ TILE_SIZE }, width_ - originX ) };
+    int const rows{ std::min( int{ TILE_SIZE }, height_ - originY ) };
+
+    for ( int row{ 0 }; row < rows; ++row )
+    {
+        //* Flip: window y is up, color buffer rows go down
+        std::copy(
+            tileColor + row * TILE_SIZE,
+            tileColor + row * TILE_SIZE + columns,
+            &colorBuffer_[static_cast<size_t>( height_ - 1 - originY - row ) * width_ + originX]
+        );
+    }
+}
+
+void Rasterizer::rasterTriangleScalar(
+    Primitive const& primitive,
+    int tileX,
+    int tileY,
+    uint32_t* tileColor
+)
+{
+    int const originX{ tileX * TILE_SIZE };
+    int const originY{ tileY * TILE_SIZE };
+    int const minX{ std::max( primitive.minX, originX ) };
+    int const minY{ std::max( primitive.minY, originY ) };
+    int const maxX{ std::min( primitive.maxX, originX + TILE_SIZE - 1 ) };
+    int const maxY{ std::min( primitive.maxY, originY + TILE_SIZE - 1 ) };
+
+    for ( int y{ minY }; y <= maxY; ++y )
+    {
+        uint32_t* row{ tileColor + ( y - originY ) * TILE_SIZE };
+        int64_t const centerY{ y * SUBPIXEL_STEP + SUBPIXEL_HALF };
+
+        for ( int x{ minX }; x <= maxX; ++x )
+        {
+            int64_t const centerX{ x * SUBPIXEL_STEP + SUBPIXEL_HALF };
+            int64_t edge[3];
+            bool inside{ true };
+
+            for ( int i{ 0 }; i < 3; ++i )
+            {
+                edge[i] = primitive.a[i] * centerX + primitive.b[i] * centerY + primitive.c[i];
+                inside = inside && edge[i] > primitive.threshold[i];
+            }
+
+            if ( !inside )
+            {
+                continue;
+            }
+
+            float const w0{ static_cast<float>( edge[0] ) };
+            float const w1{ static_cast<float>( edge[1] ) };
+            float const w2{ static_cast<float>( edge[2] ) };
+
+            auto interpolate = [&]( float const* c )
+            {
+                return ( ( w0 * c[0] + w1 * c[1] ) + w2 * c[2] ) * primitive.inverseArea;
+            };
+
+            row[x - originX] = packColor(
+                interpolate( primitive.red ),
+                interpolate( primitive.green ),
+                interpolate( primitive.blue )
+            );
+        }
+    }
+}
+
+void Rasterizer::rasterTriangleAvx2(
+    [[maybe_unused]] Primitive const& primitive,
+    [[maybe_unused]] int tileX,
+    [[maybe_unused]] int tileY,
+    [[maybe_unused]] uint32_t* tileColor
+)
+{
+#if defined( RASTERIZER_X86 )
+    int const originX{ tileX * TILE_SIZE };
+    int const originY{ tileY * TILE_SIZE };
+    int const minY{ std::max( primitive.minY, originY ) };
+    int const maxY{ std::min( primitive.maxY, originY + TILE_SIZE - 1 ) };
+
+    //* Tile relative, first pixel aligned to 8
+    int const begin{ std::max( primitive.minX, originX ) - originX };
+    int const end{ std::min( primitive.maxX, originX + TILE_SIZE - 1 ) - originX + 1 };
+    int const alignedBegin{ begin & ~7 };
+
+    int64_t const centerX{ ( originX + alignedBegin ) * SUBPIXEL_STEP + SUBPIXEL_HALF };
+
+    RasterSpan span{};
+    span.inverseArea = primitive.inverseArea;
+    span.red = primitive.red;
+    span.green = primitive.green;
+    span.blue = primitive.blue;
+
+    for ( int i{ 0 }; i < 3; ++i )
+    {
+        span.step[i] = static_cast<int32_t>( primitive.a[i] * SUBPIXEL_STEP );
+        span.threshold[i] = primitive.threshold[i];
+    }
+
+    for ( int y{ minY }; y <= maxY; ++y )
+    {
+        int64_t const centerY{ y * SUBPIXEL_STEP + SUBPIXEL_HALF };
+
+        for ( int i{ 0 }; i < 3; ++i )
+        {
+            span.edge[i] = static_cast<int32_t>( primitive.a[i] * centerX + primitive.b[i] * centerY + primitive.c[i] );
+        }
+
+        //* Lanes left of `begin` are outside the bounds, hence outside an edge, and masked by it
+        rasterSpanAvx2( span, alignedBegin, end, tileColor + ( y - originY ) * TILE_SIZE );
+    }
+#endif
+}
+
+void Rasterizer::rasterPoint(
+    Primitive const& primitive,
+    int tileX,
+    int tileY,
+    uint32_t* tileColor
+)
+{
+    int const originX{ tileX * TILE_SIZE };
+    int const originY{ tileY * TILE_SIZE };
+    int const minX{ std::max( primitive.minX, originX ) };
+    int const minY{ std::max( primitive.minY, originY ) };
+    int const maxX{ std::min( primitive.maxX, originX + TILE_SIZE - 1 ) };
+    int const maxY{ std::min( primitive.maxY, originY + TILE_SIZE - 1 ) };
+
+    for ( int y{ minY }; y <= maxY; ++y )
+    {
+        uint32_t* row{ tileColor + ( y - originY ) * TILE_SIZE };
+
+        std::fill( row + minX - originX, row + maxX - originX + 1, primitive.color );
+    }
+}
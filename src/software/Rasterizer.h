@@ -0,0 +1,190 @@
+#ifndef IG20261019103200
+#define IG20261019103200
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//* Vertex after vertex processing, in window coordinates (pixels, y up like OpenGL)
+struct RasterVertex
+{
+    float x{};
+    float y{};
+    float r{};
+    float g{};
+    float b{};
+};
+
+//* Accumulated wall time per pipeline stage
+struct RasterStats
+{
+    double setupMs{};
+    double binningMs{};
+    double rasterMs{};
+    double resolveMs{};
+    int flushes{};
+};
+
+//* Tile-binned, multithreaded rasterizer
+//* - setup: snap to 4 bit sub-pixel grid, half-space edge functions (top-left fill rule)
+//* - binning: primitives are sorted into the TILE_SIZE^2 tiles they overlap
+//* - raster: workers take whole tiles, so primitive order per pixel is preserved;
+//*   spans of 8 pixels are evaluated at once (AVX2 if available)
+//* - resolve: tile-major color is written to the linear, top-down color buffer
+class Rasterizer
+{
+public:
+    static int const TILE_SIZE{ 64 };
+
+    void init(
+        int width,
+        int height,
+        int threadCount
+    );
+
+    void deinit();
+
+    //* Applied with the next flush
+    void clear( uint32_t color );
+
+    void submitTriangle(
+        RasterVertex const& v0,
+        RasterVertex const& v1,
+        RasterVertex const& v2
+    );
+
+    //* Square point sprite, flat colored
+    void submitPoint(
+        RasterVertex const& v,
+        float size
+    );
+
+    //* Rasterize everything submitted since the last flush, a no-op (not counted in the stats) if there is nothing
+    void flush();
+
+    //* RGBA8, rows top to bottom
+    std::vector<uint32_t> const& colorBuffer() const { return colorBuffer_; }
+
+    RasterStats const& stats() const { return stats_; }
+    int threadCount() const { return static_cast<int>( workers_.size() ) + 1; }
+    bool usesAvx2() const { return useAvx2_; }
+
+    //* Off forces the scalar path (to compare both), on only takes effect if the CPU has AVX2
+    void setAvx2( bool isEnabled );
+
+private:
+    struct Primitive
+    {
+        //* Pixel bounding box, inclusive, clamped to the framebuffer
+        int minX{};
+        int minY{};
+        int maxX{};
+        int maxY{};
+
+        bool isPoint{};
+
+        //* Point color
+        uint32_t color{};
+
+        //* Edge i is opposite to vertex i: E(x, y) = a * x + b * y + c, in sub-pixels
+        //* Covered if E > threshold (-1 for top-left edges, 0 otherwise)
+        int64_t a[3]{};
+        int64_t b[3]{};
+        int64_t c[3]{};
+        int32_t threshold[3]{};
+
+        //* 1 / (2 * area), colors are interpolated with the unnormalized edge values
+        float inverseArea{};
+        float red[3]{};
+        float green[3]{};
+        float blue[3]{};
+
+        //* Edge values over the (8 pixel aligned) bounding box fit into 32 bit lanes
+        bool fitsInt32{};
+    };
+
+    enum class Stage
+    {
+        RASTER,
+        RESOLVE,
+    };
+
+    void setup();
+    void bin();
+
+    void runParallel( Stage stage );
+    void work( Stage stage );
+    void workerLoop();
+
+    void rasterTile( int tile );
+    void resolveTile( int tile );
+
+    void rasterTriangleScalar(
+        Primitive const& primitive,
+        int tileX,
+        int tileY,
+        uint32_t* tileColor
+    );
+
+    void rasterTriangleAvx2(
+        Primitive const& primitive,
+        int tileX,
+        int tileY,
+        uint32_t* tileColor
+    );
+
+    void rasterPoint(
+        Primitive const& primitive,
+        int tileX,
+        int tileY,
+        uint32_t* tileColor
+    );
+
+    int width_{};
+    int height_{};
+    int tilesX_{};
+    int tilesY_{};
+
+    bool useAvx2_{};
+
+    uint32_t clearColor_{};
+    bool clearPending_{};
+
+    //* Submitted primitives, in order
+    struct Submission
+    {
+        bool isPoint{};
+        float pointSize{};
+        RasterVertex vertices[3]{};
+    };
+
+    std::vector<Submission> submissions_{};
+
+    std::vector<Primitive> primitives_{};
+
+    //* Primitive indices per tile, in submission order
+    std::vector<std::vector<uint32_t>> bins_{};
+
+    //* Tile-major RGBA8, TILE_SIZE^2 per tile, rows bottom to top
+    std::vector<uint32_t> tileColor_{};
+
+    std::vector<uint32_t> colorBuffer_{};
+
+    RasterStats stats_{};
+
+    //* Worker pool, the calling thread takes part as well
+    std::vector<std::thread> workers_{};
+    std::mutex mutex_{};
+    std::condition_variable wakeCondition_{};
+    std::condition_variable doneCondition_{};
+    uint64_t generation_{};
+    int busyWorkers_{};
+    bool quit_{};
+    Stage stage_{};
+    std::atomic<int> nextTile_{};
+};
+
+#endif
@@ -0,0 +1,192 @@
+#include "VertexShader.h"
+
+#include "CpuFeatures.h"
+#include <vector>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#define VERTEX_SHADER_SSE
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#define VERTEX_SHADER_NEON
+#endif
+
+namespace
+{
+#if defined( VERTEX_SHADER_SSE )
+    //* 4 floats, SSE2 is baseline on x86-64
+    struct Float4
+    {
+        static int const WIDTH{ 4 };
+
+        __m128 value;
+
+        Float4() = default;
+        explicit Float4( __m128 v ) : value( v ) {}
+        explicit Float4( float v ) : value( _mm_set1_ps( v ) ) {}
+
+        static Float4 load( float const* source ) { return Float4( _mm_loadu_ps( source ) ); }
+        void store( float* destination ) const { _mm_storeu_ps( destination, value ); }
+    };
+
+    inline Float4 operator+( Float4 a, Float4 b ) { return Float4( _mm_add_ps( a.value, b.value ) ); }
+    inline Float4 operator-( Float4 a, Float4 b ) { return Float4( _mm_sub_ps( a.value, b.value ) ); }
+    inline Float4 operator*( Float4 a, Float4 b ) { return Float4( _mm_mul_ps( a.value, b.value ) ); }
+
+    //* No FMA in SSE2, same rounding as the scalar reference
+    inline Float4 fmadd( Float4 a, Float4 b, Float4 c ) { return a * b + c; }
+#endif
+
+#if defined( VERTEX_SHADER_NEON )
+    //* 4 floats, NEON is baseline on AArch64
+    struct Float4
+    {
+        static int const WIDTH{ 4 };
+
+        float32x4_t value;
+
+        Float4() = default;
+        explicit Float4( float32x4_t v ) : value( v ) {}
+        explicit Float4( float v ) : value( vdupq_n_f32( v ) ) {}
+
+        static Float4 load( float const* source ) { return Float4( vld1q_f32( source ) ); }
+        void store( float* destination ) const { vst1q_f32( destination, value ); }
+    };
+
+    inline Float4 operator+( Float4 a, Float4 b ) { return Float4( vaddq_f32( a.value, b.value ) ); }
+    inline Float4 operator-( Float4 a, Float4 b ) { return Float4( vsubq_f32( a.value, b.value ) ); }
+    inline Float4 operator*( Float4 a, Float4 b ) { return Float4( vmulq_f32( a.value, b.value ) ); }
+    inline Float4 fmadd( Float4 a, Float4 b, Float4 c ) { return Float4( vfmaq_f32( c.value, a.value, b.value ) ); }
+#endif
+
+#if defined( VERTEX_SHADER_SSE ) || defined( VERTEX_SHADER_NEON )
+    template <typename TShader>
+    int runBlocks(
+        TShader const& shader,
+        VertexStreams const& in,
+        VertexStreams const& out,
+        int begin,
+        int end
+    )
+    {
+        Float4 inputs[TShader::INPUT_COUNT];
+        Float4 outputs[TShader::OUTPUT_COUNT];
+
+        for ( ; begin + Float4::WIDTH <= end; begin += Float4::WIDTH )
+        {
+            for ( int i{ 0 }; i < TShader::INPUT_COUNT; ++i )
+            {
+                inputs[i] = Float4::load( in.streams[i] + begin );
+            }
+
+            shader( inputs, outputs );
+
+            for ( int i{ 0 }; i < TShader::OUTPUT_COUNT; ++i )
+            {
+                outputs[i].store( out.streams[i] + begin );
+            }
+        }
+
+        return begin;
+    }
+#endif
+}
+
+#define DEFINE_VERTEX_SHADER_KERNELS( TShader )               \
+    int runVertexShaderScalar(                                \
+        TShader const& shader,                                \
+        VertexStreams const& in,                              \
+        VertexStreams const& out,                             \
+        int begin,                                            \
+        int end                                               \
+    )                                                         \
+    {                                                         \
+        float inputs[TShader::INPUT_COUNT];                   \
+        float outputs[TShader::OUTPUT_COUNT];                 \
+                                                              \
+        for ( ; begin < end; ++begin )                        \
+        {                                                     \
+            for ( int i{ 0 }; i < TShader::INPUT_COUNT; ++i ) \
+            {                                                 \
+                inputs[i] = in.streams[i][begin];             \
+            }                                                 \
+                                                              \
+            shader( inputs, outputs );                        \
+                                                              \
+            for ( int i{ 0 }; i < TShader::OUTPUT_COUNT; ++i ) \
+            {                                                 \
+                out.streams[i][begin] = outputs[i];           \
+            }                                                 \
+        }                                                     \
+                                                              \
+        return end;                                           \
+    }                                                         \
+                                                              \
+    int runVertexShaderSimd4(                                 \
+        [[maybe_unused]] TShader const& shader,               \
+        [[maybe_unused]] VertexStreams const& in,             \
+        [[maybe_unused]] VertexStreams const& out,            \
+        int begin,                                            \
+        [[maybe_unused]] int end                              \
+    )                                                         \
+    {                                                         \
+        VERTEX_SHADER_SIMD4_BODY                              \
+    }
+
+#if defined( VERTEX_SHADER_SSE ) || defined( VERTEX_SHADER_NEON )
+#define VERTEX_SHADER_SIMD4_BODY return runBlocks( shader, in, out, begin, end );
+#else
+#define VERTEX_SHADER_SIMD4_BODY return begin;
+#endif
+
+VERTEX_SHADERS( DEFINE_VERTEX_SHADER_KERNELS )
+
+SimdLevel bestSimdLevel()
+{
+    if (
+        isVertexShaderAvx2Built()
+        && CpuFeatures::hasAvx2Fma()
+    )
+    {
+        return SimdLevel::AVX2;
+    }
+
+#if defined( VERTEX_SHADER_SSE )
+    return SimdLevel::SSE;
+#elif defined( VERTEX_SHADER_NEON )
+    return SimdLevel::NEON;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+void VertexStreamStorage::resize(
+    int streams,
+    int vertexCount
+)
+{
+    streamCount = streams;
+
+    //* Only grows, keeps steady state allocation free
+    if ( vertexCount > capacity )
+    {
+        capacity = vertexCount;
+    }
+
+    if ( data.size() < static_cast<size_t>( streamCount ) * capacity )
+    {
+        data.resize( static_cast<size_t>( streamCount ) * capacity );
+    }
+}
+
+VertexStreams VertexStreamStorage::streams()
+{
+    VertexStreams result{};
+
+    for ( int i{ 0 }; i < streamCount; ++i )
+    {
+        result.streams[i] = data.data() + static_cast<size_t>( i ) * capacity;
+    }
+
+    return result;
+}
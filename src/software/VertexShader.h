@@ -0,0 +1,189 @@
+#ifndef IG20261019104000
+#define IG20261019104000
+
+#include "CpuFeatures.h"
+#include <vector>
+
+//* CPU vertex shaders, run over batches of vertices in SoA form
+//*
+//* A shader is a struct with
+//* - `INPUT_COUNT`/`OUTPUT_COUNT`: number of float streams (one per attribute component)
+//* - `template <typename TFloat> void operator()( TFloat const* in, TFloat* out ) const`
+//*   written against the SIMD float wrappers (+, -, *, `fmadd()`, construct from float),
+//*   so the same source runs 1 (scalar reference), 4 (SSE/NEON) or 8 (AVX2) vertices at once.
+//* Uniforms are plain members of the shader.
+//*
+//* Every shader has to be listed in VERTEX_SHADERS, each SIMD translation unit instantiates the list.
+
+//* Scalar (reference) counterpart of the SIMD wrappers' fmadd()
+inline float fmadd(
+    float a,
+    float b,
+    float c
+)
+{
+    return a * b + c;
+}
+
+//* example.vert: gl_Position = vec4( position, 0.0, 1.0 ), fragmentColor = vec4( color, 1.0 )
+struct ExampleVertexShader
+{
+    static int const INPUT_COUNT{ 5 };
+    static int const OUTPUT_COUNT{ 8 };
+
+    template <typename TFloat>
+    void operator()(
+        TFloat const* in,
+        TFloat* out
+    ) const
+    {
+        //* gl_Position
+        out[0] = in[0];
+        out[1] = in[1];
+        out[2] = TFloat( 0.0f );
+        out[3] = TFloat( 1.0f );
+
+        //* fragmentColor
+        out[4] = in[2];
+        out[5] = in[3];
+        out[6] = in[4];
+        out[7] = TFloat( 1.0f );
+    }
+};
+
+//* Same inputs and outputs, position multiplied by a (column major) matrix
+//* Used to transform/skin vertices on the CPU before upload
+struct TransformVertexShader
+{
+    static int const INPUT_COUNT{ 5 };
+    static int const OUTPUT_COUNT{ 8 };
+
+    float transform[16]{
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    template <typename TFloat>
+    void operator()(
+        TFloat const* in,
+        TFloat* out
+    ) const
+    {
+        //* transform * vec4( position, 0.0, 1.0 )
+        for ( int row{ 0 }; row < 4; ++row )
+        {
+            out[row] = fmadd(
+                in[0],
+                TFloat( transform[row] ),
+                fmadd(
+                    in[1],
+                    TFloat( transform[4 + row] ),
+                    TFloat( transform[12 + row] )
+                )
+            );
+        }
+
+        out[4] = in[2];
+        out[5] = in[3];
+        out[6] = in[4];
+        out[7] = TFloat( 1.0f );
+    }
+};
+
+#define VERTEX_SHADERS( X ) \
+    X( ExampleVertexShader )  \
+    X( TransformVertexShader )
+
+//* Widest level supported by this CPU (and build)
+SimdLevel bestSimdLevel();
+
+//* VertexShaderAvx2.cpp is compiled with -mavx2 -mfma (x86 only)
+bool isVertexShaderAvx2Built();
+
+//* SoA streams, one float array per attribute component
+struct VertexStreams
+{
+    static int const MAX_STREAMS{ 16 };
+
+    float* streams[MAX_STREAMS]{};
+};
+
+//* Batch kernels per SIMD level, each processes whole blocks and returns the number of vertices done
+#define DECLARE_VERTEX_SHADER_KERNELS( TShader )  \
+    int runVertexShaderScalar(                    \
+        TShader const& shader,                    \
+        VertexStreams const& in,                  \
+        VertexStreams const& out,                 \
+        int begin,                                \
+        int end                                   \
+    );                                            \
+    int runVertexShaderSimd4(                     \
+        TShader const& shader,                    \
+        VertexStreams const& in,                  \
+        VertexStreams const& out,                 \
+        int begin,                                \
+        int end                                   \
+    );                                            \
+    int runVertexShaderAvx2(                      \
+        TShader const& shader,                    \
+        VertexStreams const& in,                  \
+        VertexStreams const& out,                 \
+        int begin,                                \
+        int end                                   \
+    );
+
+VERTEX_SHADERS( DECLARE_VERTEX_SHADER_KERNELS )
+
+//* Run shader for vertices [begin, end) with the given SIMD level, the tail runs scalar
+template <typename TShader>
+void runVertexShader(
+    TShader const& shader,
+    VertexStreams const& in,
+    VertexStreams const& out,
+    int begin,
+    int end,
+    SimdLevel level
+)
+{
+    switch ( level )
+    {
+        case SimdLevel::AVX2:
+        {
+            begin = runVertexShaderAvx2( shader, in, out, begin, end );
+            break;
+        }
+
+        case SimdLevel::SSE:
+        case SimdLevel::NEON:
+        {
+            begin = runVertexShaderSimd4( shader, in, out, begin, end );
+            break;
+        }
+
+        case SimdLevel::SCALAR:
+        {
+            break;
+        }
+    }
+
+    runVertexShaderScalar( shader, in, out, begin, end );
+}
+
+//* SoA storage for a shader's streams
+struct VertexStreamStorage
+{
+    std::vector<float> data{};
+    int streamCount{};
+    int capacity{};
+
+    void resize(
+        int streams,
+        int vertexCount
+    );
+
+    VertexStreams streams();
+};
+
+#endif
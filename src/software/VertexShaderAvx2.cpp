@@ -0,0 +1,90 @@
+//* Compiled with -mavx2 -mfma (see Makefile), only call into it after checking `CpuFeatures::hasAvx2Fma()`
+//* Keep everything here in the anonymous namespace so no AVX2 code leaks into shared inline functions
+#include "VertexShader.h"
+
+#if defined( __AVX2__ ) && defined( __FMA__ )
+#include <immintrin.h>
+#define VERTEX_SHADER_AVX2
+
+namespace
+{
+    //* 8 floats
+    struct Float8
+    {
+        static int const WIDTH{ 8 };
+
+        __m256 value;
+
+        Float8() = default;
+        explicit Float8( __m256 v ) : value( v ) {}
+        explicit Float8( float v ) : value( _mm256_set1_ps( v ) ) {}
+
+        static Float8 load( float const* source ) { return Float8( _mm256_loadu_ps( source ) ); }
+        void store( float* destination ) const { _mm256_storeu_ps( destination, value ); }
+    };
+
+    inline Float8 operator+( Float8 a, Float8 b ) { return Float8( _mm256_add_ps( a.value, b.value ) ); }
+    inline Float8 operator-( Float8 a, Float8 b ) { return Float8( _mm256_sub_ps( a.value, b.value ) ); }
+    inline Float8 operator*( Float8 a, Float8 b ) { return Float8( _mm256_mul_ps( a.value, b.value ) ); }
+    inline Float8 fmadd( Float8 a, Float8 b, Float8 c ) { return Float8( _mm256_fmadd_ps( a.value, b.value, c.value ) ); }
+
+    template <typename TShader>
+    int runBlocks(
+        TShader const& shader,
+        VertexStreams const& in,
+        VertexStreams const& out,
+        int begin,
+        int end
+    )
+    {
+        Float8 inputs[TShader::INPUT_COUNT];
+        Float8 outputs[TShader::OUTPUT_COUNT];
+
+        for ( ; begin + Float8::WIDTH <= end; begin += Float8::WIDTH )
+        {
+            for ( int i{ 0 }; i < TShader::INPUT_COUNT; ++i )
+            {
+                inputs[i] = Float8::load( in.streams[i] + begin );
+            }
+
+            shader( inputs, outputs );
+
+            for ( int i{ 0 }; i < TShader::OUTPUT_COUNT; ++i )
+            {
+                outputs[i].store( out.streams[i] + begin );
+            }
+        }
+
+        return begin;
+    }
+}
+#endif
+
+#if defined( VERTEX_SHADER_AVX2 )
+#define VERTEX_SHADER_AVX2_BODY return runBlocks( shader, in, out, begin, end );
+#else
+#define VERTEX_SHADER_AVX2_BODY return begin;
+#endif
+
+#define DEFINE_VERTEX_SHADER_KERNELS( TShader )   \
+    int runVertexShaderAvx2(                      \
+        [[maybe_unused]] TShader const& shader,   \
+        [[maybe_unused]] VertexStreams const& in, \
+        [[maybe_unused]] VertexStreams const& out, \
+        int begin,                                \
+        [[maybe_unused]] int end                  \
+    )                                             \
+    {                                             \
+        VERTEX_SHADER_AVX2_BODY                   \
+    }
+
+VERTEX_SHADERS( DEFINE_VERTEX_SHADER_KERNELS )
+
+bool isVertexShaderAvx2Built()
+{
+#if defined( VERTEX_SHADER_AVX2 )
+    return true;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,214 @@
+#include "AllocationGuard.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+namespace
+{
+    struct Scope
+    {
+        std::atomic<char const*> name{};
+        std::atomic<int64_t> count{};
+        std::atomic<int64_t> bytes{};
+    };
+
+    std::atomic<bool> enabled{ false };
+    std::atomic<int64_t> frameCount{};
+
+    //* Claimed by name on first use, never freed: nothing here may allocate
+    std::array<Scope, AllocationGuard::MAX_SCOPES + 1> scopes{};
+
+    thread_local char const* currentScope{ "untagged" };
+
+#if defined( ALLOCATION_GUARD_ENABLED )
+    Scope& findScope( char const* name )
+    {
+        for ( int i{ 0 }; i < AllocationGuard::MAX_SCOPES; ++i )
+        {
+            Scope& scope{ scopes[i] };
+            char const* scopeName{ scope.name.load( std::memory_order_acquire ) };
+
+            if ( !scopeName )
+            {
+                if ( scope.name.compare_exchange_strong( scopeName, name, std::memory_order_acq_rel ) )
+                {
+                    return scope;
+                }
+            }
+
+            //* Literals of different translation units may differ in address only
+            if (
+                scopeName == name
+                || std::strcmp( scopeName, name ) == 0
+            )
+            {
+                return scope;
+            }
+        }
+
+        return scopes[AllocationGuard::MAX_SCOPES];
+    }
+
+    void count( size_t size )
+    {
+        if ( !enabled.load( std::memory_order_relaxed ) )
+        {
+            return;
+        }
+
+        frameCount.fetch_add( 1, std::memory_order_relaxed );
+
+        Scope& scope{ findScope( currentScope ) };
+        scope.count.fetch_add( 1, std::memory_order_relaxed );
+        scope.bytes.fetch_add( static_cast<int64_t>( size ), std::memory_order_relaxed );
+    }
+
+    void* allocate( size_t size )
+    {
+        count( size );
+
+        return std::malloc( size ? size : 1 );
+    }
+#endif
+}
+
+namespace AllocationGuard
+{
+    void setEnabled( bool isEnabled )
+    {
+        enabled.store( isEnabled, std::memory_order_relaxed );
+    }
+
+    bool isEnabled()
+    {
+        return enabled.load( std::memory_order_relaxed );
+    }
+
+    void resetCounts()
+    {
+        frameCount.store( 0, std::memory_order_relaxed );
+
+        for ( Scope& scope : scopes )
+        {
+            scope.count.store( 0, std::memory_order_relaxed );
+            scope.bytes.store( 0, std::memory_order_relaxed );
+        }
+    }
+
+    int64_t takeFrameCount()
+    {
+        return frameCount.exchange( 0, std::memory_order_relaxed );
+    }
+
+    std::vector<ScopeCount> scopeCounts()
+    {
+        std::vector<ScopeCount> result{};
+
+        for ( int i{ 0 }; i <= MAX_SCOPES; ++i )
+        {
+            Scope const& scope{ scopes[i] };
+            int64_t const scopeCount{ scope.count.load( std::memory_order_relaxed ) };
+
+            if ( scopeCount )
+            {
+                result.push_back( {
+                    i < MAX_SCOPES ? scope.name.load( std::memory_order_acquire ) : "other",
+                    scopeCount,
+                    scope.bytes.load( std::memory_order_relaxed )
+                } );
+            }
+        }
+
+        return result;
+    }
+
+    char const* setScope( char const* name )
+    {
+        char const* previous{ currentScope };
+        currentScope = name;
+
+        return previous;
+    }
+}
+
+#if defined( ALLOCATION_GUARD_ENABLED )
+//* Replacements of the global allocation functions, the over-aligned forms stay the library's
+void* operator new( size_t size )
+{
+    if ( void* memory{ allocate( size ) } )
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void* operator new[]( size_t size )
+{
+    return operator new( size );
+}
+
+void* operator new(
+    size_t size,
+    std::nothrow_t const&
+) noexcept
+{
+    return allocate( size );
+}
+
+void* operator new[](
+    size_t size,
+    std::nothrow_t const&
+) noexcept
+{
+    return allocate( size );
+}
+
+void operator delete( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete[]( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete(
+    void* memory,
+    size_t
+) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete[](
+    void* memory,
+    size_t
+) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete(
+    void* memory,
+    std::nothrow_t const&
+) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete[](
+    void* memory,
+    std::nothrow_t const&
+) noexcept
+{
+    std::free( memory );
+}
+#endif
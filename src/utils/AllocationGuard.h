@@ -0,0 +1,63 @@
+#ifndef IG20261019110600
+#define IG20261019110600
+
+#include <cstdint>
+#include <vector>
+
+#if defined( DEBUG ) || defined( TESTMODE )
+#define ALLOCATION_GUARD_ENABLED
+#endif
+
+//* Counts heap allocations of the steady state render loop
+//* - global `operator new`/`new[]` are replaced (AllocationGuard.cpp, debug and test builds only),
+//*   counting costs one relaxed load while disabled
+//* - allocations are attributed to the calling thread's innermost `AllocationScope` ("untagged" outside of one)
+//* - `--alloc-guard <n>` enables counting after n warm up frames and fails the run if anything is allocated
+//* Over-aligned `new` and C allocations (`malloc`, eg. in drivers) are not counted.
+namespace AllocationGuard
+{
+    //* Distinct scope names, allocations in further scopes count as "other"
+    int const MAX_SCOPES{ 32 };
+
+    struct ScopeCount
+    {
+        char const* name{};
+        int64_t count{};
+        int64_t bytes{};
+    };
+
+    void setEnabled( bool enabled );
+    bool isEnabled();
+
+    //* Zero all counts (eg. before the next backend runs)
+    void resetCounts();
+
+    //* Allocations since the last call, by all threads
+    int64_t takeFrameCount();
+
+    //* Scopes with allocations since counting was enabled
+    std::vector<ScopeCount> scopeCounts();
+
+    //* Returns the previous scope of the calling thread
+    char const* setScope( char const* name );
+}
+
+//* Attributes allocations of the enclosing scope (on this thread) to `name`, a string literal
+class AllocationScope
+{
+public:
+    explicit AllocationScope( char const* name )
+        : previous_( AllocationGuard::setScope( name ) )
+    {
+    }
+
+    ~AllocationScope() { AllocationGuard::setScope( previous_ ); }
+
+    AllocationScope( AllocationScope const& ) = delete;
+    AllocationScope& operator=( AllocationScope const& ) = delete;
+
+private:
+    char const* previous_;
+};
+
+#endif
@@ -0,0 +1,54 @@
+#include "CpuFeatures.h"
+
+namespace CpuFeatures
+{
+    bool hasAvx2()
+    {
+#if defined( __x86_64__ ) || defined( __i386__ )
+        static bool const avx2{ __builtin_cpu_supports( "avx2" ) != 0 };
+
+        return avx2;
+#else
+        return false;
+#endif
+    }
+
+    bool hasAvx2Fma()
+    {
+#if defined( __x86_64__ ) || defined( __i386__ )
+        static bool const fma{ __builtin_cpu_supports( "fma" ) != 0 };
+
+        return hasAvx2() && fma;
+#else
+        return false;
+#endif
+    }
+}
+
+char const* simdLevelName( SimdLevel level )
+{
+    switch ( level )
+    {
+        case SimdLevel::SCALAR:
+        {
+            return "scalar";
+        }
+
+        case SimdLevel::SSE:
+        {
+            return "SSE";
+        }
+
+        case SimdLevel::NEON:
+        {
+            return "NEON";
+        }
+
+        case SimdLevel::AVX2:
+        {
+            return "AVX2";
+        }
+    }
+
+    return "";
+}
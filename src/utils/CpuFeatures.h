@@ -0,0 +1,24 @@
+#ifndef IG20261019103000
+#define IG20261019103000
+
+//* SIMD code paths, widest last
+enum class SimdLevel
+{
+    SCALAR,
+    SSE,
+    NEON,
+    AVX2,
+};
+
+char const* simdLevelName( SimdLevel level );
+
+//* Runtime CPU feature detection, used to pick SIMD code paths
+namespace CpuFeatures
+{
+    bool hasAvx2();
+
+    //* AVX2 kernels are compiled with FMA as well
+    bool hasAvx2Fma();
+}
+
+#endif
@@ -0,0 +1,28 @@
+#include "File.h"
+
+#include "Log.h"
+#include <fstream>
+#include <sstream>
+#include <string>
+
+std::string readFile( std::string const& path )
+{
+    std::string content{};
+    std::ifstream inputFileStream( path );
+
+    std::ostringstream outStringStream;
+
+    if ( !inputFileStream.is_open() )
+    {
+        Log::error( "Failed to open file {}", path );
+
+        return content;
+    }
+
+    outStringStream << inputFileStream.rdbuf();
+    inputFileStream.close();
+
+    content = outStringStream.str();
+
+    return content;
+}
@@ -0,0 +1,9 @@
+#ifndef IG20261019101700
+#define IG20261019101700
+
+#include <string>
+
+//* Read whole file into string, empty on failure
+std::string readFile( std::string const& path );
+
+#endif
@@ -0,0 +1,146 @@
+#include "FrameArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    //* Sub-arena of the calling thread
+    struct SubArena
+    {
+        FrameArena const* arena{};
+        uint64_t generation{};
+        std::byte* cursor{};
+        std::byte* end{};
+    };
+
+    thread_local SubArena subArena{};
+
+    //* Unique across arenas, a new arena at the address of a destroyed one never matches a stale sub-arena
+    std::atomic<uint64_t> nextGeneration{ 1 };
+
+    std::byte* alignUp(
+        std::byte* pointer,
+        size_t alignment
+    )
+    {
+        uintptr_t const address{ reinterpret_cast<uintptr_t>( pointer ) };
+
+        return pointer + ( ( alignment - address % alignment ) % alignment );
+    }
+}
+
+FrameArena::FrameArena(
+    int framesInFlight,
+    size_t bytesPerFrame
+)
+    : bytesPerFrame_( bytesPerFrame )
+{
+    for ( int i{ 0 }; i < std::max( framesInFlight, 1 ); ++i )
+    {
+        regions_.push_back( std::make_unique<Region>() );
+        regions_.back()->memory = std::make_unique<std::byte[]>( bytesPerFrame_ );
+    }
+
+    current_ = regions_.front().get();
+    generation_.store( nextGeneration.fetch_add( 1, std::memory_order_relaxed ), std::memory_order_release );
+}
+
+void FrameArena::beginFrame( int64_t frame )
+{
+    Region& region{ *regions_[static_cast<size_t>( frame % static_cast<int64_t>( regions_.size() ) )] };
+
+    //* What the region's previous frame used
+    size_t const frameBytes{ std::min( region.used.load( std::memory_order_relaxed ), bytesPerFrame_ ) + region.overflowBytes };
+
+    if ( frameBytes )
+    {
+        lastFrameBytes_ = frameBytes;
+        highWaterBytes_ = std::max( highWaterBytes_, frameBytes );
+    }
+
+    region.used.store( 0, std::memory_order_relaxed );
+    region.overflow.clear();
+    region.overflowBytes = 0;
+
+    current_ = &region;
+    generation_.store( nextGeneration.fetch_add( 1, std::memory_order_relaxed ), std::memory_order_release );
+}
+
+void* FrameArena::allocate(
+    size_t size,
+    size_t alignment
+)
+{
+    //* Large allocations would waste most of a sub-arena
+    if ( size > SUB_ARENA_SIZE / 4 )
+    {
+        return allocateShared( size, alignment );
+    }
+
+    uint64_t const currentGeneration{ generation() };
+
+    if (
+        subArena.arena != this
+        || subArena.generation != currentGeneration
+    )
+    {
+        subArena = { this, currentGeneration, nullptr, nullptr };
+    }
+
+    std::byte* result{ subArena.cursor ? alignUp( subArena.cursor, alignment ) : nullptr };
+
+    if (
+        !result
+        || result + size > subArena.end
+    )
+    {
+        subArena.cursor = allocateShared( SUB_ARENA_SIZE, alignof( std::max_align_t ) );
+        subArena.end = subArena.cursor + SUB_ARENA_SIZE;
+        result = alignUp( subArena.cursor, alignment );
+    }
+
+    subArena.cursor = result + size;
+
+    return result;
+}
+
+std::byte* FrameArena::allocateShared(
+    size_t size,
+    size_t alignment
+)
+{
+    Region& region{ *current_ };
+
+    //* Worst case padding, keeps the bump a single atomic add
+    size_t const reserved{ size + alignment - 1 };
+    size_t const offset{ region.used.fetch_add( reserved, std::memory_order_relaxed ) };
+
+    if ( offset + reserved <= bytesPerFrame_ )
+    {
+        return alignUp( region.memory.get() + offset, alignment );
+    }
+
+    overflowCount_.fetch_add( 1, std::memory_order_relaxed );
+
+    std::lock_guard<std::mutex> lock( region.overflowMutex );
+    region.overflow.push_back( std::make_unique<std::byte[]>( reserved ) );
+    region.overflowBytes += reserved;
+
+    return alignUp( region.overflow.back().get(), alignment );
+}
+
+FrameArena::Stats FrameArena::stats() const
+{
+    return {
+        bytesPerFrame_,
+        lastFrameBytes_,
+        highWaterBytes_,
+        overflowCount_.load( std::memory_order_relaxed )
+    };
+}
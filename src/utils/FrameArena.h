@@ -0,0 +1,81 @@
+#ifndef IG20261019110500
+#define IG20261019110500
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//* Memory for data that lives one frame (command lists, staging, uniforms)
+//* - one region per frame in flight, reserved up front; `beginFrame()` resets the frame's region wholesale
+//* - any thread may allocate: threads bump inside their own sub-arena (SUB_ARENA_SIZE bytes taken from the
+//*   region with one atomic add), so allocations are lock free and do not share cache lines
+//* - a full region falls back to the heap (counted as overflow, freed with the region), size it by the high water mark
+//* Nothing is destructed, use it for trivially destructible data.
+class FrameArena
+{
+public:
+    static size_t const SUB_ARENA_SIZE{ 64 * 1024 };
+
+    struct Stats
+    {
+        size_t bytesPerFrame{};
+        size_t lastFrameBytes{};
+        size_t highWaterBytes{};
+        int64_t overflowCount{};
+    };
+
+    FrameArena(
+        int framesInFlight,
+        size_t bytesPerFrame
+    );
+
+    //* Frame boundary: no allocation may be running and the region's previous frame must be done
+    void beginFrame( int64_t frame );
+
+    void* allocate(
+        size_t size,
+        size_t alignment
+    );
+
+    template <typename T>
+    T* allocateArray( size_t count )
+    {
+        return static_cast<T*>( allocate( count * sizeof( T ), alignof( T ) ) );
+    }
+
+    Stats stats() const;
+
+    //* Changes with every `beginFrame()`, sub-arenas of older generations are stale
+    uint64_t generation() const { return generation_.load( std::memory_order_acquire ); }
+
+private:
+    struct Region
+    {
+        std::unique_ptr<std::byte[]> memory{};
+        std::atomic<size_t> used{};
+
+        std::mutex overflowMutex{};
+        std::vector<std::unique_ptr<std::byte[]>> overflow{};
+        size_t overflowBytes{};
+    };
+
+    //* Straight from the region (or the heap), thread safe
+    std::byte* allocateShared(
+        size_t size,
+        size_t alignment
+    );
+
+    size_t bytesPerFrame_{};
+    std::vector<std::unique_ptr<Region>> regions_{};
+    Region* current_{};
+    std::atomic<uint64_t> generation_{};
+
+    size_t lastFrameBytes_{};
+    size_t highWaterBytes_{};
+    std::atomic<int64_t> overflowCount_{};
+};
+
+#endif
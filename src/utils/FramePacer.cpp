@@ -0,0 +1,138 @@
+#include "FramePacer.h"
+
+#include "FrameStats.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::vector<float> newest(
+        std::vector<float> const& ring,
+        int64_t count
+    )
+    {
+        return std::vector<float>(
+            ring.begin(),
+            ring.begin() + std::min<int64_t>( count, static_cast<int64_t>( ring.size() ) )
+        );
+    }
+}
+
+FramePacer::FramePacer(
+    double targetHz,
+    bool isJustInTime,
+    int capacity
+)
+    : targetIntervalNs_( targetHz > 0.0 ? static_cast<int64_t>( 1e9 / targetHz ) : 0 )
+    , isJustInTime_( isJustInTime )
+    , workNs_( PREDICTION_FRAMES, 0 )
+    , capacity_( std::max( capacity, 1 ) )
+    , intervalsMs_( static_cast<size_t>( capacity_ ) )
+    , jitterMs_( static_cast<size_t>( capacity_ ) )
+{
+}
+
+void FramePacer::waitForFrame()
+{
+    int64_t const now{ Profiler::now() };
+
+    if ( !isActive() || !lastPresentNs_ )
+    {
+        workStartNs_ = now;
+        nextFrameNs_ = now + targetIntervalNs_;
+        return;
+    }
+
+    int64_t deadline{ nextFrameNs_ };
+
+    if ( isJustInTime_ )
+    {
+        //* The next vblank follows one interval after the last present
+        int64_t const predictedWork{ *std::max_element( workNs_.begin(), workNs_.end() ) };
+
+        deadline = lastPresentNs_ + targetIntervalNs_ - predictedWork - SAFETY_MARGIN_NS;
+    }
+
+    //* Frames that are late start right away, a late frame does not make the following ones hurry
+    if ( deadline > now )
+    {
+        PROFILE_ZONE( "pace" );
+        waitUntil( deadline );
+    }
+
+    workStartNs_ = Profiler::now();
+    totalWaitNs_ += workStartNs_ - now;
+    nextFrameNs_ = std::max( deadline, now ) + targetIntervalNs_;
+}
+
+void FramePacer::endWork()
+{
+    workNs_[workIndex_] = Profiler::now() - workStartNs_;
+    workIndex_ = ( workIndex_ + 1 ) % PREDICTION_FRAMES;
+}
+
+void FramePacer::endFrame()
+{
+    int64_t const now{ Profiler::now() };
+
+    if ( lastPresentNs_ )
+    {
+        float const intervalMs{ static_cast<float>( now - lastPresentNs_ ) * 1e-6f };
+
+        //* The first interval has no predecessor
+        if ( frameCount_ )
+        {
+            jitterMs_[static_cast<size_t>( jitterCount_ % capacity_ )] = std::abs( intervalMs - lastIntervalMs_ );
+            ++jitterCount_;
+        }
+
+        intervalsMs_[static_cast<size_t>( frameCount_ % capacity_ )] = intervalMs;
+        lastIntervalMs_ = intervalMs;
+        ++frameCount_;
+    }
+
+    lastPresentNs_ = now;
+}
+
+FramePhaseSummary FramePacer::intervals() const
+{
+    return summarizeSamples( newest( intervalsMs_, frameCount_ ) );
+}
+
+FramePhaseSummary FramePacer::jitter() const
+{
+    return summarizeSamples( newest( jitterMs_, jitterCount_ ) );
+}
+
+double FramePacer::meanWaitMs() const
+{
+    return frameCount_ ? totalWaitNs_ * 1e-6 / frameCount_ : 0.0;
+}
+
+void FramePacer::waitUntil( int64_t deadlineNs )
+{
+    int64_t const sleepUntil{ deadlineNs - sleepSlackNs_ };
+    int64_t const now{ Profiler::now() };
+
+    if ( sleepUntil > now )
+    {
+        std::this_thread::sleep_for( std::chrono::nanoseconds( sleepUntil - now ) );
+
+        //* Grow the slack quickly when a sleep overshoots, shrink it slowly otherwise
+        int64_t const overshoot{ Profiler::now() - sleepUntil };
+
+        sleepSlackNs_ = ( overshoot > sleepSlackNs_ )
+                            ? overshoot
+                            : sleepSlackNs_ - ( sleepSlackNs_ - std::max<int64_t>( overshoot, 0 ) ) / 64;
+    }
+
+    while ( Profiler::now() < deadlineNs )
+    {
+        std::this_thread::yield();
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef IG20261019105700
+#define IG20261019105700
+
+#include "FrameStats.h"
+#include <cstdint>
+#include <vector>
+
+//* Frame pacing
+//* - limiter: `waitForFrame()` holds each frame back until one target interval after the previous one,
+//*   it sleeps for the bulk of the wait and spins for the last part (sleeps overshoot by up to a scheduler tick)
+//* - just in time: the frame starts as late as possible so that its CPU work (predicted from the
+//*   slowest of the last PREDICTION_FRAMES frames) finishes right before the next vblank;
+//*   input is sampled later and the swap does not block on a full queue
+//*   (vblanks are extrapolated from the last swap, so this needs vsync on)
+//* - jitter: intervals between consecutive presents and how much they change frame to frame
+//* Times are `Profiler::now()` nanoseconds.
+class FramePacer
+{
+public:
+    static int const PREDICTION_FRAMES{ 16 };
+
+    //* Headroom added to the predicted CPU work in just in time mode
+    static int64_t const SAFETY_MARGIN_NS{ 1'000'000 };
+
+    //* `targetHz` 0 disables limiter and just in time mode
+    FramePacer(
+        double targetHz,
+        bool isJustInTime,
+        int capacity
+    );
+
+    bool isActive() const { return targetIntervalNs_ > 0; }
+
+    //* Before the frame's input is polled
+    void waitForFrame();
+
+    //* After the frame is submitted, before the swap
+    void endWork();
+
+    //* After the swap returned (vblank with vsync on)
+    void endFrame();
+
+    //* Present to present, milliseconds
+    FramePhaseSummary intervals() const;
+
+    //* |interval - previous interval|, milliseconds
+    FramePhaseSummary jitter() const;
+
+    //* CPU time spent in `waitForFrame()`, milliseconds per frame
+    double meanWaitMs() const;
+
+private:
+    //* Sleep until `deadlineNs`, then spin
+    void waitUntil( int64_t deadlineNs );
+
+    int64_t targetIntervalNs_{};
+    bool isJustInTime_{};
+
+    //* How late sleeps wake up, the sleep ends this much before the deadline
+    int64_t sleepSlackNs_{ 1'000'000 };
+
+    int64_t nextFrameNs_{};
+    int64_t workStartNs_{};
+    int64_t lastPresentNs_{};
+    float lastIntervalMs_{};
+    int64_t totalWaitNs_{};
+
+    int workIndex_{};
+    std::vector<int64_t> workNs_{};
+
+    int capacity_{};
+    int64_t frameCount_{};
+    std::vector<float> intervalsMs_{};
+    int64_t jitterCount_{};
+    std::vector<float> jitterMs_{};
+};
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef IG20261019105800
+#define IG20261019105800
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+//* Hands frame packets from the main thread (producer) to the render thread (consumer)
+//* - `framesInFlight` packets are allocated up front and reused round robin
+//*   (2 is double buffering: the main thread fills one packet while the other is rendered)
+//* - the producer blocks in `acquire()` while all packets are queued or being rendered,
+//*   the consumer blocks in `consume()` until a packet is submitted or the pipeline is closed
+//* - packets are consumed in submission order
+template <typename TPacket>
+class FramePipeline
+{
+public:
+    explicit FramePipeline( int framesInFlight )
+        : packets_( static_cast<size_t>( framesInFlight < 1 ? 1 : framesInFlight ) )
+    {
+    }
+
+    //* Producer: next free packet
+    TPacket& acquire()
+    {
+        std::unique_lock<std::mutex> lock( mutex_ );
+        freeCondition_.wait(
+            lock,
+            [this]()
+            {
+                return submitted_ - released_ < size();
+            }
+        );
+
+        return packets_[submitted_ % size()];
+    }
+
+    //* Producer: the packet from `acquire()` is complete
+    void submit()
+    {
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            ++submitted_;
+        }
+
+        readyCondition_.notify_one();
+    }
+
+    //* Producer: no more packets, `consume()` returns nullptr once the queue is drained
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            isClosed_ = true;
+        }
+
+        readyCondition_.notify_one();
+    }
+
+    //* Consumer: oldest submitted packet, nullptr when closed and drained
+    TPacket* consume()
+    {
+        std::unique_lock<std::mutex> lock( mutex_ );
+        readyCondition_.wait(
+            lock,
+            [this]()
+            {
+                return consumed_ < submitted_ || isClosed_;
+            }
+        );
+
+        if ( consumed_ == submitted_ )
+        {
+            return nullptr;
+        }
+
+        return &packets_[consumed_++ % size()];
+    }
+
+    //* Consumer: the packet from `consume()` may be reused
+    void release()
+    {
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            ++released_;
+        }
+
+        freeCondition_.notify_one();
+    }
+
+private:
+    int64_t size() const { return static_cast<int64_t>( packets_.size() ); }
+
+    std::vector<TPacket> packets_{};
+
+    std::mutex mutex_{};
+    std::condition_variable freeCondition_{};
+    std::condition_variable readyCondition_{};
+
+    int64_t submitted_{};
+    int64_t consumed_{};
+    int64_t released_{};
+    bool isClosed_{};
+};
+
+#endif
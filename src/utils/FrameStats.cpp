@@ -0,0 +1,265 @@
+#include "FrameStats.h"
+
+#include "Log.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    //* Nearest rank on sorted values
+    double percentile(
+        std::vector<float> const& sorted,
+        double fraction
+    )
+    {
+        size_t const rank{ static_cast<size_t>( std::ceil( fraction * sorted.size() ) ) };
+
+        return sorted[std::clamp<size_t>( rank, 1, sorted.size() ) - 1];
+    }
+
+    char const* seriesName( int series )
+    {
+        return ( series == static_cast<int>( FramePhase::COUNT ) )
+                   ? "frame"
+                   : framePhaseName( static_cast<FramePhase>( series ) );
+    }
+}
+
+char const* framePhaseName( FramePhase phase )
+{
+    switch ( phase )
+    {
+        case FramePhase::INPUT:
+            return "input";
+        case FramePhase::UPDATE:
+            return "update";
+        case FramePhase::SUBMIT:
+            return "submit";
+        case FramePhase::SWAP:
+            return "swap";
+        case FramePhase::COUNT:
+            break;
+    }
+
+    return "";
+}
+
+FramePhaseSummary summarizeSamples( std::vector<float> samples )
+{
+    if ( samples.empty() )
+    {
+        return {};
+    }
+
+    std::sort( samples.begin(), samples.end() );
+
+    double sum{ 0.0 };
+
+    for ( float sample : samples )
+    {
+        sum += sample;
+    }
+
+    return {
+        static_cast<int>( samples.size() ),
+        sum / samples.size(),
+        percentile( samples, 0.50 ),
+        percentile( samples, 0.95 ),
+        percentile( samples, 0.99 ),
+        samples.back()
+    };
+}
+
+FrameStats::FrameStats( int capacity )
+    : capacity_( std::max( capacity, 1 ) )
+    , records_( static_cast<size_t>( capacity_ ) )
+{
+}
+
+void FrameStats::beginFrame()
+{
+    frameStart_ = Clock::now();
+    phaseStart_ = frameStart_;
+    current_ = {};
+}
+
+void FrameStats::endPhase( FramePhase phase )
+{
+    Clock::time_point const now{ Clock::now() };
+
+    current_.milliseconds[static_cast<size_t>( phase )] += std::chrono::duration<float, std::milli>( now - phaseStart_ ).count();
+    phaseStart_ = now;
+}
+
+void FrameStats::addPhase(
+    FramePhase phase,
+    float milliseconds
+)
+{
+    current_.milliseconds[static_cast<size_t>( phase )] += milliseconds;
+}
+
+void FrameStats::endFrame()
+{
+    current_.milliseconds[static_cast<size_t>( FramePhase::COUNT )] = std::chrono::duration<float, std::milli>( Clock::now() - frameStart_ ).count();
+
+    records_[static_cast<size_t>( recordedFrames_ % capacity_ )] = current_;
+    ++recordedFrames_;
+}
+
+std::vector<float> FrameStats::series( int index ) const
+{
+    int const count{ frameCount() };
+    int64_t const first{ recordedFrames_ - count };
+
+    std::vector<float> values( static_cast<size_t>( count ) );
+
+    for ( int i{ 0 }; i < count; ++i )
+    {
+        values[i] = records_[static_cast<size_t>( ( first + i ) % capacity_ )].milliseconds[index];
+    }
+
+    return values;
+}
+
+FramePhaseSummary FrameStats::summarize( int index ) const
+{
+    return summarizeSamples( series( index ) );
+}
+
+std::array<int, FrameStats::BUCKET_COUNT> FrameStats::histogram( int index ) const
+{
+    std::array<int, BUCKET_COUNT> buckets{};
+
+    for ( float value : series( index ) )
+    {
+        int bucket{ 0 };
+
+        if ( value > 0.0f )
+        {
+            bucket = static_cast<int>( std::floor( std::log2( value ) * BUCKETS_PER_OCTAVE ) ) - MIN_OCTAVE * BUCKETS_PER_OCTAVE;
+        }
+
+        ++buckets[std::clamp( bucket, 0, BUCKET_COUNT - 1 )];
+    }
+
+    return buckets;
+}
+
+double FrameStats::bucketLowerBound( int bucket )
+{
+    if ( bucket <= 0 )
+    {
+        return 0.0;
+    }
+
+    return std::exp2( MIN_OCTAVE + static_cast<double>( bucket ) / BUCKETS_PER_OCTAVE );
+}
+
+bool FrameStats::writeJson( std::string const& path ) const
+{
+    std::ofstream file( path );
+
+    if ( !file )
+    {
+        Log::error( "Failed to open file {}", path );
+        return false;
+    }
+
+    file << "{\n  \"frames\": " << frameCount() << ",\n  \"unit\": \"ms\",\n  \"series\": {";
+
+    for ( int index{ 0 }; index < SERIES_COUNT; ++index )
+    {
+        FramePhaseSummary const summary{ summarize( index ) };
+
+        file << ( index ? "," : "" ) << "\n    \"" << seriesName( index ) << "\": {"
+             << "\"mean\": " << summary.mean
+             << ", \"p50\": " << summary.p50
+             << ", \"p95\": " << summary.p95
+             << ", \"p99\": " << summary.p99
+             << ", \"max\": " << summary.max
+             << ", \"histogram\": [";
+
+        //* Non-empty buckets only: [lower bound, upper bound, count]
+        std::array<int, BUCKET_COUNT> const buckets{ histogram( index ) };
+        bool isFirst{ true };
+
+        for ( int bucket{ 0 }; bucket < BUCKET_COUNT; ++bucket )
+        {
+            if ( !buckets[bucket] )
+            {
+                continue;
+            }
+
+            file << ( isFirst ? "" : ", " ) << "[" << bucketLowerBound( bucket ) << ", "
+                 << bucketLowerBound( bucket + 1 ) << ", " << buckets[bucket] << "]";
+            isFirst = false;
+        }
+
+        file << "]}";
+    }
+
+    file << "\n  }\n}\n";
+
+    return static_cast<bool>( file );
+}
+
+bool FrameStats::writeCsv( std::string const& path ) const
+{
+    std::ofstream file( path );
+
+    if ( !file )
+    {
+        Log::error( "Failed to open file {}", path );
+        return false;
+    }
+
+    file << "frame";
+
+    for ( int index{ 0 }; index < SERIES_COUNT; ++index )
+    {
+        file << "," << seriesName( index ) << "_ms";
+    }
+
+    file << "\n";
+
+    int const count{ frameCount() };
+    int64_t const first{ recordedFrames_ - count };
+
+    for ( int64_t frame{ first }; frame < recordedFrames_; ++frame )
+    {
+        Record const& record{ records_[static_cast<size_t>( frame % capacity_ )] };
+
+        file << frame;
+
+        for ( float milliseconds : record.milliseconds )
+        {
+            file << "," << milliseconds;
+        }
+
+        file << "\n";
+    }
+
+    return static_cast<bool>( file );
+}
+
+bool FrameStats::write( std::string const& path ) const
+{
+    size_t const extension{ path.find_last_of( '.' ) };
+    size_t const directory{ path.find_last_of( "/\\" ) };
+
+    std::string const stem{
+        ( extension == std::string::npos || ( directory != std::string::npos && extension < directory ) )
+            ? path
+            : path.substr( 0, extension )
+    };
+
+    bool const isJsonWritten{ writeJson( stem + ".json" ) };
+    bool const isCsvWritten{ writeCsv( stem + ".csv" ) };
+
+    return isJsonWritten && isCsvWritten;
+}
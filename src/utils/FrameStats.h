@@ -0,0 +1,105 @@
+#ifndef IG20261019105300
+#define IG20261019105300
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//* Phases of the render loop, in order
+enum class FramePhase
+{
+    INPUT,
+    UPDATE,
+    SUBMIT,
+    SWAP,
+    COUNT,
+};
+
+char const* framePhaseName( FramePhase phase );
+
+//* Per phase distribution, in milliseconds
+struct FramePhaseSummary
+{
+    int count{};
+    double mean{};
+    double p50{};
+    double p95{};
+    double p99{};
+    double max{};
+};
+
+//* Distribution of any millisecond samples (nearest rank percentiles)
+FramePhaseSummary summarizeSamples( std::vector<float> samples );
+
+//* Frame time recorder
+//* The loop calls `beginFrame()`, `endPhase()` after each phase and `endFrame()`.
+//* Frames go into a ring allocated up front (the newest `capacity` frames are kept),
+//* recording is two clock reads and a store per phase.
+class FrameStats
+{
+public:
+    //* Log histogram: BUCKETS_PER_OCTAVE buckets per power of two from 2^MIN_OCTAVE to 2^MAX_OCTAVE ms,
+    //* the first bucket also holds shorter, the last also longer times
+    static int const BUCKETS_PER_OCTAVE{ 4 };
+    static int const MIN_OCTAVE{ -10 };
+    static int const MAX_OCTAVE{ 10 };
+    static int const BUCKET_COUNT{ ( MAX_OCTAVE - MIN_OCTAVE ) * BUCKETS_PER_OCTAVE };
+
+    //* Phases plus the whole frame
+    static int const SERIES_COUNT{ static_cast<int>( FramePhase::COUNT ) + 1 };
+
+    explicit FrameStats( int capacity );
+
+    void beginFrame();
+    void endPhase( FramePhase phase );
+    void endFrame();
+
+    //* Phase measured elsewhere (eg. on the main thread while this one renders), added to the current frame
+    void addPhase(
+        FramePhase phase,
+        float milliseconds
+    );
+
+    int frameCount() const { return static_cast<int>( std::min<int64_t>( recordedFrames_, capacity_ ) ); }
+
+    //* Series `FramePhase::COUNT` is the whole frame
+    FramePhaseSummary summarize( int series ) const;
+
+    std::array<int, BUCKET_COUNT> histogram( int series ) const;
+
+    //* Lower bound of a histogram bucket in milliseconds
+    static double bucketLowerBound( int bucket );
+
+    //* Summary and histograms per phase
+    bool writeJson( std::string const& path ) const;
+
+    //* One row per frame, oldest first
+    bool writeCsv( std::string const& path ) const;
+
+    //* Both formats, the extension of `path` is replaced: "stats.json" writes "stats.json" and "stats.csv"
+    bool write( std::string const& path ) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Record
+    {
+        std::array<float, SERIES_COUNT> milliseconds{};
+    };
+
+    //* Milliseconds of one series, oldest frame first
+    std::vector<float> series( int index ) const;
+
+    int capacity_{};
+    std::vector<Record> records_{};
+    int64_t recordedFrames_{};
+
+    Clock::time_point frameStart_{};
+    Clock::time_point phaseStart_{};
+    Record current_{};
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef IG20261019110800
+#define IG20261019110800
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//* Typed reference into a HandlePool: slot index + generation of the slot when it was created
+//* Generation 0 is never used, so a default constructed handle is invalid.
+template <typename TTag>
+struct Handle
+{
+    uint32_t index{};
+    uint32_t generation{};
+
+    bool isValid() const { return generation != 0; }
+
+    bool operator==( Handle const& ) const = default;
+};
+
+//* Values addressed by generational handles
+//* - values are dense (iteration touches no holes), slots map handles to them
+//* - `get()` is O(1) and validated: a handle of a destroyed value returns nullptr,
+//*   even after its slot is reused (the slot's generation moved on)
+//* Lookups are const and may run on any thread while no handle is created or destroyed.
+template <typename THandle, typename TValue>
+class HandlePool
+{
+public:
+    THandle create( TValue value )
+    {
+        uint32_t index{};
+
+        if ( freeSlots_.empty() )
+        {
+            index = static_cast<uint32_t>( slots_.size() );
+            slots_.push_back( { 1, 0 } );
+        }
+        else
+        {
+            index = freeSlots_.back();
+            freeSlots_.pop_back();
+        }
+
+        Slot& slot{ slots_[index] };
+        slot.denseIndex = static_cast<uint32_t>( values_.size() );
+
+        values_.push_back( value );
+        denseToSlot_.push_back( index );
+
+        return { index, slot.generation };
+    }
+
+    TValue* get( THandle handle )
+    {
+        return isAlive( handle ) ? &values_[slots_[handle.index].denseIndex] : nullptr;
+    }
+
+    TValue const* get( THandle handle ) const
+    {
+        return isAlive( handle ) ? &values_[slots_[handle.index].denseIndex] : nullptr;
+    }
+
+    //* Returns false for stale handles
+    bool destroy( THandle handle )
+    {
+        if ( !isAlive( handle ) )
+        {
+            return false;
+        }
+
+        Slot& slot{ slots_[handle.index] };
+
+        //* The last value moves into the hole
+        uint32_t const lastSlot{ denseToSlot_.back() };
+        values_[slot.denseIndex] = values_.back();
+        denseToSlot_[slot.denseIndex] = lastSlot;
+        slots_[lastSlot].denseIndex = slot.denseIndex;
+
+        values_.pop_back();
+        denseToSlot_.pop_back();
+
+        //* Skip 0 on wrap around
+        slot.generation = slot.generation + 1 ? slot.generation + 1 : 1;
+        freeSlots_.push_back( handle.index );
+
+        return true;
+    }
+
+    bool isAlive( THandle handle ) const
+    {
+        return handle.index < slots_.size()
+               && slots_[handle.index].generation == handle.generation;
+    }
+
+    //* Dense values, in no particular order
+    std::vector<TValue> const& values() const { return values_; }
+    size_t size() const { return values_.size(); }
+
+private:
+    struct Slot
+    {
+        uint32_t generation{};
+        uint32_t denseIndex{};
+    };
+
+    std::vector<Slot> slots_{};
+    std::vector<uint32_t> freeSlots_{};
+
+    std::vector<TValue> values_{};
+    std::vector<uint32_t> denseToSlot_{};
+};
+
+#endif
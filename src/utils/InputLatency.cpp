@@ -0,0 +1,80 @@
+#include "InputLatency.h"
+
+#include "FrameStats.h"
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+InputLatency::InputLatency(
+    int capacity,
+    int maxPendingFrames
+)
+    : pending_( static_cast<size_t>( std::max( maxPendingFrames, 1 ) ) )
+    , capacity_( std::max( capacity, 1 ) )
+    , samples_( static_cast<size_t>( capacity_ ) )
+{
+}
+
+void InputLatency::setMaxPendingFrames( int count )
+{
+    std::lock_guard<std::mutex> lock( mutex_ );
+
+    pending_.assign( static_cast<size_t>( std::max( count, 1 ) ), {} );
+}
+
+void InputLatency::onInput( int64_t timestampNs )
+{
+    std::lock_guard<std::mutex> lock( mutex_ );
+
+    if ( !oldestInputNs_ )
+    {
+        oldestInputNs_ = timestampNs;
+    }
+}
+
+void InputLatency::tagFrame( int64_t frame )
+{
+    std::lock_guard<std::mutex> lock( mutex_ );
+
+    if ( !oldestInputNs_ )
+    {
+        return;
+    }
+
+    //* Overwrites frames that were never reported as presented
+    pending_[static_cast<size_t>( frame ) % pending_.size()] = { frame, oldestInputNs_ };
+    oldestInputNs_ = 0;
+}
+
+void InputLatency::onPresented(
+    int64_t frame,
+    int64_t timestampNs
+)
+{
+    std::lock_guard<std::mutex> lock( mutex_ );
+
+    PendingFrame& pending{ pending_[static_cast<size_t>( frame ) % pending_.size()] };
+
+    if ( pending.frame != frame )
+    {
+        return;
+    }
+
+    samples_[static_cast<size_t>( sampleCount_ % capacity_ )] = static_cast<float>( timestampNs - pending.oldestInputNs ) * 1e-6f;
+    ++sampleCount_;
+
+    pending.frame = -1;
+}
+
+FramePhaseSummary InputLatency::summarize() const
+{
+    std::lock_guard<std::mutex> lock( mutex_ );
+
+    return summarizeSamples(
+        std::vector<float>(
+            samples_.begin(),
+            samples_.begin() + std::min<int64_t>( sampleCount_, capacity_ )
+        )
+    );
+}
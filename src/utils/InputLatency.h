@@ -0,0 +1,60 @@
+#ifndef IG20261019105500
+#define IG20261019105500
+
+#include "FrameStats.h"
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+//* Input-to-present latency
+//* - input callbacks call `onInput()` with their arrival time
+//* - the frame that consumes the inputs (polled since the last tag) is tagged with `tagFrame()`
+//* - once that frame's swap has completed (known a few frames later), `onPresented()` adds
+//*   a sample: present time minus the oldest input of the frame
+//* Times are `Profiler::now()` nanoseconds.
+//* Input and presentation may happen on different threads (render thread).
+class InputLatency
+{
+public:
+    //* `maxPendingFrames`: frames that may be in flight between tagging and `onPresented()`,
+    //* a frame whose slot is reused before it is presented is not sampled
+    InputLatency(
+        int capacity,
+        int maxPendingFrames
+    );
+
+    //* Before the first `tagFrame()`, allocates
+    void setMaxPendingFrames( int count );
+
+    void onInput( int64_t timestampNs );
+
+    void tagFrame( int64_t frame );
+
+    void onPresented(
+        int64_t frame,
+        int64_t timestampNs
+    );
+
+    //* Newest `capacity` samples, milliseconds
+    FramePhaseSummary summarize() const;
+
+private:
+    struct PendingFrame
+    {
+        int64_t frame{ -1 };
+        int64_t oldestInputNs{};
+    };
+
+    mutable std::mutex mutex_{};
+
+    //* Oldest input not yet consumed by a frame, 0 if none
+    int64_t oldestInputNs_{};
+
+    std::vector<PendingFrame> pending_{};
+
+    int capacity_{};
+    std::vector<float> samples_{};
+    int64_t sampleCount_{};
+};
+
+#endif
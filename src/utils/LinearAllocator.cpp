@@ -0,0 +1,118 @@
+#include "LinearAllocator.h"
+
+#include "FrameArena.h"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+LinearAllocator::LinearAllocator( size_t blockSize )
+    : blockSize_( blockSize )
+{
+    blocks_.push_back( { allocateBlock( blockSize_ ), blockSize_, 0 } );
+}
+
+void* LinearAllocator::allocate(
+    size_t size,
+    size_t alignment
+)
+{
+    while ( true )
+    {
+        if ( activeBlockCount_ )
+        {
+            Block& block{ blocks_[activeBlockCount_ - 1] };
+
+            size_t const offset{ ( block.used + alignment - 1 ) & ~( alignment - 1 ) };
+
+            if ( offset + size <= block.size )
+            {
+                block.used = offset + size;
+                return block.memory + offset;
+            }
+        }
+
+        //* Next kept block if it is large enough, else a new one
+        if (
+            activeBlockCount_ < blocks_.size()
+            && blocks_[activeBlockCount_].size >= size
+        )
+        {
+            blocks_[activeBlockCount_++].used = 0;
+            continue;
+        }
+
+        size_t const newSize{ std::max( blockSize_, size ) };
+
+        blocks_.insert(
+            blocks_.begin() + static_cast<std::ptrdiff_t>( activeBlockCount_++ ),
+            { allocateBlock( newSize ), newSize, 0 }
+        );
+    }
+}
+
+void LinearAllocator::reset()
+{
+    activeBlockCount_ = 0;
+
+    //* Arena blocks went back with the arena's frame
+    if ( arena_ )
+    {
+        blocks_.clear();
+        return;
+    }
+
+    for ( Block& block : blocks_ )
+    {
+        block.used = 0;
+    }
+}
+
+void LinearAllocator::setArena( FrameArena* arena )
+{
+    if ( arena == arena_ )
+    {
+        return;
+    }
+
+    arena_ = arena;
+    blocks_.clear();
+    ownedMemory_.clear();
+    activeBlockCount_ = 0;
+}
+
+size_t LinearAllocator::bytesUsed() const
+{
+    size_t used{ 0 };
+
+    for ( size_t i{ 0 }; i < activeBlockCount(); ++i )
+    {
+        used += blocks_[i].used;
+    }
+
+    return used;
+}
+
+size_t LinearAllocator::bytesReserved() const
+{
+    size_t reserved{ 0 };
+
+    for ( Block const& block : blocks_ )
+    {
+        reserved += block.size;
+    }
+
+    return reserved;
+}
+
+std::byte* LinearAllocator::allocateBlock( size_t size )
+{
+    if ( arena_ )
+    {
+        return static_cast<std::byte*>( arena_->allocate( size, alignof( std::max_align_t ) ) );
+    }
+
+    ownedMemory_.push_back( std::make_unique<std::byte[]>( size ) );
+
+    return ownedMemory_.back().get();
+}
@@ -0,0 +1,59 @@
+#ifndef IG20261019110100
+#define IG20261019110100
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class FrameArena;
+
+//* Bump allocator over a list of blocks
+//* - `allocate()` moves a pointer, `reset()` frees everything at once and keeps the blocks,
+//*   so after warm up nothing is allocated from the heap
+//* - an allocation never spans blocks, larger ones get a block of their own
+//* - with `setArena()` blocks come from a FrameArena instead and are dropped on `reset()`
+//*   (reset the arena's frame first)
+//* Single threaded: use one allocator per thread.
+class LinearAllocator
+{
+public:
+    static size_t const DEFAULT_BLOCK_SIZE{ 64 * 1024 };
+
+    struct Block
+    {
+        std::byte* memory{};
+        size_t size{};
+        size_t used{};
+    };
+
+    explicit LinearAllocator( size_t blockSize = DEFAULT_BLOCK_SIZE );
+
+    void* allocate(
+        size_t size,
+        size_t alignment
+    );
+
+    void reset();
+
+    //* Drops all blocks, nullptr goes back to the heap
+    void setArena( FrameArena* arena );
+
+    //* Blocks in allocation order, the ones after `activeBlockCount()` are unused since `reset()`
+    std::vector<Block> const& blocks() const { return blocks_; }
+    size_t activeBlockCount() const { return activeBlockCount_; }
+
+    size_t bytesUsed() const;
+    size_t bytesReserved() const;
+
+private:
+    std::byte* allocateBlock( size_t size );
+
+    size_t blockSize_{};
+    std::vector<Block> blocks_{};
+    size_t activeBlockCount_{};
+
+    FrameArena* arena_{};
+    std::vector<std::unique_ptr<std::byte[]>> ownedMemory_{};
+};
+
+#endif
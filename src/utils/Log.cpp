@@ -0,0 +1,345 @@
+#include "Log.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    static_assert( std::has_single_bit( Log::RING_CAPACITY ) );
+
+    //* Single producer (the owning thread), single consumer (whoever drains, under `drainMutex`)
+    struct Ring
+    {
+        alignas( 64 ) std::atomic<uint32_t> head{};
+        alignas( 64 ) std::atomic<uint32_t> tail{};
+        //* Producer's last seen head, saves reading the consumer's cache line
+        uint32_t cachedHead{};
+        std::atomic<int64_t> droppedCount{};
+
+        std::array<Log::Record, Log::RING_CAPACITY> records{};
+    };
+
+    struct Logger
+    {
+        std::mutex registryMutex{};
+        std::vector<std::unique_ptr<Ring>> rings{};
+
+        std::mutex drainMutex{};
+        //* Reused, an idle drain allocates nothing
+        std::vector<std::pair<Ring*, uint32_t>> ends{};
+        std::vector<Log::Record const*> batch{};
+        std::string line{};
+
+        std::mutex wakeMutex{};
+        std::condition_variable wake{};
+        bool isStopping{};
+        std::thread writer{};
+
+        Logger();
+        ~Logger();
+
+        Ring& createRing();
+        void drain();
+        void print( Log::Record const& record );
+    };
+
+    Logger& logger()
+    {
+        static Logger instance{};
+
+        return instance;
+    }
+
+    Ring& threadRing()
+    {
+        thread_local Ring& ring{ logger().createRing() };
+
+        return ring;
+    }
+
+    char const* levelPrefix( LogLevel level )
+    {
+        switch ( level )
+        {
+            case LogLevel::TRACE:
+                return "[TRACE] ";
+            case LogLevel::INFO:
+                return "[INFO] ";
+            case LogLevel::WARNING:
+                return "[WARNING] ";
+            case LogLevel::ERROR:
+                return "[ERROR] ";
+        }
+
+        return "";
+    }
+
+    //* Returns the next argument
+    std::byte const* appendArgument(
+        std::string& line,
+        Log::ArgumentType type,
+        std::byte const* argument
+    )
+    {
+        if ( type == Log::ArgumentType::STRING )
+        {
+            uint16_t length{};
+            std::memcpy( &length, argument, sizeof( length ) );
+            line.append( reinterpret_cast<char const*>( argument + sizeof( length ) ), length );
+
+            return argument + sizeof( length ) + length;
+        }
+
+        uint64_t bits{};
+        std::memcpy( &bits, argument, sizeof( bits ) );
+
+        std::array<char, 32> text{};
+        int length{ 0 };
+
+        if ( type == Log::ArgumentType::INT )
+        {
+            length = std::snprintf( text.data(), text.size(), "%lld", static_cast<long long>( bits ) );
+        }
+        else if ( type == Log::ArgumentType::UINT )
+        {
+            length = std::snprintf( text.data(), text.size(), "%llu", static_cast<unsigned long long>( bits ) );
+        }
+        else
+        {
+            length = std::snprintf( text.data(), text.size(), "%g", std::bit_cast<double>( bits ) );
+        }
+
+        line.append( text.data(), static_cast<size_t>( std::max( length, 0 ) ) );
+
+        return argument + sizeof( bits );
+    }
+
+    Logger::Logger()
+    {
+        writer = std::thread{
+            [this]()
+            {
+                std::unique_lock<std::mutex> lock( wakeMutex );
+
+                while ( !isStopping )
+                {
+                    wake.wait_for( lock, std::chrono::milliseconds( Log::WRITER_INTERVAL_MS ) );
+
+                    lock.unlock();
+                    drain();
+                    lock.lock();
+                }
+            }
+        };
+    }
+
+    Logger::~Logger()
+    {
+        {
+            std::lock_guard<std::mutex> lock( wakeMutex );
+            isStopping = true;
+        }
+
+        wake.notify_one();
+        writer.join();
+
+        drain();
+    }
+
+    Ring& Logger::createRing()
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+
+        rings.push_back( std::make_unique<Ring>() );
+
+        return *rings.back();
+    }
+
+    void Logger::drain()
+    {
+        std::lock_guard<std::mutex> drainLock( drainMutex );
+
+        //* Rings are never removed, new ones are picked up next time
+        ends.clear();
+        {
+            std::lock_guard<std::mutex> lock( registryMutex );
+
+            for ( auto const& ring : rings )
+            {
+                ends.emplace_back( ring.get(), ring->tail.load( std::memory_order_acquire ) );
+            }
+        }
+
+        batch.clear();
+        int64_t droppedCount{ 0 };
+
+        for ( auto const& [ring, tail] : ends )
+        {
+            for ( uint32_t i{ ring->head.load( std::memory_order_relaxed ) }; i != tail; ++i )
+            {
+                batch.push_back( &ring->records[i & ( Log::RING_CAPACITY - 1 )] );
+            }
+
+            droppedCount += ring->droppedCount.exchange( 0, std::memory_order_relaxed );
+        }
+
+        //* Threads interleaved in the order they logged
+        std::stable_sort(
+            batch.begin(),
+            batch.end(),
+            []( Log::Record const* a, Log::Record const* b )
+            {
+                return a->timeNs < b->timeNs;
+            }
+        );
+
+        for ( Log::Record const* record : batch )
+        {
+            print( *record );
+        }
+
+        if ( droppedCount )
+        {
+            std::cerr << "[WARNING] " << droppedCount << " log records dropped (ring full)\n";
+        }
+
+        if ( !batch.empty() )
+        {
+            std::cout.flush();
+        }
+
+        //* Slots are reused only after they are printed
+        for ( auto const& [ring, tail] : ends )
+        {
+            ring->head.store( tail, std::memory_order_release );
+        }
+    }
+
+    void Logger::print( Log::Record const& record )
+    {
+        line = levelPrefix( record.level );
+
+        std::byte const* argument{ record.payload.data() };
+        int argumentIndex{ 0 };
+
+        for ( char const* c{ record.format }; *c; ++c )
+        {
+            if (
+                c[0] != '{'
+                || c[1] != '}'
+                || argumentIndex == record.argumentCount
+            )
+            {
+                line += *c;
+                continue;
+            }
+
+            ++c;
+            argument = appendArgument( line, record.argumentTypes[argumentIndex++], argument );
+        }
+
+        line += '\n';
+
+        ( record.level >= LogLevel::WARNING ? std::cerr : std::cout ) << line;
+    }
+}
+
+namespace Log
+{
+    Record* beginRecord()
+    {
+        Ring& ring{ threadRing() };
+        uint32_t const tail{ ring.tail.load( std::memory_order_relaxed ) };
+
+        if ( tail - ring.cachedHead == RING_CAPACITY )
+        {
+            ring.cachedHead = ring.head.load( std::memory_order_acquire );
+
+            if ( tail - ring.cachedHead == RING_CAPACITY )
+            {
+                ring.droppedCount.fetch_add( 1, std::memory_order_relaxed );
+                return nullptr;
+            }
+        }
+
+        return &ring.records[tail & ( RING_CAPACITY - 1 )];
+    }
+
+    void commitRecord( Record const& record )
+    {
+        Ring& ring{ threadRing() };
+
+        ring.tail.store( ring.tail.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+
+        if ( record.level == LogLevel::ERROR )
+        {
+            logger().wake.notify_one();
+        }
+    }
+
+    void packNumber(
+        Record& record,
+        ArgumentType type,
+        uint64_t bits
+    )
+    {
+        if ( record.payloadSize + sizeof( bits ) > PAYLOAD_SIZE )
+        {
+            return;
+        }
+
+        std::memcpy( record.payload.data() + record.payloadSize, &bits, sizeof( bits ) );
+        record.payloadSize += sizeof( bits );
+        record.argumentTypes[record.argumentCount++] = type;
+    }
+
+    void packString(
+        Record& record,
+        std::string_view text
+    )
+    {
+        uint16_t length{};
+
+        if ( record.payloadSize + sizeof( length ) > PAYLOAD_SIZE )
+        {
+            return;
+        }
+
+        //* Truncated to what is left of the payload
+        length = static_cast<uint16_t>( std::min( text.size(), PAYLOAD_SIZE - record.payloadSize - sizeof( length ) ) );
+
+        std::memcpy( record.payload.data() + record.payloadSize, &length, sizeof( length ) );
+        std::memcpy( record.payload.data() + record.payloadSize + sizeof( length ), text.data(), length );
+        record.payloadSize += static_cast<uint16_t>( sizeof( length ) + length );
+        record.argumentTypes[record.argumentCount++] = ArgumentType::STRING;
+    }
+
+    int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()
+        )
+            .count();
+    }
+
+    void flush()
+    {
+        logger().drain();
+    }
+}
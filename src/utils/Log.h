@@ -0,0 +1,193 @@
+#ifndef IG20261019110700
+#define IG20261019110700
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+//* Asynchronous logger
+//* - `Log::error( "Failed to open file {}", path )`: every "{}" is replaced by the next argument
+//* - callers copy a fixed size record (format pointer + packed arguments) into their thread's lock free ring,
+//*   a writer thread formats and prints it (errors and warnings to std::cerr, the rest to std::cout)
+//* - a full ring drops the record (counted and reported) rather than blocking the caller
+//* - levels below LOG_MIN_LEVEL are compiled out (default: TRACE with DEBUG, else INFO)
+//*
+//* Formats have to be string literals, strings are copied (and truncated to the record).
+
+#if !defined( LOG_MIN_LEVEL )
+#if defined( DEBUG )
+#define LOG_MIN_LEVEL 0
+#else
+#define LOG_MIN_LEVEL 1
+#endif
+#endif
+
+enum class LogLevel : uint8_t
+{
+    TRACE,
+    INFO,
+    WARNING,
+    ERROR,
+};
+
+namespace Log
+{
+    LogLevel const MIN_LEVEL{ static_cast<LogLevel>( LOG_MIN_LEVEL ) };
+
+    int const MAX_ARGUMENTS{ 8 };
+    size_t const PAYLOAD_SIZE{ 480 };
+
+    //* Records per thread
+    uint32_t const RING_CAPACITY{ 256 };
+
+    //* Writer wake up interval, errors wake it immediately
+    int const WRITER_INTERVAL_MS{ 5 };
+
+    enum class ArgumentType : uint8_t
+    {
+        INT,
+        UINT,
+        DOUBLE,
+        STRING,
+    };
+
+    struct Record
+    {
+        char const* format{};
+        int64_t timeNs{};
+        LogLevel level{};
+        uint8_t argumentCount{};
+        uint16_t payloadSize{};
+        std::array<ArgumentType, MAX_ARGUMENTS> argumentTypes{};
+        //* Numbers as 8 bytes, strings as 2 byte length + characters
+        std::array<std::byte, PAYLOAD_SIZE> payload{};
+    };
+
+    //* Free slot of the calling thread's ring, nullptr if the ring is full
+    Record* beginRecord();
+
+    //* Publishes the slot of `beginRecord()`
+    void commitRecord( Record const& record );
+
+    void packNumber(
+        Record& record,
+        ArgumentType type,
+        uint64_t bits
+    );
+
+    void packString(
+        Record& record,
+        std::string_view text
+    );
+
+    template <typename T>
+    void pack(
+        Record& record,
+        T const& argument
+    )
+    {
+        if constexpr ( std::is_convertible_v<T const&, std::string_view> )
+        {
+            if constexpr ( std::is_pointer_v<T> )
+            {
+                packString( record, argument ? std::string_view{ argument } : std::string_view{ "(null)" } );
+            }
+            else
+            {
+                packString( record, argument );
+            }
+        }
+        else if constexpr ( std::is_enum_v<T> )
+        {
+            pack( record, static_cast<std::underlying_type_t<T>>( argument ) );
+        }
+        else if constexpr ( std::is_floating_point_v<T> )
+        {
+            packNumber( record, ArgumentType::DOUBLE, std::bit_cast<uint64_t>( static_cast<double>( argument ) ) );
+        }
+        else if constexpr ( std::is_signed_v<T> )
+        {
+            packNumber( record, ArgumentType::INT, static_cast<uint64_t>( static_cast<int64_t>( argument ) ) );
+        }
+        else
+        {
+            static_assert( std::is_unsigned_v<T>, "Log arguments are numbers, enums or strings" );
+            packNumber( record, ArgumentType::UINT, static_cast<uint64_t>( argument ) );
+        }
+    }
+
+    int64_t now();
+
+    template <LogLevel level, typename... TArguments>
+    void write(
+        char const* format,
+        TArguments const&... arguments
+    )
+    {
+        static_assert( sizeof...( TArguments ) <= MAX_ARGUMENTS );
+
+        if constexpr ( level >= MIN_LEVEL )
+        {
+            Record* record{ beginRecord() };
+
+            if ( !record )
+            {
+                return;
+            }
+
+            record->format = format;
+            record->timeNs = now();
+            record->level = level;
+            record->argumentCount = 0;
+            record->payloadSize = 0;
+
+            ( pack( *record, arguments ), ... );
+
+            commitRecord( *record );
+        }
+    }
+
+    template <typename... TArguments>
+    void trace(
+        char const* format,
+        TArguments const&... arguments
+    )
+    {
+        write<LogLevel::TRACE>( format, arguments... );
+    }
+
+    template <typename... TArguments>
+    void info(
+        char const* format,
+        TArguments const&... arguments
+    )
+    {
+        write<LogLevel::INFO>( format, arguments... );
+    }
+
+    template <typename... TArguments>
+    void warning(
+        char const* format,
+        TArguments const&... arguments
+    )
+    {
+        write<LogLevel::WARNING>( format, arguments... );
+    }
+
+    template <typename... TArguments>
+    void error(
+        char const* format,
+        TArguments const&... arguments
+    )
+    {
+        write<LogLevel::ERROR>( format, arguments... );
+    }
+
+    //* Writes everything logged so far (by any thread) before returning
+    void flush();
+}
+
+#endif
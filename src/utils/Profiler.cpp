@@ -0,0 +1,375 @@
+#include "Profiler.h"
+
+#include "AllocationGuard.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct Event
+    {
+        char const* name{};
+        int64_t startNs{};
+        int64_t durationNs{};
+        int session{};
+    };
+
+    //* Events of one thread (or the GPU), only the owner appends
+    //* The mutex is uncontended except while a frame is summarized or the trace is written
+    struct Lane
+    {
+        int id{};
+        std::string name{};
+        bool isGpu{};
+        std::mutex mutex{};
+        std::vector<Event> events{};
+        size_t summarizedCount{};
+        int64_t droppedCount{};
+    };
+
+    struct Totals
+    {
+        int64_t cpuNs{};
+        int64_t gpuNs{};
+    };
+
+    std::atomic<bool> enabled{ false };
+    std::atomic<int> session{ 0 };
+
+    std::mutex registryMutex{};
+    std::vector<std::unique_ptr<Lane>> lanes{};
+    std::vector<std::string> sessionNames{};
+
+    //* Thread of the frame markers only (main or render thread)
+    int64_t frameStartNs{};
+    int summaryFrames{};
+    int64_t summaryFrameNs{};
+    std::map<std::string_view, Totals> summaryTotals{};
+    std::string summaryText{};
+
+    Lane& createLane(
+        std::string name,
+        bool isGpu
+    )
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+
+        lanes.push_back( std::make_unique<Lane>() );
+        lanes.back()->id = static_cast<int>( lanes.size() );
+        lanes.back()->name = std::move( name );
+        lanes.back()->isGpu = isGpu;
+
+        return *lanes.back();
+    }
+
+    Lane& threadLane()
+    {
+        thread_local Lane& lane{ createLane( "thread", false ) };
+
+        return lane;
+    }
+
+    Lane& gpuLane()
+    {
+        static Lane& lane{ createLane( "GPU", true ) };
+
+        return lane;
+    }
+
+    void append(
+        Lane& lane,
+        char const* name,
+        int64_t startNs,
+        int64_t endNs
+    )
+    {
+        AllocationScope const allocationScope{ "profiler" };
+        std::lock_guard<std::mutex> lock( lane.mutex );
+
+        if ( lane.events.size() >= static_cast<size_t>( Profiler::MAX_EVENTS_PER_LANE ) )
+        {
+            ++lane.droppedCount;
+            return;
+        }
+
+        lane.events.push_back( { name, startNs, endNs - startNs, session.load( std::memory_order_relaxed ) } );
+    }
+
+    //* Add the events recorded since the last call to the rolling totals
+    void accumulate()
+    {
+        std::lock_guard<std::mutex> registryLock( registryMutex );
+
+        for ( auto const& lane : lanes )
+        {
+            std::lock_guard<std::mutex> lock( lane->mutex );
+
+            for ( size_t i{ lane->summarizedCount }; i < lane->events.size(); ++i )
+            {
+                Event const& event{ lane->events[i] };
+                Totals& totals{ summaryTotals[event.name] };
+
+                ( lane->isGpu ? totals.gpuNs : totals.cpuNs ) += event.durationNs;
+            }
+
+            lane->summarizedCount = lane->events.size();
+        }
+    }
+
+    void updateSummary()
+    {
+        std::vector<std::pair<std::string_view, Totals>> sorted(
+            summaryTotals.begin(),
+            summaryTotals.end()
+        );
+
+        std::sort(
+            sorted.begin(),
+            sorted.end(),
+            []( auto const& a, auto const& b )
+            {
+                return std::max( a.second.cpuNs, a.second.gpuNs ) > std::max( b.second.cpuNs, b.second.gpuNs );
+            }
+        );
+
+        double const toMsPerFrame{ 1e-6 / summaryFrames };
+
+        std::ostringstream text{};
+        text << std::fixed << std::setprecision( 3 )
+             << "frame " << summaryFrameNs * toMsPerFrame << " ms (avg of " << summaryFrames << ")\n";
+
+        for ( auto const& [name, totals] : sorted )
+        {
+            if ( name == "frame" )
+            {
+                continue;
+            }
+
+            text << name << ":";
+
+            if ( totals.cpuNs || !totals.gpuNs )
+            {
+                text << " cpu " << totals.cpuNs * toMsPerFrame << " ms";
+            }
+
+            if ( totals.gpuNs )
+            {
+                text << " gpu " << totals.gpuNs * toMsPerFrame << " ms";
+            }
+
+            text << "\n";
+        }
+
+        summaryText = text.str();
+
+        summaryTotals.clear();
+        summaryFrames = 0;
+        summaryFrameNs = 0;
+    }
+
+    void writeJsonString(
+        std::ostream& out,
+        std::string_view text
+    )
+    {
+        out << '"';
+
+        for ( char c : text )
+        {
+            if ( c == '"' || c == '\\' )
+            {
+                out << '\\';
+            }
+
+            out << c;
+        }
+
+        out << '"';
+    }
+}
+
+namespace Profiler
+{
+    void setEnabled( bool isEnabled )
+    {
+        enabled.store( isEnabled, std::memory_order_relaxed );
+    }
+
+    bool isEnabled()
+    {
+        return enabled.load( std::memory_order_relaxed );
+    }
+
+    void beginSession( char const* name )
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+
+        sessionNames.emplace_back( name );
+        session.store( static_cast<int>( sessionNames.size() ) - 1, std::memory_order_relaxed );
+
+        summaryTotals.clear();
+        summaryText.clear();
+        summaryFrames = 0;
+        summaryFrameNs = 0;
+    }
+
+    void setThreadName( char const* name )
+    {
+        Lane& lane{ threadLane() };
+        std::lock_guard<std::mutex> lock( lane.mutex );
+
+        lane.name = name;
+    }
+
+    int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()
+        )
+            .count();
+    }
+
+    void beginFrame()
+    {
+        if ( !isEnabled() )
+        {
+            return;
+        }
+
+        frameStartNs = now();
+    }
+
+    void endFrame()
+    {
+        if ( !isEnabled() )
+        {
+            return;
+        }
+
+        AllocationScope const allocationScope{ "profiler" };
+
+        int64_t const frameEndNs{ now() };
+        append( threadLane(), "frame", frameStartNs, frameEndNs );
+
+        accumulate();
+        summaryFrameNs += frameEndNs - frameStartNs;
+
+        if ( ++summaryFrames == SUMMARY_FRAMES )
+        {
+            updateSummary();
+        }
+    }
+
+    void recordZone(
+        char const* name,
+        int64_t startNs,
+        int64_t endNs
+    )
+    {
+        append( threadLane(), name, startNs, endNs );
+    }
+
+    void recordGpuZone(
+        char const* name,
+        int64_t startNs,
+        int64_t endNs
+    )
+    {
+        append( gpuLane(), name, startNs, endNs );
+    }
+
+    std::string const& summary()
+    {
+        return summaryText;
+    }
+
+    bool writeChromeTrace( std::string const& path )
+    {
+        std::ofstream file( path );
+
+        if ( !file )
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> registryLock( registryMutex );
+
+        //* Timestamps are microseconds, relative to the first event
+        int64_t originNs{ INT64_MAX };
+
+        for ( auto const& lane : lanes )
+        {
+            std::lock_guard<std::mutex> lock( lane->mutex );
+
+            for ( Event const& event : lane->events )
+            {
+                originNs = std::min( originNs, event.startNs );
+            }
+        }
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        file << std::fixed << std::setprecision( 3 );
+
+        bool isFirst{ true };
+        auto separator = [&]() -> std::ostream&
+        {
+            file << ( isFirst ? "" : ",\n" );
+            isFirst = false;
+            return file;
+        };
+
+        for ( size_t i{ 0 }; i < sessionNames.size(); ++i )
+        {
+            for ( auto const& lane : lanes )
+            {
+                std::lock_guard<std::mutex> lock( lane->mutex );
+
+                separator() << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << i
+                            << ",\"tid\":" << lane->id << ",\"args\":{\"name\":";
+                writeJsonString( file, lane->name );
+                file << "}}";
+            }
+
+            separator() << "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":" << i << ",\"args\":{\"name\":";
+            writeJsonString( file, sessionNames[i] );
+            file << "}}";
+        }
+
+        for ( auto const& lane : lanes )
+        {
+            std::lock_guard<std::mutex> lock( lane->mutex );
+
+            for ( Event const& event : lane->events )
+            {
+                separator() << "{\"ph\":\"X\",\"name\":";
+                writeJsonString( file, event.name );
+                file << ",\"pid\":" << event.session
+                     << ",\"tid\":" << lane->id
+                     << ",\"ts\":" << ( event.startNs - originNs ) * 1e-3
+                     << ",\"dur\":" << event.durationNs * 1e-3 << "}";
+            }
+
+            if ( lane->droppedCount )
+            {
+                separator() << "{\"ph\":\"i\",\"s\":\"t\",\"name\":\"" << lane->droppedCount
+                            << " events dropped\",\"pid\":0,\"tid\":" << lane->id << ",\"ts\":0}";
+            }
+        }
+
+        file << "\n]}\n";
+
+        return static_cast<bool>( file );
+    }
+}
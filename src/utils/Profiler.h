@@ -0,0 +1,98 @@
+#ifndef IG20261019105100
+#define IG20261019105100
+
+#include <cstdint>
+#include <string>
+
+//* Frame profiler
+//* - CPU zones (`PROFILE_ZONE( "name" )`) are recorded per thread ("lane"),
+//*   they compile to nothing unless DEBUG or PROFILE is defined (`make ... PROFILE=true`)
+//* - GPU zones are reported by the backends, see GpuProfiler.h
+//* - Recording starts with `setEnabled( true )` (`--profile <trace.json>`)
+//* - `writeChromeTrace()` exports everything as Chrome trace event JSON (chrome://tracing, Perfetto)
+//* - `summary()` holds per zone ms/frame, averaged over the last SUMMARY_FRAMES frames
+//*
+//* Zone names have to be string literals (or otherwise outlive the profiler).
+
+#if defined( DEBUG ) || defined( PROFILE )
+#define PROFILER_ZONES_ENABLED
+#endif
+
+namespace Profiler
+{
+    int const SUMMARY_FRAMES{ 60 };
+
+    //* Events kept per lane, later ones are dropped (and counted)
+    int const MAX_EVENTS_PER_LANE{ 1 << 20 };
+
+    void setEnabled( bool enabled );
+    bool isEnabled();
+
+    //* Start a new process row in the trace (eg. one per backend)
+    void beginSession( char const* name );
+
+    //* Name of the calling thread's lane
+    void setThreadName( char const* name );
+
+    //* Steady clock in nanoseconds, shared by all lanes
+    int64_t now();
+
+    //* Frame markers, called by the render loop
+    void beginFrame();
+    void endFrame();
+
+    void recordZone(
+        char const* name,
+        int64_t startNs,
+        int64_t endNs
+    );
+
+    //* Times converted to `now()` by the caller
+    void recordGpuZone(
+        char const* name,
+        int64_t startNs,
+        int64_t endNs
+    );
+
+    //* Rolling per zone summary, empty until the first SUMMARY_FRAMES frames are done
+    std::string const& summary();
+
+    bool writeChromeTrace( std::string const& path );
+}
+
+//* Records the enclosing scope
+class ProfileZone
+{
+public:
+    explicit ProfileZone( char const* name )
+        : name_( name )
+        , start_( Profiler::isEnabled() ? Profiler::now() : 0 )
+    {
+    }
+
+    ~ProfileZone()
+    {
+        if ( start_ )
+        {
+            Profiler::recordZone( name_, start_, Profiler::now() );
+        }
+    }
+
+    ProfileZone( ProfileZone const& ) = delete;
+    ProfileZone& operator=( ProfileZone const& ) = delete;
+
+private:
+    char const* name_;
+    int64_t start_;
+};
+
+#define PROFILE_CONCAT_IMPL( a, b ) a##b
+#define PROFILE_CONCAT( a, b ) PROFILE_CONCAT_IMPL( a, b )
+
+#if defined( PROFILER_ZONES_ENABLED )
+#define PROFILE_ZONE( name ) ProfileZone const PROFILE_CONCAT( profileZone, __LINE__ ){ name }
+#else
+#define PROFILE_ZONE( name )
+#endif
+
+#endif
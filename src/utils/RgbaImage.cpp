@@ -0,0 +1,105 @@
+#include "RgbaImage.h"
+
+#include "Log.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+bool writePpm(
+    std::string const& path,
+    RgbaImage const& image
+)
+{
+    std::ofstream outputFileStream( path, std::ios::binary );
+
+    if ( !outputFileStream.is_open() )
+    {
+        Log::error( "Failed to open file {}", path );
+
+        return false;
+    }
+
+    outputFileStream << "P6\n"
+                     << image.width << " " << image.height << "\n255\n";
+
+    for ( size_t i{ 0 }; i < image.pixels.size(); i += 4 )
+    {
+        outputFileStream.write( reinterpret_cast<char const*>( &image.pixels[i] ), 3 );
+    }
+
+    return true;
+}
+
+bool readPpm(
+    std::string const& path,
+    RgbaImage& image
+)
+{
+    std::ifstream inputFileStream( path, std::ios::binary );
+
+    std::string magic{};
+    int maxValue{};
+
+    inputFileStream >> magic >> image.width >> image.height >> maxValue;
+
+    if (
+        !inputFileStream
+        || magic != "P6"
+        || maxValue != 255
+    )
+    {
+        Log::error( "Failed to read PPM file {}", path );
+
+        return false;
+    }
+
+    //* Single whitespace after header
+    inputFileStream.get();
+
+    image.pixels.assign( static_cast<size_t>( image.width ) * image.height * 4, 255 );
+
+    for ( size_t i{ 0 }; i < image.pixels.size(); i += 4 )
+    {
+        inputFileStream.read( reinterpret_cast<char*>( &image.pixels[i] ), 3 );
+    }
+
+    return static_cast<bool>( inputFileStream );
+}
+
+ImageDifference compareImages(
+    RgbaImage const& a,
+    RgbaImage const& b
+)
+{
+    ImageDifference difference{};
+
+    if (
+        a.width != b.width
+        || a.height != b.height
+    )
+    {
+        difference.differentPixels = std::max( a.width * a.height, b.width * b.height );
+        difference.maxChannelDifference = 255;
+
+        return difference;
+    }
+
+    for ( size_t i{ 0 }; i < a.pixels.size(); i += 4 )
+    {
+        int pixelDifference{ 0 };
+
+        for ( size_t channel{ 0 }; channel < 3; ++channel )
+        {
+            pixelDifference = std::max( pixelDifference, std::abs( a.pixels[i + channel] - b.pixels[i + channel] ) );
+        }
+
+        if ( pixelDifference )
+        {
+            ++difference.differentPixels;
+            difference.maxChannelDifference = std::max( difference.maxChannelDifference, pixelDifference );
+        }
+    }
+
+    return difference;
+}
@@ -0,0 +1,38 @@
+#ifndef IG20261019103100
+#define IG20261019103100
+
+#include <string>
+#include <vector>
+
+//* RGBA8 image, rows top to bottom
+struct RgbaImage
+{
+    int width{};
+    int height{};
+    std::vector<unsigned char> pixels{};
+};
+
+//* Binary PPM (P6), alpha is dropped
+bool writePpm(
+    std::string const& path,
+    RgbaImage const& image
+);
+
+bool readPpm(
+    std::string const& path,
+    RgbaImage& image
+);
+
+struct ImageDifference
+{
+    int differentPixels{};
+    int maxChannelDifference{};
+};
+
+//* Compares RGB only
+ImageDifference compareImages(
+    RgbaImage const& a,
+    RgbaImage const& b
+);
+
+#endif
@@ -0,0 +1,57 @@
+#include "Signals.h"
+
+#include <csignal>
+
+namespace
+{
+    volatile std::sig_atomic_t quitRequested{ 0 };
+    volatile std::sig_atomic_t dumpRequested{ 0 };
+
+    //* A second signal terminates right away, in case the loop hangs
+    extern "C" void onQuitSignal( int signal )
+    {
+        if ( quitRequested )
+        {
+            std::signal( signal, SIG_DFL );
+            std::raise( signal );
+        }
+
+        quitRequested = 1;
+    }
+
+#if defined( SIGUSR1 )
+    extern "C" void onDumpSignal( int )
+    {
+        dumpRequested = 1;
+    }
+#endif
+}
+
+namespace Signals
+{
+    void install()
+    {
+        std::signal( SIGINT, onQuitSignal );
+        std::signal( SIGTERM, onQuitSignal );
+#if defined( SIGUSR1 )
+        std::signal( SIGUSR1, onDumpSignal );
+#endif
+    }
+
+    bool isQuitRequested()
+    {
+        return quitRequested;
+    }
+
+    bool consumeDumpRequest()
+    {
+        if ( !dumpRequested )
+        {
+            return false;
+        }
+
+        dumpRequested = 0;
+
+        return true;
+    }
+}
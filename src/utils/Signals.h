@@ -0,0 +1,17 @@
+#ifndef IG20261019105400
+#define IG20261019105400
+
+//* SIGINT/SIGTERM end the render loop orderly (so results are still written),
+//* SIGUSR1 (where available) requests a dump of the current statistics.
+//* The handlers only set flags, the loop polls them.
+namespace Signals
+{
+    void install();
+
+    bool isQuitRequested();
+
+    //* True once per SIGUSR1
+    bool consumeDumpRequest();
+}
+
+#endif
@@ -0,0 +1,71 @@
+#include "AllocationGuard.h"
+#include "BackendSoftware.h"
+#include "Options.h"
+#include "Workload.h"
+#include <catch2/catch.hpp>
+#include <cstring>
+#include <new>
+#include <vector>
+
+namespace
+{
+    //* Headless steady state: the software backend needs no window or GPU
+    Options guardedSoftwareRun()
+    {
+        Options options{};
+        options.backend = BackendType::SOFTWARE;
+        options.frames = 120;
+        options.threads = 2;
+        options.allocationGuardFrames = 30;
+
+        return options;
+    }
+}
+
+TEST_CASE( "Allocations are counted per scope while enabled", "[allocations]" )
+{
+    AllocationGuard::resetCounts();
+    AllocationGuard::setEnabled( true );
+
+    {
+        AllocationScope const allocationScope{ "allocation test" };
+
+        //* The function, not a new-expression, so it cannot be elided
+        ::operator delete( ::operator new( 24 ) );
+    }
+
+    AllocationGuard::setEnabled( false );
+
+    ::operator delete( ::operator new( 24 ) );
+
+    CHECK( AllocationGuard::takeFrameCount() == 1 );
+    CHECK( AllocationGuard::takeFrameCount() == 0 );
+
+    std::vector<AllocationGuard::ScopeCount> const scopes{ AllocationGuard::scopeCounts() };
+
+    REQUIRE( scopes.size() == 1 );
+    CHECK( std::strcmp( scopes[0].name, "allocation test" ) == 0 );
+    CHECK( scopes[0].count == 1 );
+    CHECK( scopes[0].bytes == 24 );
+
+    AllocationGuard::resetCounts();
+}
+
+TEST_CASE( "The render loop does not allocate after warm up", "[allocations]" )
+{
+    Options options{ guardedSoftwareRun() };
+
+    SECTION( "main thread" )
+    {
+    }
+
+    SECTION( "render thread" )
+    {
+        options.renderThread = true;
+        options.framesInFlight = 3;
+    }
+
+    BackendSoftware backend{ options.threads };
+
+    CHECK( runWorkload( backend, "software rasterizer", options ) == 0 );
+}
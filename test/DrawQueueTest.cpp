@@ -0,0 +1,125 @@
+#include "CommandBuffer.h"
+#include "DrawQueue.h"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+    //* `first` of every recorded draw, in order (draws are submitted with their submission index as `first`)
+    struct DrawOrder
+    {
+        std::vector<int> draws{};
+
+        void bindProgram( unsigned int ) {}
+        void bindVertexArray( unsigned int ) {}
+        void setUniform( int, UniformType, float const* ) {}
+        void bindUniformRange( unsigned int, unsigned int, uint32_t, uint32_t ) {}
+
+        void draw(
+            Primitive,
+            int first,
+            int
+        )
+        {
+            draws.push_back( first );
+        }
+    };
+
+    std::vector<int> recordedOrder( DrawQueue const& queue )
+    {
+        CommandBuffer commands{};
+        queue.record( commands );
+
+        DrawOrder order{};
+        commands.replay( order );
+
+        return order.draws;
+    }
+
+    DrawQueue::Draw drawNumber(
+        int index,
+        unsigned int program = 1,
+        unsigned int vertexArray = 1
+    )
+    {
+        return { program, vertexArray, Primitive::TRIANGLES, index, 3 };
+    }
+}
+
+TEST_CASE( "Radix sort orders by key and keeps submission order of equal keys", "[drawqueue]" )
+{
+    int const drawCount{ 5000 };
+
+    std::mt19937_64 random{ 7 };
+    std::vector<uint64_t> keys( drawCount );
+    DrawQueue queue{};
+
+    for ( int i{ 0 }; i < drawCount; ++i )
+    {
+        //* Few distinct keys, so many are equal; spread over all bytes
+        keys[i] = ( random() % 64 ) * 0x0101010101010101ull;
+        queue.submit( keys[i], drawNumber( i ) );
+    }
+
+    queue.sort();
+
+    std::vector<int> expected( drawCount );
+
+    for ( int i{ 0 }; i < drawCount; ++i )
+    {
+        expected[i] = i;
+    }
+
+    std::stable_sort(
+        expected.begin(),
+        expected.end(),
+        [&]( int a, int b )
+        {
+            return keys[a] < keys[b];
+        }
+    );
+
+    CHECK( recordedOrder( queue ) == expected );
+}
+
+TEST_CASE( "Draw keys order layers, then opaque by state front to back, then translucent back to front", "[drawqueue]" )
+{
+    DrawQueue queue{};
+
+    queue.submit( DrawKey::make( 1, false, 1, 1, 0.5f ), drawNumber( 0 ) );
+    queue.submit( DrawKey::make( 0, true, 1, 1, 0.2f ), drawNumber( 1 ) );
+    queue.submit( DrawKey::make( 0, true, 2, 1, 0.8f ), drawNumber( 2 ) );
+    queue.submit( DrawKey::make( 0, false, 2, 1, 0.1f ), drawNumber( 3 ) );
+    queue.submit( DrawKey::make( 0, false, 1, 1, 0.9f ), drawNumber( 4 ) );
+    queue.submit( DrawKey::make( 0, false, 1, 1, 0.3f ), drawNumber( 5 ) );
+
+    queue.sort();
+
+    CHECK( recordedOrder( queue ) == std::vector<int>{ 5, 4, 3, 2, 1, 0 } );
+}
+
+TEST_CASE( "Recording skips redundant program and vertex array binds", "[drawqueue]" )
+{
+    DrawQueue queue{};
+
+    //* Interleaved states, grouped by the sort
+    for ( int i{ 0 }; i < 8; ++i )
+    {
+        unsigned int const program{ 1u + i % 2 };
+        unsigned int const vertexArray{ 1u + i % 4 };
+
+        queue.submit( DrawKey::make( 0, false, program, vertexArray, 0.0f ), drawNumber( i, program, vertexArray ) );
+    }
+
+    queue.sort();
+
+    CommandBuffer commands{};
+    DrawQueue::Stats const stats{ queue.record( commands ) };
+
+    CHECK( stats.draws == 8 );
+    CHECK( stats.programChanges == 2 );
+    CHECK( stats.vertexArrayChanges == 4 );
+}
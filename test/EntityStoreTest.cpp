@@ -0,0 +1,274 @@
+#include "Archetype.h"
+#include "Component.h"
+#include "EntityStore.h"
+#include "Query.h"
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    //* Every component carries its entity's index and a value, so a slot mixed up by a
+    //* swap-back shows as a wrong owner
+    struct Position
+    {
+        uint32_t owner{};
+        float x{};
+        float y{};
+        float z{};
+    };
+
+    struct Velocity
+    {
+        uint32_t owner{};
+        float value{};
+    };
+
+    struct Health
+    {
+        uint32_t owner{};
+        int value{};
+    };
+
+    //* What the store should hold for one alive entity
+    struct Expected
+    {
+        Entity entity{};
+        float position{};
+        float velocity{};
+        bool hasVelocity{};
+        int health{};
+        bool hasHealth{};
+    };
+
+    //* Returns the number of entities whose components (found through their records) are wrong
+    int wrongEntityCount(
+        EntityStore& store,
+        std::unordered_map<uint32_t, Expected> const& expected
+    )
+    {
+        int wrongCount{ 0 };
+
+        for ( auto const& [index, entry] : expected )
+        {
+            Entity const entity{ entry.entity };
+
+            bool isRight{
+                store.isAlive( entity )
+                && store.has<Position>( entity )
+                && store.get<Position>( entity ).owner == index
+                && store.get<Position>( entity ).x == entry.position
+                && store.has<Velocity>( entity ) == entry.hasVelocity
+                && store.has<Health>( entity ) == entry.hasHealth
+            };
+
+            if ( isRight && entry.hasVelocity )
+            {
+                isRight = store.get<Velocity>( entity ).owner == index
+                          && store.get<Velocity>( entity ).value == entry.velocity;
+            }
+
+            if ( isRight && entry.hasHealth )
+            {
+                isRight = store.get<Health>( entity ).owner == index
+                          && store.get<Health>( entity ).value == entry.health;
+            }
+
+            wrongCount += isRight ? 0 : 1;
+        }
+
+        return wrongCount;
+    }
+
+    //* Returns the number of rows whose entity id column and components disagree
+    int wrongRowCount(
+        EntityStore const& store,
+        std::unordered_map<uint32_t, Expected> const& expected
+    )
+    {
+        int wrongCount{ 0 };
+        int rowCount{ 0 };
+
+        Query<Position const> query{ store };
+
+        query.forEachChunk(
+            [&]( int count, Entity const* entities, Position const* positions )
+            {
+                for ( int i{ 0 }; i < count; ++i )
+                {
+                    auto const found{ expected.find( entities[i].index ) };
+
+                    bool const isRight{
+                        found != expected.end()
+                        && found->second.entity == entities[i]
+                        && positions[i].owner == entities[i].index
+                        && positions[i].x == found->second.position
+                    };
+
+                    wrongCount += isRight ? 0 : 1;
+                    ++rowCount;
+                }
+            }
+        );
+
+        return wrongCount + ( ( rowCount == static_cast<int>( expected.size() ) ) ? 0 : 1 );
+    }
+}
+
+TEST_CASE( "Destroyed entities stay dead after their index is reused", "[ecs]" )
+{
+    EntityStore store{};
+
+    Entity const first{ store.create( Position{ 0, 1.0f } ) };
+    Entity const second{ store.create( Position{ 1, 2.0f } ) };
+
+    store.destroy( first );
+
+    CHECK_FALSE( store.isAlive( first ) );
+    CHECK_FALSE( store.has<Position>( first ) );
+    CHECK( store.entityCount() == 1 );
+
+    //* Ignored: not alive
+    store.destroy( first );
+    CHECK( store.entityCount() == 1 );
+
+    Entity const reused{ store.create( Position{ 0, 3.0f } ) };
+
+    CHECK( reused.index == first.index );
+    CHECK( reused.generation != first.generation );
+    CHECK_FALSE( store.isAlive( first ) );
+    CHECK( store.isAlive( reused ) );
+    CHECK( store.get<Position>( reused ).x == 3.0f );
+    CHECK( store.get<Position>( second ).x == 2.0f );
+}
+
+TEST_CASE( "Adds, removes and destroys keep every record pointing at its components", "[ecs]" )
+{
+    EntityStore store{};
+    std::unordered_map<uint32_t, Expected> expected{};
+    std::vector<Entity> dead{};
+
+    std::mt19937 random{ 11 };
+    std::uniform_int_distribution<int> operation{ 0, 9 };
+    float nextValue{ 1.0f };
+
+    auto randomAlive = [&]() -> Expected&
+    {
+        auto it{ expected.begin() };
+        std::advance( it, std::uniform_int_distribution<size_t>{ 0, expected.size() - 1 }( random ) );
+
+        return it->second;
+    };
+
+    //* Several chunks per archetype, so swap-backs move entities across chunks too
+    for ( int i{ 0 }; i < 20000; ++i )
+    {
+        int const kind{ expected.size() < 100 ? 0 : operation( random ) };
+
+        if ( kind < 3 )
+        {
+            Entity const entity{ store.create( Position{ 0, nextValue } ) };
+            store.get<Position>( entity ).owner = entity.index;
+
+            expected[entity.index] = { entity, nextValue };
+        }
+        else if ( kind < 5 )
+        {
+            Expected& entry{ randomAlive() };
+            entry.velocity = nextValue;
+            entry.hasVelocity = true;
+
+            store.add( entry.entity, Velocity{ entry.entity.index, nextValue } );
+        }
+        else if ( kind < 6 )
+        {
+            Expected& entry{ randomAlive() };
+            entry.health = static_cast<int>( nextValue );
+            entry.hasHealth = true;
+
+            store.add( entry.entity, Health{ entry.entity.index, entry.health } );
+        }
+        else if ( kind < 8 )
+        {
+            Expected& entry{ randomAlive() };
+
+            if ( kind == 6 )
+            {
+                entry.hasVelocity = false;
+                store.remove<Velocity>( entry.entity );
+            }
+            else
+            {
+                entry.hasHealth = false;
+                store.remove<Health>( entry.entity );
+            }
+        }
+        else
+        {
+            Entity const entity{ randomAlive().entity };
+
+            store.destroy( entity );
+            expected.erase( entity.index );
+            dead.push_back( entity );
+        }
+
+        nextValue += 1.0f;
+    }
+
+    CHECK( store.entityCount() == static_cast<int>( expected.size() ) );
+    CHECK( wrongEntityCount( store, expected ) == 0 );
+    CHECK( wrongRowCount( store, expected ) == 0 );
+
+    int aliveDeadCount{ 0 };
+
+    for ( Entity const entity : dead )
+    {
+        aliveDeadCount += store.isAlive( entity ) ? 1 : 0;
+    }
+
+    CHECK( aliveDeadCount == 0 );
+
+    //* Removing and destroying everything leaves nothing to iterate
+    for ( auto const& [index, entry] : expected )
+    {
+        store.remove<Velocity>( entry.entity );
+        store.destroy( entry.entity );
+    }
+
+    CHECK( store.entityCount() == 0 );
+    CHECK( Query<Position>{ store }.count() == 0 );
+}
+
+TEST_CASE( "Churn at a chunk boundary reuses the emptied chunk", "[ecs]" )
+{
+    Archetype archetype{ Components::mask<Position>() };
+    int const capacity{ archetype.chunkCapacity() };
+
+    for ( int i{ 0 }; i < capacity; ++i )
+    {
+        archetype.allocate( { static_cast<uint32_t>( i ), 1 } );
+    }
+
+    Entity const extra{ static_cast<uint32_t>( capacity ), 1 };
+
+    archetype.allocate( extra );
+    std::byte const* const secondChunk{ archetype.chunk( 1 ).data };
+
+    int wrongCount{ 0 };
+
+    for ( int i{ 0 }; i < 100; ++i )
+    {
+        wrongCount += ( archetype.release( { 1, 0 } ) == extra && archetype.chunkCount() == 1 ) ? 0 : 1;
+
+        archetype.allocate( extra );
+
+        wrongCount += ( archetype.chunk( 1 ).data == secondChunk ) ? 0 : 1;
+    }
+
+    CHECK( wrongCount == 0 );
+
+    CHECK( archetype.entityCount() == capacity + 1 );
+}
@@ -0,0 +1,110 @@
+#include "FrameArena.h"
+#include "LinearAllocator.h"
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    //* Above a quarter sub-arena, so taken straight from the region: reserves size + alignment - 1 bytes
+    size_t const LARGE_SIZE{ 32 * 1024 };
+
+    bool isAligned(
+        void const* pointer,
+        size_t alignment
+    )
+    {
+        return reinterpret_cast<uintptr_t>( pointer ) % alignment == 0;
+    }
+}
+
+TEST_CASE( "Linear allocator aligns, fills blocks and keeps them over resets", "[memory]" )
+{
+    size_t const blockSize{ 1024 };
+    LinearAllocator allocator{ blockSize };
+
+    void* const first{ allocator.allocate( 1, 1 ) };
+    void* const aligned{ allocator.allocate( 8, 16 ) };
+
+    CHECK( isAligned( aligned, 16 ) );
+    CHECK( static_cast<std::byte*>( aligned ) > static_cast<std::byte*>( first ) );
+
+    //* Does not fit the rest of the block: a new block; larger than a block: one of its own
+    allocator.allocate( blockSize - 16, 1 );
+    allocator.allocate( 4 * blockSize, 16 );
+
+    size_t const reserved{ allocator.bytesReserved() };
+
+    CHECK( allocator.activeBlockCount() == 3 );
+    CHECK( reserved == 6 * blockSize );
+
+    allocator.reset();
+
+    CHECK( allocator.bytesUsed() == 0 );
+    CHECK( allocator.bytesReserved() == reserved );
+
+    //* The same sequence reuses the same memory
+    CHECK( allocator.allocate( 1, 1 ) == first );
+    CHECK( allocator.allocate( 8, 16 ) == aligned );
+    allocator.allocate( blockSize - 16, 1 );
+    allocator.allocate( 4 * blockSize, 16 );
+
+    CHECK( allocator.bytesReserved() == reserved );
+}
+
+TEST_CASE( "Frame arena regions are reused per frame in flight", "[memory]" )
+{
+    FrameArena arena{ 2, 1 << 20 };
+
+    arena.beginFrame( 0 );
+    void* const frame0Large{ arena.allocate( LARGE_SIZE, 16 ) };
+    void* const frame0Small{ arena.allocate( 16, 16 ) };
+
+    arena.beginFrame( 1 );
+    void* const frame1Large{ arena.allocate( LARGE_SIZE, 16 ) };
+
+    CHECK( frame1Large != frame0Large );
+
+    //* Frame 2 gets frame 0's region back, from its start, and a fresh sub-arena
+    arena.beginFrame( 2 );
+
+    CHECK( arena.allocate( LARGE_SIZE, 16 ) == frame0Large );
+    CHECK( arena.allocate( 16, 16 ) == frame0Small );
+    CHECK( isAligned( arena.allocate( 8, 256 ), 256 ) );
+}
+
+TEST_CASE( "Frame arena tracks the high water mark and overflows to the heap", "[memory]" )
+{
+    size_t const bytesPerFrame{ 4 * LARGE_SIZE };
+    FrameArena arena{ 1, bytesPerFrame };
+
+    arena.beginFrame( 0 );
+    arena.allocate( LARGE_SIZE, 1 );
+    arena.allocate( LARGE_SIZE, 1 );
+
+    arena.beginFrame( 1 );
+    arena.allocate( LARGE_SIZE, 1 );
+
+    arena.beginFrame( 2 );
+
+    CHECK( arena.stats().lastFrameBytes == LARGE_SIZE );
+    CHECK( arena.stats().highWaterBytes == 2 * LARGE_SIZE );
+    CHECK( arena.stats().overflowCount == 0 );
+
+    //* Past the region: still usable memory, counted
+    std::vector<std::byte*> blocks{};
+
+    for ( int i{ 0 }; i < 6; ++i )
+    {
+        blocks.push_back( static_cast<std::byte*>( arena.allocate( LARGE_SIZE, 1 ) ) );
+        std::memset( blocks.back(), i, LARGE_SIZE );
+    }
+
+    CHECK( arena.stats().overflowCount == 2 );
+
+    arena.beginFrame( 3 );
+
+    CHECK( arena.stats().highWaterBytes == 6 * LARGE_SIZE );
+}
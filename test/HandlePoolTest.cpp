@@ -0,0 +1,73 @@
+#include "HandlePool.h"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    struct TestTag
+    {
+    };
+
+    using TestHandle = Handle<TestTag>;
+}
+
+TEST_CASE( "Destroyed handles stay stale after their slot is reused", "[handles]" )
+{
+    HandlePool<TestHandle, int> pool{};
+
+    TestHandle const first{ pool.create( 10 ) };
+    TestHandle const second{ pool.create( 20 ) };
+
+    CHECK_FALSE( TestHandle{}.isValid() );
+    REQUIRE( pool.get( first ) != nullptr );
+    CHECK( *pool.get( first ) == 10 );
+
+    CHECK( pool.destroy( first ) );
+    CHECK_FALSE( pool.destroy( first ) );
+    CHECK( pool.get( first ) == nullptr );
+
+    //* Same slot, next generation
+    TestHandle const reused{ pool.create( 30 ) };
+
+    CHECK( reused.index == first.index );
+    CHECK( reused.generation == first.generation + 1 );
+    CHECK( reused != first );
+    CHECK_FALSE( pool.isAlive( first ) );
+    CHECK( pool.get( first ) == nullptr );
+
+    REQUIRE( pool.get( reused ) != nullptr );
+    CHECK( *pool.get( reused ) == 30 );
+    REQUIRE( pool.get( second ) != nullptr );
+    CHECK( *pool.get( second ) == 20 );
+}
+
+TEST_CASE( "Destroying keeps values dense and handles pointing at their values", "[handles]" )
+{
+    HandlePool<TestHandle, int> pool{};
+    std::vector<TestHandle> handles{};
+
+    for ( int i{ 0 }; i < 8; ++i )
+    {
+        handles.push_back( pool.create( i ) );
+    }
+
+    //* First, last and middle values: every case of the swap with the last value
+    for ( int i : { 0, 7, 3 } )
+    {
+        CHECK( pool.destroy( handles[i] ) );
+    }
+
+    CHECK( pool.size() == 5 );
+
+    for ( int i : { 1, 2, 4, 5, 6 } )
+    {
+        REQUIRE( pool.get( handles[i] ) != nullptr );
+        CHECK( *pool.get( handles[i] ) == i );
+    }
+
+    std::vector<int> values{ pool.values() };
+    std::sort( values.begin(), values.end() );
+
+    CHECK( values == std::vector<int>{ 1, 2, 4, 5, 6 } );
+}
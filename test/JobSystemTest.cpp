@@ -0,0 +1,188 @@
+#include "JobSystem.h"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE( "Waiting on a counter returns after all of its jobs ran", "[jobs]" )
+{
+    int const workerCount{ GENERATE( 1, 4 ) };
+    int const jobCount{ 1000 };
+
+    JobSystem jobs{ workerCount };
+    JobCounter counter{};
+    std::atomic<int> doneCount{ 0 };
+
+    for ( int i{ 0 }; i < jobCount; ++i )
+    {
+        jobs.run(
+            counter,
+            [&doneCount]()
+            {
+                doneCount.fetch_add( 1, std::memory_order_relaxed );
+            }
+        );
+    }
+
+    jobs.wait( counter );
+
+    CHECK( counter.isDone() );
+    CHECK( doneCount.load() == jobCount );
+}
+
+TEST_CASE( "Jobs waiting on another counter see its jobs' results", "[jobs]" )
+{
+    int const workerCount{ GENERATE( 1, 4 ) };
+    int const valueCount{ 256 };
+
+    JobSystem jobs{ workerCount };
+    std::vector<int> values( valueCount );
+    JobCounter produced{};
+    JobCounter consumed{};
+    int sum{ 0 };
+
+    //* Submitted first, so it runs (or is stolen) before the jobs it depends on
+    jobs.run(
+        consumed,
+        [&jobs, &produced, &values, &sum]()
+        {
+            jobs.wait( produced );
+
+            for ( int value : values )
+            {
+                sum += value;
+            }
+        }
+    );
+
+    for ( int i{ 0 }; i < valueCount; ++i )
+    {
+        jobs.run(
+            produced,
+            [&values, i]()
+            {
+                values[i] = i;
+            }
+        );
+    }
+
+    jobs.wait( consumed );
+
+    CHECK( produced.isDone() );
+    CHECK( sum == valueCount * ( valueCount - 1 ) / 2 );
+}
+
+TEST_CASE( "Parallel for covers every index exactly once", "[jobs]" )
+{
+    int const workerCount{ GENERATE( 1, 4 ) };
+    int const grainSize{ GENERATE( 0, 1, 64, 1000 ) };
+    int const count{ 10007 };
+
+    JobSystem jobs{ workerCount };
+    std::vector<std::atomic<int>> visitCounts( count );
+
+    //* Catch's assertions are not thread safe, chunks only record
+    std::atomic<int> oversizedCount{ 0 };
+
+    jobs.parallelFor(
+        count,
+        grainSize,
+        [&visitCounts, &oversizedCount, grainSize]( int begin, int end )
+        {
+            if ( end - begin > std::max( grainSize, 1 ) )
+            {
+                oversizedCount.fetch_add( 1, std::memory_order_relaxed );
+            }
+
+            for ( int i{ begin }; i < end; ++i )
+            {
+                visitCounts[i].fetch_add( 1, std::memory_order_relaxed );
+            }
+        }
+    );
+
+    int wrongCount{ 0 };
+
+    for ( std::atomic<int> const& visits : visitCounts )
+    {
+        wrongCount += ( visits.load() != 1 ) ? 1 : 0;
+    }
+
+    CHECK( wrongCount == 0 );
+    CHECK( oversizedCount.load() == 0 );
+}
+
+TEST_CASE( "Jobs run inline when the slots are exhausted", "[jobs]" )
+{
+    int const workerCount{ GENERATE( 1, 4 ) };
+    int const jobCount{ JobSystem::JOBS_PER_WORKER + 500 };
+
+    JobSystem jobs{ workerCount };
+    JobCounter counter{};
+
+    //* Other workers hold on to the jobs they steal, so no slot is freed before the gate opens
+    std::thread::id const submitter{ std::this_thread::get_id() };
+    std::atomic<bool> isGateOpen{ false };
+    std::atomic<int> inlineCount{ 0 };
+    std::atomic<int> doneCount{ 0 };
+
+    for ( int i{ 0 }; i < jobCount; ++i )
+    {
+        jobs.run(
+            counter,
+            [&, submitter]()
+            {
+                if ( std::this_thread::get_id() != submitter )
+                {
+                    while ( !isGateOpen.load( std::memory_order_acquire ) )
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                else if ( !isGateOpen.load( std::memory_order_acquire ) )
+                {
+                    inlineCount.fetch_add( 1, std::memory_order_relaxed );
+                }
+
+                doneCount.fetch_add( 1, std::memory_order_relaxed );
+            }
+        );
+    }
+
+    CHECK( inlineCount.load() == jobCount - JobSystem::JOBS_PER_WORKER );
+
+    isGateOpen.store( true, std::memory_order_release );
+    jobs.wait( counter );
+
+    CHECK( doneCount.load() == jobCount );
+}
+
+TEST_CASE( "Threads that are no workers run their jobs inline", "[jobs]" )
+{
+    int const workerCount{ GENERATE( 1, 4 ) };
+
+    JobSystem jobs{ workerCount };
+    JobCounter counter{};
+    bool hasRun{ false };
+    bool isDoneAfterRun{ false };
+
+    std::thread outsider{
+        [&]()
+        {
+            jobs.run(
+                counter,
+                [&hasRun]()
+                {
+                    hasRun = true;
+                }
+            );
+
+            isDoneAfterRun = hasRun && counter.isDone();
+        }
+    };
+
+    outsider.join();
+
+    CHECK( isDoneAfterRun );
+}
@@ -0,0 +1,219 @@
+#include "CpuFeatures.h"
+#include "Math.h"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    //* Levels this CPU can run; the others may not be built, or crash on this CPU
+    std::vector<SimdLevel> supportedLevels()
+    {
+        SimdLevel const best{ Math::bestSimdLevel() };
+        std::vector<SimdLevel> levels{ SimdLevel::SCALAR };
+
+        if ( best == SimdLevel::AVX2 )
+        {
+            levels.push_back( SimdLevel::SSE );
+        }
+
+        if ( best != SimdLevel::SCALAR )
+        {
+            levels.push_back( best );
+        }
+
+        return levels;
+    }
+
+    bool isNear(
+        Mat4 const& a,
+        Mat4 const& b,
+        float tolerance = 1e-4f
+    )
+    {
+        for ( int i{ 0 }; i < 16; ++i )
+        {
+            float const scale{ std::max( 1.0f, std::abs( b.values[i] ) ) };
+
+            if ( std::abs( a.values[i] - b.values[i] ) > tolerance * scale )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool isNear(
+        Vec4 a,
+        Vec4 b
+    )
+    {
+        return std::abs( a.x - b.x ) < 1e-4f
+               && std::abs( a.y - b.y ) < 1e-4f
+               && std::abs( a.z - b.z ) < 1e-4f
+               && std::abs( a.w - b.w ) < 1e-4f;
+    }
+
+    struct RandomMath
+    {
+        std::mt19937 random{ 5 };
+        std::uniform_real_distribution<float> value{ -2.0f, 2.0f };
+
+        Mat4 matrix()
+        {
+            Mat4 m;
+
+            for ( float& element : m.values )
+            {
+                element = value( random );
+            }
+
+            return m;
+        }
+
+        std::vector<Mat4> matrices( int count )
+        {
+            std::vector<Mat4> result( count );
+
+            for ( Mat4& m : result )
+            {
+                m = matrix();
+            }
+
+            return result;
+        }
+
+        Vec3 vector() { return { value( random ), value( random ), value( random ) }; }
+
+        Quat rotation() { return Math::fromAxisAngle( Math::normalize( vector() ), 1.5f * value( random ) ); }
+    };
+
+    int mismatchCount(
+        std::vector<Mat4> const& actual,
+        std::vector<Mat4> const& expected
+    )
+    {
+        int mismatches{ 0 };
+
+        for ( size_t i{ 0 }; i < actual.size(); ++i )
+        {
+            mismatches += isNear( actual[i], expected[i] ) ? 0 : 1;
+        }
+
+        return mismatches;
+    }
+}
+
+TEST_CASE( "Every SIMD level multiplies like the scalar reference", "[math]" )
+{
+    //* Odd, so the kernels' tails run too
+    int const count{ 37 };
+
+    RandomMath random{};
+    Mat4 const left{ random.matrix() };
+    std::vector<Mat4> const lefts{ random.matrices( count ) };
+    std::vector<Mat4> const rights{ random.matrices( count ) };
+
+    std::vector<Mat4> expectedShared( count );
+    std::vector<Mat4> expectedPairs( count );
+
+    for ( int i{ 0 }; i < count; ++i )
+    {
+        expectedShared[i] = left * rights[i];
+        expectedPairs[i] = lefts[i] * rights[i];
+    }
+
+    for ( SimdLevel level : supportedLevels() )
+    {
+        INFO( simdLevelName( level ) );
+
+        std::vector<Mat4> out( count );
+
+        Math::multiplyMatrices( left, rights.data(), out.data(), count, level );
+        CHECK( mismatchCount( out, expectedShared ) == 0 );
+
+        Math::multiplyMatrices( lefts.data(), rights.data(), out.data(), count, level );
+        CHECK( mismatchCount( out, expectedPairs ) == 0 );
+
+        //* In place: `out == right`, and `out == left` for pairs
+        std::vector<Mat4> inPlace{ rights };
+        Math::multiplyMatrices( left, inPlace.data(), inPlace.data(), count, level );
+        CHECK( mismatchCount( inPlace, expectedShared ) == 0 );
+
+        inPlace = rights;
+        Math::multiplyMatrices( lefts.data(), inPlace.data(), inPlace.data(), count, level );
+        CHECK( mismatchCount( inPlace, expectedPairs ) == 0 );
+
+        inPlace = lefts;
+        Math::multiplyMatrices( inPlace.data(), rights.data(), inPlace.data(), count, level );
+        CHECK( mismatchCount( inPlace, expectedPairs ) == 0 );
+    }
+}
+
+TEST_CASE( "Rotations round trip through matrices", "[math]" )
+{
+    RandomMath random{};
+    int wrongCount{ 0 };
+
+    for ( int i{ 0 }; i < 100; ++i )
+    {
+        Quat const q{ random.rotation() };
+        Quat const back{ Math::fromRotation( Math::rotation( q ) ) };
+
+        //* q and -q are the same rotation
+        float const sign{ ( q.x * back.x + q.y * back.y + q.z * back.z + q.w * back.w ) < 0.0f ? -1.0f : 1.0f };
+
+        bool const isSame{
+            std::abs( q.x - sign * back.x ) < 1e-4f
+            && std::abs( q.y - sign * back.y ) < 1e-4f
+            && std::abs( q.z - sign * back.z ) < 1e-4f
+            && std::abs( q.w - sign * back.w ) < 1e-4f
+        };
+
+        wrongCount += isSame ? 0 : 1;
+    }
+
+    CHECK( wrongCount == 0 );
+}
+
+TEST_CASE( "Rigid inverse undoes rotation and translation", "[math]" )
+{
+    RandomMath random{};
+    int wrongCount{ 0 };
+
+    for ( int i{ 0 }; i < 100; ++i )
+    {
+        Mat4 const m{ Math::compose( { random.vector(), random.rotation() } ) };
+
+        wrongCount += isNear( Math::inverseRigid( m ) * m, Mat4{} ) ? 0 : 1;
+        wrongCount += isNear( m * Math::inverseRigid( m ), Mat4{} ) ? 0 : 1;
+    }
+
+    CHECK( wrongCount == 0 );
+}
+
+TEST_CASE( "Look at puts the eye at the origin, looking down -z", "[math]" )
+{
+    Vec3 const eye{ 1.0f, 2.0f, 3.0f };
+    Vec3 const target{ -2.0f, 0.0f, -1.0f };
+    Mat4 const view{ Math::lookAt( eye, target, { 0.0f, 1.0f, 0.0f } ) };
+
+    float const distance{ Math::length( target - eye ) };
+
+    CHECK( isNear( view * Vec4{ eye.x, eye.y, eye.z, 1.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } ) );
+    CHECK( isNear( view * Vec4{ target.x, target.y, target.z, 1.0f }, { 0.0f, 0.0f, -distance, 1.0f } ) );
+
+    //* Up stays up: a point above the eye has no x and a positive y in view space
+    Vec4 const above{ view * Vec4{ eye.x, eye.y + 1.0f, eye.z, 1.0f } };
+
+    CHECK( std::abs( above.x ) < 1e-4f );
+    CHECK( above.y > 0.0f );
+
+    //* A view matrix is rigid: its inverse is the camera's world transform
+    Mat4 const world{ Math::inverseRigid( view ) };
+
+    CHECK( isNear( world * Vec4{ 0.0f, 0.0f, 0.0f, 1.0f }, { eye.x, eye.y, eye.z, 1.0f } ) );
+}
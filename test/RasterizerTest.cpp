@@ -0,0 +1,156 @@
+#include "Rasterizer.h"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+    uint32_t const CLEAR_COLOR{ 0xff000000u };
+
+    //* Window coordinates (y up) of every pixel that is not the clear color
+    std::vector<int> coveredPixels(
+        Rasterizer const& rasterizer,
+        int width,
+        int height
+    )
+    {
+        std::vector<int> covered{};
+
+        for ( int y{ 0 }; y < height; ++y )
+        {
+            for ( int x{ 0 }; x < width; ++x )
+            {
+                if ( rasterizer.colorBuffer()[static_cast<size_t>( height - 1 - y ) * width + x] != CLEAR_COLOR )
+                {
+                    covered.push_back( y * width + x );
+                }
+            }
+        }
+
+        return covered;
+    }
+
+    std::vector<int> rasterizeAlone(
+        Rasterizer& rasterizer,
+        RasterVertex const& v0,
+        RasterVertex const& v1,
+        RasterVertex const& v2,
+        int width,
+        int height
+    )
+    {
+        rasterizer.clear( CLEAR_COLOR );
+        rasterizer.submitTriangle( v0, v1, v2 );
+        rasterizer.flush();
+
+        return coveredPixels( rasterizer, width, height );
+    }
+
+    //* Random triangles (some beyond the framebuffer), rasterized with or without AVX2
+    std::vector<uint32_t> rasterizeRandomScene(
+        bool useAvx2,
+        int width,
+        int height
+    )
+    {
+        Rasterizer rasterizer{};
+        rasterizer.init( width, height, 4 );
+        rasterizer.setAvx2( useAvx2 );
+
+        std::mt19937 random{ 42 };
+        std::uniform_real_distribution<float> positionX{ -0.25f * width, 1.25f * width };
+        std::uniform_real_distribution<float> positionY{ -0.25f * height, 1.25f * height };
+        std::uniform_real_distribution<float> color{ 0.0f, 1.0f };
+
+        auto randomVertex = [&]()
+        {
+            return RasterVertex{ positionX( random ), positionY( random ), color( random ), color( random ), color( random ) };
+        };
+
+        rasterizer.clear( CLEAR_COLOR );
+
+        for ( int i{ 0 }; i < 500; ++i )
+        {
+            rasterizer.submitTriangle( randomVertex(), randomVertex(), randomVertex() );
+        }
+
+        rasterizer.flush();
+
+        std::vector<uint32_t> colorBuffer{ rasterizer.colorBuffer() };
+        rasterizer.deinit();
+
+        return colorBuffer;
+    }
+}
+
+TEST_CASE( "Triangles sharing an edge cover each pixel center on it once", "[rasterizer]" )
+{
+    int const width{ 8 };
+    int const height{ 8 };
+
+    bool const useAvx2{ GENERATE( true, false ) };
+
+    Rasterizer rasterizer{};
+    rasterizer.init( width, height, 1 );
+    rasterizer.setAvx2( useAvx2 );
+
+    //* Square [0.5, 4.5]^2 split along its diagonal, every edge runs through pixel centers
+    RasterVertex const bottomLeft{ 0.5f, 0.5f, 1.0f, 0.0f, 0.0f };
+    RasterVertex const bottomRight{ 4.5f, 0.5f, 1.0f, 0.0f, 0.0f };
+    RasterVertex const topRight{ 4.5f, 4.5f, 1.0f, 0.0f, 0.0f };
+    RasterVertex const topLeft{ 0.5f, 4.5f, 1.0f, 0.0f, 0.0f };
+
+    std::vector<int> const lower{ rasterizeAlone( rasterizer, bottomLeft, bottomRight, topRight, width, height ) };
+
+    //* Clockwise, triangles are not culled
+    std::vector<int> const upper{ rasterizeAlone( rasterizer, bottomLeft, topLeft, topRight, width, height ) };
+
+    rasterizer.deinit();
+
+    //* Left and top (y is up) edges are included, right and bottom edges are not
+    std::vector<int> expected{};
+
+    for ( int y{ 1 }; y <= 4; ++y )
+    {
+        for ( int x{ 0 }; x < 4; ++x )
+        {
+            expected.push_back( y * width + x );
+        }
+    }
+
+    std::vector<int> both{ lower };
+    both.insert( both.end(), upper.begin(), upper.end() );
+    std::sort( both.begin(), both.end() );
+
+    CHECK( both == expected );
+}
+
+TEST_CASE( "AVX2 and scalar triangle paths produce identical pixels", "[rasterizer]" )
+{
+    //* Not a multiple of the tile size, so partial tiles and spans are covered
+    int const width{ 203 };
+    int const height{ 141 };
+
+    CHECK( rasterizeRandomScene( true, width, height ) == rasterizeRandomScene( false, width, height ) );
+}
+
+TEST_CASE( "Flushing without new submissions does nothing", "[rasterizer]" )
+{
+    Rasterizer rasterizer{};
+    rasterizer.init( 16, 16, 1 );
+
+    rasterizer.clear( CLEAR_COLOR );
+    rasterizer.submitTriangle( { 0.0f, 0.0f }, { 16.0f, 0.0f }, { 0.0f, 16.0f } );
+    rasterizer.flush();
+
+    std::vector<uint32_t> const colorBuffer{ rasterizer.colorBuffer() };
+
+    rasterizer.flush();
+
+    CHECK( rasterizer.stats().flushes == 1 );
+    CHECK( rasterizer.colorBuffer() == colorBuffer );
+
+    rasterizer.deinit();
+}
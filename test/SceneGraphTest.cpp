@@ -0,0 +1,213 @@
+#include "CpuFeatures.h"
+#include "JobSystem.h"
+#include "Math.h"
+#include "SceneGraph.h"
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    //* The hierarchy kept a second time, recomputed from the roots down every time
+    struct NaiveGraph
+    {
+        std::vector<int> parents{};
+        std::vector<Transform> locals{};
+        std::vector<bool> isSet{};
+
+        void addNode(
+            int parent,
+            Transform const& local
+        )
+        {
+            parents.push_back( parent );
+            locals.push_back( local );
+            isSet.push_back( true );
+        }
+
+        void setLocal(
+            int node,
+            Transform const& local
+        )
+        {
+            locals[node] = local;
+            isSet[node] = true;
+        }
+
+        //* Parents are added before their children
+        std::vector<Mat4> worlds() const
+        {
+            std::vector<Mat4> result( parents.size() );
+
+            for ( size_t i{ 0 }; i < parents.size(); ++i )
+            {
+                Mat4 const local{ Math::compose( locals[i] ) };
+                result[i] = ( parents[i] == SceneGraph::NO_PARENT ) ? local : result[parents[i]] * local;
+            }
+
+            return result;
+        }
+
+        //* Nodes set since the last call, and their subtrees
+        int takeDirtyCount()
+        {
+            std::vector<bool> isDirty( parents.size() );
+            int count{ 0 };
+
+            for ( size_t i{ 0 }; i < parents.size(); ++i )
+            {
+                isDirty[i] = isSet[i] || ( parents[i] != SceneGraph::NO_PARENT && isDirty[parents[i]] );
+                count += isDirty[i] ? 1 : 0;
+                isSet[i] = false;
+            }
+
+            return count;
+        }
+    };
+
+    struct TreeBuilder
+    {
+        std::mt19937 random{ 3 };
+        std::uniform_real_distribution<float> offset{ -1.0f, 1.0f };
+        std::uniform_real_distribution<float> angle{ -3.0f, 3.0f };
+        std::uniform_real_distribution<float> scale{ 0.9f, 1.1f };
+
+        Transform randomTransform()
+        {
+            Vec3 const axis{ Math::normalize( Vec3{ offset( random ), offset( random ), 1.0f } ) };
+
+            return {
+                { offset( random ), offset( random ), offset( random ) },
+                Math::fromAxisAngle( axis, angle( random ) ),
+                { scale( random ), scale( random ), scale( random ) }
+            };
+        }
+
+        int randomNode( int count ) { return std::uniform_int_distribution<int>{ 0, count - 1 }( random ); }
+
+        void add(
+            SceneGraph& graph,
+            NaiveGraph& naive,
+            int parent
+        )
+        {
+            Transform const local{ randomTransform() };
+
+            //* Ids are handed out in order, the same as the naive graph's indices
+            graph.addNode( parent, local );
+            naive.addNode( parent, local );
+        }
+    };
+
+    int mismatchCount(
+        SceneGraph const& graph,
+        NaiveGraph const& naive
+    )
+    {
+        std::vector<Mat4> const expected{ naive.worlds() };
+        int mismatches{ 0 };
+
+        for ( int node{ 0 }; node < graph.nodeCount(); ++node )
+        {
+            for ( int i{ 0 }; i < 16; ++i )
+            {
+                if ( std::abs( graph.world( node ).values[i] - expected[node].values[i] ) > 1e-3f )
+                {
+                    ++mismatches;
+                    break;
+                }
+            }
+        }
+
+        return mismatches;
+    }
+}
+
+TEST_CASE( "Dirty propagation matches recomputing the whole hierarchy", "[scenegraph]" )
+{
+    bool const useJobs{ GENERATE( false, true ) };
+    SimdLevel const level{ GENERATE( SimdLevel::SCALAR, Math::bestSimdLevel() ) };
+
+    JobSystem jobs{ 2 };
+    JobSystem* const jobsUsed{ useJobs ? &jobs : nullptr };
+
+    SceneGraph graph{};
+    NaiveGraph naive{};
+    TreeBuilder builder{};
+
+    //* A level wide enough to be split into jobs, then random parents (mixed depths)
+    builder.add( graph, naive, SceneGraph::NO_PARENT );
+
+    for ( int i{ 0 }; i < 8; ++i )
+    {
+        builder.add( graph, naive, 0 );
+    }
+
+    for ( int i{ 0 }; i < 2 * SceneGraph::GRAIN_SIZE + 100; ++i )
+    {
+        builder.add( graph, naive, 1 + builder.randomNode( 8 ) );
+    }
+
+    for ( int i{ 0 }; i < 3000; ++i )
+    {
+        builder.add( graph, naive, builder.randomNode( graph.nodeCount() ) );
+    }
+
+    graph.update( jobsUsed, level );
+
+    REQUIRE( graph.nodeCount() == static_cast<int>( naive.parents.size() ) );
+    CHECK( graph.depthCount() > 3 );
+    CHECK( graph.updatedCount() == naive.takeDirtyCount() );
+    CHECK( mismatchCount( graph, naive ) == 0 );
+
+    SECTION( "nothing set, nothing recomputed" )
+    {
+        graph.update( jobsUsed, level );
+
+        CHECK( graph.updatedCount() == 0 );
+        CHECK( mismatchCount( graph, naive ) == 0 );
+    }
+
+    SECTION( "only set nodes and their subtrees are recomputed" )
+    {
+        for ( int i{ 0 }; i < 20; ++i )
+        {
+            int const node{ 9 + builder.randomNode( graph.nodeCount() - 9 ) };
+            Transform const local{ builder.randomTransform() };
+
+            graph.setLocal( node, local );
+            naive.setLocal( node, local );
+        }
+
+        //* The setters for single parts
+        Transform moved{ naive.locals[5] };
+        moved.position = { 2.0f, 0.0f, 0.0f };
+        graph.setPosition( 5, moved.position );
+        naive.setLocal( 5, moved );
+
+        graph.update( jobsUsed, level );
+
+        CHECK( graph.updatedCount() == naive.takeDirtyCount() );
+        CHECK( graph.updatedCount() < graph.nodeCount() );
+        CHECK( mismatchCount( graph, naive ) == 0 );
+    }
+
+    SECTION( "nodes added after an update are placed in depth order" )
+    {
+        for ( int i{ 0 }; i < 500; ++i )
+        {
+            builder.add( graph, naive, builder.randomNode( graph.nodeCount() ) );
+        }
+
+        Transform rotated{ naive.locals[0] };
+        rotated.rotation = Math::fromAxisAngle( { 0.0f, 1.0f, 0.0f }, 0.5f );
+        graph.setRotation( 0, rotated.rotation );
+        naive.setLocal( 0, rotated );
+
+        graph.update( jobsUsed, level );
+
+        CHECK( graph.updatedCount() == naive.takeDirtyCount() );
+        CHECK( mismatchCount( graph, naive ) == 0 );
+    }
+}
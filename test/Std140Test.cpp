@@ -0,0 +1,125 @@
+#include "Std140.h"
+#include "UniformBlocks.h"
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    enum class GlslType
+    {
+        FLOAT,
+        VEC2,
+        VEC4,
+        MAT4,
+    };
+
+    struct Std140Layout
+    {
+        std::vector<size_t> offsets{};
+        size_t size{};
+    };
+
+    size_t roundUp(
+        size_t value,
+        size_t alignment
+    )
+    {
+        return ( value + alignment - 1 ) / alignment * alignment;
+    }
+
+    //* The std140 rules, written out: base alignment and size per type, block rounded up to 16
+    Std140Layout std140Layout( std::vector<GlslType> const& members )
+    {
+        Std140Layout layout{};
+        size_t offset{ 0 };
+
+        for ( GlslType type : members )
+        {
+            size_t alignment{ 4 };
+            size_t size{ 4 };
+
+            switch ( type )
+            {
+                case GlslType::FLOAT:
+                    break;
+                case GlslType::VEC2:
+                    alignment = 8;
+                    size = 8;
+                    break;
+                case GlslType::VEC4:
+                    alignment = 16;
+                    size = 16;
+                    break;
+                case GlslType::MAT4:
+                    //* Array of 4 column vec4
+                    alignment = 16;
+                    size = 64;
+                    break;
+            }
+
+            offset = roundUp( offset, alignment );
+            layout.offsets.push_back( offset );
+            offset += size;
+        }
+
+        layout.size = roundUp( offset, 16 );
+
+        return layout;
+    }
+
+    //* Members in an order that needs padding after every scalar
+    struct MixedBlock
+    {
+        float first{};
+        Std140::Vec4 color{};
+        float second{};
+        Std140::Vec2 extent{};
+        float third{};
+        Std140::Mat4 transform{};
+        float last{};
+    };
+}
+
+TEST_CASE( "Std140 types have the base alignment and size of their GLSL type", "[std140]" )
+{
+    CHECK( alignof( Std140::Vec2 ) == 8 );
+    CHECK( sizeof( Std140::Vec2 ) == 8 );
+    CHECK( alignof( Std140::Vec4 ) == 16 );
+    CHECK( sizeof( Std140::Vec4 ) == 16 );
+    CHECK( alignof( Std140::Mat4 ) == 16 );
+    CHECK( sizeof( Std140::Mat4 ) == 64 );
+}
+
+TEST_CASE( "Uniform blocks match the std140 layout of their GLSL declaration", "[std140]" )
+{
+    Std140Layout const frame{ std140Layout( { GlslType::MAT4, GlslType::FLOAT, GlslType::FLOAT, GlslType::VEC2 } ) };
+
+    CHECK( offsetof( FrameBlock, viewProjection ) == frame.offsets[0] );
+    CHECK( offsetof( FrameBlock, time ) == frame.offsets[1] );
+    CHECK( offsetof( FrameBlock, deltaTime ) == frame.offsets[2] );
+    CHECK( offsetof( FrameBlock, resolution ) == frame.offsets[3] );
+    CHECK( sizeof( FrameBlock ) == frame.size );
+
+    Std140Layout const object{ std140Layout( { GlslType::MAT4, GlslType::VEC4 } ) };
+
+    CHECK( offsetof( ObjectBlock, model ) == object.offsets[0] );
+    CHECK( offsetof( ObjectBlock, tint ) == object.offsets[1] );
+    CHECK( sizeof( ObjectBlock ) == object.size );
+}
+
+TEST_CASE( "Std140 members pad like GLSL after scalars", "[std140]" )
+{
+    Std140Layout const mixed{ std140Layout(
+        { GlslType::FLOAT, GlslType::VEC4, GlslType::FLOAT, GlslType::VEC2, GlslType::FLOAT, GlslType::MAT4, GlslType::FLOAT }
+    ) };
+
+    CHECK( offsetof( MixedBlock, first ) == mixed.offsets[0] );
+    CHECK( offsetof( MixedBlock, color ) == mixed.offsets[1] );
+    CHECK( offsetof( MixedBlock, second ) == mixed.offsets[2] );
+    CHECK( offsetof( MixedBlock, extent ) == mixed.offsets[3] );
+    CHECK( offsetof( MixedBlock, third ) == mixed.offsets[4] );
+    CHECK( offsetof( MixedBlock, transform ) == mixed.offsets[5] );
+    CHECK( offsetof( MixedBlock, last ) == mixed.offsets[6] );
+    CHECK( sizeof( MixedBlock ) == mixed.size );
+}
@@ -0,0 +1,118 @@
+#include "WorkStealingDeque.h"
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE( "Owner pops newest first, thieves steal oldest first", "[jobs]" )
+{
+    int items[4]{ 0, 1, 2, 3 };
+    WorkStealingDeque<int> deque{ 4 };
+
+    for ( int& item : items )
+    {
+        REQUIRE( deque.push( &item ) );
+    }
+
+    CHECK( deque.pop() == &items[3] );
+    CHECK( deque.steal() == &items[0] );
+    CHECK( deque.steal() == &items[1] );
+    CHECK( deque.pop() == &items[2] );
+
+    CHECK( deque.isEmpty() );
+    CHECK( deque.pop() == nullptr );
+    CHECK( deque.steal() == nullptr );
+}
+
+TEST_CASE( "Push fails when full, capacity is rounded up to a power of two", "[jobs]" )
+{
+    int items[5]{};
+    WorkStealingDeque<int> deque{ 3 };
+
+    for ( int i{ 0 }; i < 4; ++i )
+    {
+        REQUIRE( deque.push( &items[i] ) );
+    }
+
+    CHECK_FALSE( deque.push( &items[4] ) );
+
+    //* A steal frees a slot, indices wrap around
+    CHECK( deque.steal() == &items[0] );
+    CHECK( deque.push( &items[4] ) );
+    CHECK( deque.pop() == &items[4] );
+}
+
+TEST_CASE( "Concurrent pops and steals take every item exactly once", "[jobs]" )
+{
+    int const itemCount{ 100000 };
+    int const thiefCount{ 3 };
+
+    std::vector<int> items( itemCount );
+    std::vector<std::atomic<int>> takenCounts( itemCount );
+    WorkStealingDeque<int> deque{ 256 };
+    std::atomic<bool> isOwnerDone{ false };
+
+    auto take = [&]( int* item )
+    {
+        takenCounts[item - items.data()].fetch_add( 1, std::memory_order_relaxed );
+    };
+
+    std::vector<std::thread> thieves{};
+
+    for ( int i{ 0 }; i < thiefCount; ++i )
+    {
+        thieves.emplace_back(
+            [&]()
+            {
+                while ( !isOwnerDone.load( std::memory_order_acquire ) || !deque.isEmpty() )
+                {
+                    if ( int* item{ deque.steal() } )
+                    {
+                        take( item );
+                    }
+                }
+            }
+        );
+    }
+
+    //* Owner: push everything, popping now and then (and whenever full)
+    for ( int i{ 0 }; i < itemCount; ++i )
+    {
+        while ( !deque.push( &items[i] ) )
+        {
+            if ( int* item{ deque.pop() } )
+            {
+                take( item );
+            }
+        }
+
+        if ( i % 3 == 0 )
+        {
+            if ( int* item{ deque.pop() } )
+            {
+                take( item );
+            }
+        }
+    }
+
+    while ( int* item{ deque.pop() } )
+    {
+        take( item );
+    }
+
+    isOwnerDone.store( true, std::memory_order_release );
+
+    for ( std::thread& thief : thieves )
+    {
+        thief.join();
+    }
+
+    int wrongCount{ 0 };
+
+    for ( std::atomic<int> const& count : takenCounts )
+    {
+        wrongCount += ( count.load() != 1 ) ? 1 : 0;
+    }
+
+    CHECK( wrongCount == 0 );
+}
@@ -0,0 +1,3 @@
+//* Entry point of the test build (`make bt`/`make rt`), tests live next to it in ./test
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>